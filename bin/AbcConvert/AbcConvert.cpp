@@ -83,11 +83,9 @@ void copyProps(Alembic::Abc::ICompoundProperty & iRead,
 
             for (std::size_t j = 0; j < numSamples; ++j)
             {
-                Alembic::AbcCoreAbstract::ArraySamplePtr samp;
                 Alembic::Abc::ISampleSelector sel(
                     (Alembic::Abc::index_t) j);
-                inProp.get(samp, sel);
-                outProp.set(*samp);
+                outProp.setSampleFromReader(inProp, sel);
             }
         }
         else if (header.isScalar())
@@ -186,7 +186,6 @@ void stitchArrayProp(const PropertyHeader & propHeader,
         IArrayProperty reader(iCompoundProps[iCpIndex], propName);
         index_t numSamples = reader.getNumSamples();
 
-        ArraySamplePtr dataPtr;
         index_t numEmpty;
         index_t k = getIndexSample(writer.getNumSamples(),
             writer.getTimeSampling(), numSamples,
@@ -201,8 +200,7 @@ void stitchArrayProp(const PropertyHeader & propHeader,
             }
             else if (writer.getNumSamples() == 0)
             {
-                reader.get(dataPtr, 0);
-                writer.set(*dataPtr);
+                writer.setSampleFromReader(reader, 0);
             }
             else
             {
@@ -212,8 +210,7 @@ void stitchArrayProp(const PropertyHeader & propHeader,
 
         for (; k < numSamples; k++)
         {
-            reader.get(dataPtr, k);
-            writer.set(*dataPtr);
+            writer.setSampleFromReader(reader, k);
         }
     }
 
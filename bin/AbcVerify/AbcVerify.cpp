@@ -0,0 +1,130 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//-*****************************************************************************
+// checks the sample data of each archive against the digests stored with it
+int main( int argc, char *argv[] )
+{
+    std::size_t numThreads = 0;
+    std::vector< std::string > files;
+
+    for ( int i = 1; i < argc; ++i )
+    {
+        std::string arg = argv[i];
+        if ( arg == "-t" && i + 1 < argc )
+        {
+            numThreads = std::strtoul( argv[++i], NULL, 10 );
+        }
+        else if ( !arg.empty() && arg[0] == '-' )
+        {
+            files.clear();
+            break;
+        }
+        else
+        {
+            files.push_back( arg );
+        }
+    }
+
+    if ( files.empty() )
+    {
+        std::cerr << "USAGE: " << argv[0]
+                  << " [-t numThreads] <AlembicArchive.abc> ..." << std::endl
+                  << "  Checks that the sample data of each Ogawa archive "
+                  << "matches the digests" << std::endl
+                  << "  stored with it, using one thread per core unless "
+                  << "-t is given." << std::endl;
+        return -1;
+    }
+
+    int status = 0;
+    for ( std::size_t i = 0; i < files.size(); ++i )
+    {
+        std::vector< Alembic::AbcCoreOgawa::VerifyMismatch > mismatches;
+        Alembic::Util::uint64_t numBytes = 0;
+
+        std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+        try
+        {
+            numBytes = Alembic::AbcCoreOgawa::VerifyArchive( files[i],
+                mismatches, numThreads );
+        }
+        catch ( std::exception & e )
+        {
+            std::cout << files[i] << ": ERROR " << e.what() << std::endl;
+            status = 1;
+            continue;
+        }
+
+        double seconds = std::chrono::duration< double >(
+            std::chrono::steady_clock::now() - start ).count();
+
+        for ( std::size_t j = 0; j < mismatches.size(); ++j )
+        {
+            std::cout << files[i] << ": MISMATCH "
+                      << mismatches[j].objectName << " "
+                      << mismatches[j].propertyName << " sample "
+                      << mismatches[j].sampleIndex << std::endl;
+        }
+
+        double megabytes = numBytes / ( 1024.0 * 1024.0 );
+        std::cout << files[i] << ": "
+                  << ( mismatches.empty() ? "OK" : "FAILED" ) << ", "
+                  << megabytes << " MB checked";
+        if ( seconds > 0.0 )
+        {
+            std::cout << " at " << megabytes / seconds << " MB/s";
+        }
+        std::cout << std::endl;
+
+        if ( !mismatches.empty() )
+        {
+            status = 1;
+        }
+    }
+
+    return status;
+}
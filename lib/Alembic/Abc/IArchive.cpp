@@ -41,6 +41,69 @@ namespace Alembic {
 namespace Abc {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+void PrefetchProperties( AbcA::CompoundPropertyReaderPtr iParent,
+                         const ISampleSelector &iFrom,
+                         const ISampleSelector &iTo )
+{
+    for ( size_t i = 0; i < iParent->getNumProperties(); ++i )
+    {
+        const AbcA::PropertyHeader &header = iParent->getPropertyHeader( i );
+        if ( header.isCompound() )
+        {
+            PrefetchProperties(
+                iParent->getCompoundProperty( header.getName() ), iFrom, iTo );
+        }
+        else if ( header.isScalar() )
+        {
+            AbcA::ScalarPropertyReaderPtr prop =
+                iParent->getScalarProperty( header.getName() );
+            index_t numSamples = prop->getNumSamples();
+            if ( numSamples > 0 )
+            {
+                index_t first = iFrom.getIndex( header.getTimeSampling(),
+                                                numSamples );
+                index_t last = iTo.getIndex( header.getTimeSampling(),
+                                             numSamples );
+                prop->prefetch( std::min( first, last ),
+                                std::max( first, last ) );
+            }
+        }
+        else if ( header.isArray() )
+        {
+            AbcA::ArrayPropertyReaderPtr prop =
+                iParent->getArrayProperty( header.getName() );
+            index_t numSamples = prop->getNumSamples();
+            if ( numSamples > 0 )
+            {
+                index_t first = iFrom.getIndex( header.getTimeSampling(),
+                                                numSamples );
+                index_t last = iTo.getIndex( header.getTimeSampling(),
+                                             numSamples );
+                prop->prefetch( std::min( first, last ),
+                                std::max( first, last ) );
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void PrefetchObject( AbcA::ObjectReaderPtr iObject,
+                     const ISampleSelector &iFrom,
+                     const ISampleSelector &iTo )
+{
+    PrefetchProperties( iObject->getProperties(), iFrom, iTo );
+
+    for ( size_t i = 0; i < iObject->getNumChildren(); ++i )
+    {
+        PrefetchObject( iObject->getChild( i ), iFrom, iTo );
+    }
+}
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 IArchive::~IArchive()
 {
@@ -75,6 +138,50 @@ IObject IArchive::getTop() const
     return IObject();
 }
 
+//-*****************************************************************************
+IObject IArchive::getObjectByPath( const std::string &iFullName ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getObjectByPath()" );
+
+    AbcA::ObjectReaderPtr ptr = m_archive->getObjectByPath( iFullName );
+    if ( ptr )
+    {
+        return IObject( ptr );
+    }
+
+    // it may be below an instance, which only IObject knows how to follow
+    IObject obj = getTop();
+    std::size_t start = 0;
+    while ( obj.valid() && start < iFullName.size() )
+    {
+        std::size_t end = iFullName.find( '/', start );
+        if ( end == std::string::npos )
+        {
+            end = iFullName.size();
+        }
+
+        if ( end > start )
+        {
+            std::string name = iFullName.substr( start, end - start );
+            if ( !obj.getChildHeader( name ) )
+            {
+                return IObject();
+            }
+
+            obj = obj.getChild( name );
+        }
+
+        start = end + 1;
+    }
+
+    return obj;
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, so here is a default behavior.
+    return IObject();
+}
+
 //-*****************************************************************************
 AbcA::ReadArraySampleCachePtr IArchive::getReadArraySampleCachePtr()
 {
@@ -152,6 +259,56 @@ void IArchive::setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr )
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void IArchive::prefetch( const ISampleSelector &iFrom,
+                         const ISampleSelector &iTo )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::prefetch" );
+
+    PrefetchObject( m_archive->getTop(), iFrom, iTo );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IArchive::prefetch( const ISampleSelector &iFrom,
+                         const ISampleSelector &iTo,
+                         const IObject &iSubtree )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::prefetch" );
+
+    AbcA::ObjectReaderPtr object = iSubtree.getPtr();
+    if ( object )
+    {
+        PrefetchObject( object, iFrom, iTo );
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+bool IArchive::getReadStatistics( AbcA::ReadStatistics &oStats )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getReadStatistics" );
+
+    return m_archive->getReadStatistics( oStats );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, so here is a default behavior.
+    return false;
+}
+
+//-*****************************************************************************
+void IArchive::resetReadStatistics()
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::resetReadStatistics" );
+
+    m_archive->resetReadStatistics();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Abc
 } // End namespace Alembic
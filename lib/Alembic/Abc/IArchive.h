@@ -41,6 +41,7 @@
 #include <Alembic/Abc/Foundation.h>
 #include <Alembic/Abc/Base.h>
 #include <Alembic/Abc/Argument.h>
+#include <Alembic/Abc/ISampleSelector.h>
 
 namespace Alembic {
 namespace Abc {
@@ -129,6 +130,12 @@ public:
     //! automatically as part of the archive.
     IObject getTop() const;
 
+    //! Returns the object with the given full name, such as "/a/b/c", which
+    //! may be below an instance.  Archives which were written with a path
+    //! index go straight to it, otherwise this walks down from the top.
+    //! The returned object isn't valid if there is no such object.
+    IObject getObjectByPath( const std::string &iFullName ) const;
+
     //! Get the read array sample cache. It may be a NULL pointer.
     //! Caches can be shared amongst separate archives, and caching
     //! will be disabled if a NULL cache is returned here.
@@ -139,6 +146,29 @@ public:
     //! will be disabled if a NULL cache is passed here.
     void setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr );
 
+    //! A hint that the samples from iFrom through iTo of every property
+    //! in the archive are about to be read, say for playing back the next
+    //! few frames, so that the implementation can start getting them off of
+    //! disk.  This doesn't wait for them to be read.
+    void prefetch( const ISampleSelector &iFrom,
+                   const ISampleSelector &iTo );
+
+    //! As above, but only for the properties of iSubtree and everything
+    //! below it.
+    void prefetch( const ISampleSelector &iFrom,
+                   const ISampleSelector &iTo,
+                   const IObject &iSubtree );
+
+    //! Fills in oStats with how much has been read, and how, since the
+    //! archive was opened or the statistics were last reset.  Returns false
+    //! if the archive isn't collecting statistics, see
+    //! AbcCoreFactory::IFactory::setCollectStatistics.
+    bool getReadStatistics( AbcA::ReadStatistics &oStats );
+
+    //! Starts counting the statistics from 0 again, say before loading
+    //! the next frame.
+    void resetReadStatistics();
+
     //-*************************************************************************
     // ABC BASE MECHANISMS
     // These functions are used by Abc to deal with errors, rewrapping,
@@ -154,6 +154,19 @@ void IArrayProperty::getAs( void * oSample,
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void IArrayProperty::getStrings( Util::StringArena & oStrings,
+                                 const ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::getStrings()" );
+
+    m_property->getStrings( iSS.getIndex( m_property->getTimeSampling(),
+                                          m_property->getNumSamples() ),
+                            oStrings );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 bool IArrayProperty::getKey( AbcA::ArraySampleKey& oKey,
                              const ISampleSelector &iSS ) const
@@ -171,6 +184,16 @@ bool IArrayProperty::getKey( AbcA::ArraySampleKey& oKey,
     return false;
 }
 
+//-*****************************************************************************
+void IArrayProperty::getKeyRuns( AbcA::ArraySampleKeyRuns & oRuns ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::getKeyRuns()" );
+
+    m_property->getKeyRuns( oRuns );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void IArrayProperty::getDimensions( Util::Dimensions & oDim,
                                     const ISampleSelector &iSS ) const
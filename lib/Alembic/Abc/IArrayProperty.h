@@ -137,11 +137,22 @@ public:
     void getAs( void *oSample,
                 const ISampleSelector &iSS = ISampleSelector() );
 
+    //! Get a sample of strings into a StringArena, which keeps them all in
+    //! one buffer instead of allocating a std::string for each.
+    //! Only valid on properties of kStringPOD.
+    void getStrings( Util::StringArena & oStrings,
+                     const ISampleSelector &iSS = ISampleSelector() ) const;
+
     //! Get a key from an address of a datum.
     //! ...
     bool getKey( AbcA::ArraySampleKey& oKey,
                  const ISampleSelector &iSS = ISampleSelector() ) const;
 
+    //! Get the keys of all of the samples as runs of consecutive samples
+    //! with the same key, to find which samples change without asking for
+    //! the key of each one.
+    void getKeyRuns( AbcA::ArraySampleKeyRuns & oRuns ) const;
+
     //! Get the dimensions of the datum.
     void getDimensions( Util::Dimensions & oDim,
                         const ISampleSelector &iSS = ISampleSelector() ) const;
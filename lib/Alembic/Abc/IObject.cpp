@@ -192,8 +192,16 @@ AbcA::ObjectReaderPtr objectReaderByName( AbcA::ObjectReaderPtr iObj,
         curPos = 1;
     }
 
-    AbcA::ObjectReaderPtr obj = iObj->getArchive()->getTop();
-    return recurse( obj, iInstanceSource, curPos );
+    // the archive may be able to go straight to it, unless it is below
+    // another instance
+    AbcA::ArchiveReaderPtr archive = iObj->getArchive();
+    AbcA::ObjectReaderPtr obj = archive->getObjectByPath( iInstanceSource );
+    if ( obj )
+    {
+        return obj;
+    }
+
+    return recurse( archive->getTop(), iInstanceSource, curPos );
 }
 
 //-*****************************************************************************
@@ -68,6 +68,8 @@ public:
     //! The explicit constructor creates an archive with the given
     //! file name. Additional arguments that may be passed are the
     //! error handling policy and meta data.
+    //! Options specific to an implementation are set on iCtor itself, for
+    //! example AbcCoreOgawa::WriteArchive::setBufferSize.
     template <class ARCHIVE_CTOR>
     OArchive(
         //! We need to pass in a constructor which provides
@@ -78,6 +78,32 @@ void OArrayProperty::set( const AbcA::ArraySample &iSamp )
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void OArrayProperty::setStrings( const Util::StringArena &iStrings )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArrayProperty::setStrings()" );
+
+    m_property->setStrings( iStrings );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void OArrayProperty::setSampleFromReader( const IArrayProperty &iProp,
+                                          const ISampleSelector &iSS )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArrayProperty::setSampleFromReader()" );
+
+    AbcA::ArrayPropertyReaderPtr reader = iProp.getPtr();
+    ABCA_ASSERT( reader, "Invalid IArrayProperty" );
+
+    index_t index = iSS.getIndex( reader->getTimeSampling(),
+                                  reader->getNumSamples() );
+    m_property->setSampleFromReader( reader, index );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void OArrayProperty::setFromPrevious()
 {
@@ -42,6 +42,7 @@
 #include <Alembic/Abc/Argument.h>
 #include <Alembic/Abc/OBaseProperty.h>
 #include <Alembic/Abc/OCompoundProperty.h>
+#include <Alembic/Abc/IArrayProperty.h>
 
 namespace Alembic {
 namespace Abc {
@@ -111,6 +112,16 @@ public:
     //! ...
     void set( const AbcA::ArraySample &iSample );
 
+    //! Set a sample of strings from a StringArena, without needing a
+    //! std::string for each.  Only valid on properties of kStringPOD.
+    void setStrings( const Util::StringArena &iStrings );
+
+    //! Set a sample to the sample of iProp picked by iSS, which has to be
+    //! of the same DataType.  When both archives are Ogawa archives it is
+    //! copied as it is stored, without decoding it or hashing it again.
+    void setSampleFromReader( const IArrayProperty &iProp,
+                              const ISampleSelector &iSS = ISampleSelector() );
+
     //! Set a sample from the previous sample.
     //! ...
     void setFromPrevious( );
@@ -230,10 +230,49 @@ void scopingTest(bool useOgawa)
     }
 }
 
+void objectByPathTest(bool usePathIndex)
+{
+    {
+        Alembic::AbcCoreOgawa::WriteArchive writer;
+        writer.setPathIndex(usePathIndex);
+        OArchive archive = CreateArchiveWithInfo( writer,
+            "archiveObjectByPathTest.abc", "Alembic test", "", MetaData() );
+
+        OObject childA( archive.getTop(), "a" );
+        OObject childB( childA, "b" );
+        OObject childC( archive.getTop(), "c" );
+        TESTING_ASSERT( childC.addChildInstance( childA, "inst" ) );
+    }
+
+    AbcF::IFactory factory;
+    IArchive archive = factory.getArchive( "archiveObjectByPathTest.abc" );
+
+    IObject obj = archive.getObjectByPath( "/a/b" );
+    TESTING_ASSERT( obj.valid() );
+    TESTING_ASSERT( obj.getFullName() == "/a/b" );
+    TESTING_ASSERT( obj.getParent().getFullName() == "/a" );
+    TESTING_ASSERT( archive.getObjectByPath( "/" ).getFullName() == "/" );
+
+    // instances are followed too
+    obj = archive.getObjectByPath( "/c/inst" );
+    TESTING_ASSERT( obj.valid() && obj.isInstanceRoot() );
+    TESTING_ASSERT( obj.instanceSourcePath() == "/a" );
+
+    obj = archive.getObjectByPath( "/c/inst/b" );
+    TESTING_ASSERT( obj.valid() );
+    TESTING_ASSERT( obj.getFullName() == "/c/inst/b" );
+    TESTING_ASSERT( obj.isInstanceDescendant() );
+
+    TESTING_ASSERT( !archive.getObjectByPath( "/a/x" ).valid() );
+    TESTING_ASSERT( !archive.getObjectByPath( "/c/inst/x" ).valid() );
+}
+
 int main( int argc, char *argv[] )
 {
     archiveInfoTest(true);
     scopingTest(true);
+    objectByPathTest(false);
+    objectByPathTest(true);
 
 #ifdef ALEMBIC_WITH_HDF5
     archiveInfoTest(false);
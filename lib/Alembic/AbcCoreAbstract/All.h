@@ -56,6 +56,7 @@
 #include <Alembic/AbcCoreAbstract/ObjectReader.h>
 #include <Alembic/AbcCoreAbstract/ObjectWriter.h>
 #include <Alembic/AbcCoreAbstract/PropertyHeader.h>
+#include <Alembic/AbcCoreAbstract/ReadStatistics.h>
 #include <Alembic/AbcCoreAbstract/ScalarPropertyReader.h>
 #include <Alembic/AbcCoreAbstract/ScalarPropertyWriter.h>
 #include <Alembic/AbcCoreAbstract/ScalarSample.h>
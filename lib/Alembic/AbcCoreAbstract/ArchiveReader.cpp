@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreAbstract/ArchiveReader.h>
+#include <Alembic/AbcCoreAbstract/ObjectReader.h>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -46,6 +47,44 @@ ArchiveReader::~ArchiveReader()
     // Nothing
 }
 
+//-*****************************************************************************
+bool ArchiveReader::getReadStatistics( ReadStatistics & )
+{
+    return false;
+}
+
+//-*****************************************************************************
+void ArchiveReader::resetReadStatistics()
+{
+    // Nothing
+}
+
+//-*****************************************************************************
+ObjectReaderPtr ArchiveReader::getObjectByPath( const std::string & iFullName )
+{
+    ObjectReaderPtr obj = getTop();
+
+    // skip over the empty names, so "/", "" and "//a" are all fine
+    std::size_t start = 0;
+    while ( obj && start < iFullName.size() )
+    {
+        std::size_t end = iFullName.find( '/', start );
+        if ( end == std::string::npos )
+        {
+            end = iFullName.size();
+        }
+
+        if ( end > start )
+        {
+            obj = obj->getChild( iFullName.substr( start, end - start ) );
+        }
+
+        start = end + 1;
+    }
+
+    return obj;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
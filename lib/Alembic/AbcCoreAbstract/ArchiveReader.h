@@ -41,6 +41,7 @@
 #include <Alembic/AbcCoreAbstract/Foundation.h>
 #include <Alembic/AbcCoreAbstract/ForwardDeclarations.h>
 #include <Alembic/AbcCoreAbstract/ReadArraySampleCache.h>
+#include <Alembic/AbcCoreAbstract/ReadStatistics.h>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -123,6 +124,21 @@ public:
     //! of this archive file.
     virtual int32_t getArchiveVersion() = 0;
 
+    //! Fills in oStats with what has been read since the archive was opened,
+    //! or since resetReadStatistics was last called.  Returns false, leaving
+    //! oStats alone, if statistics aren't being collected, which is the
+    //! default.
+    virtual bool getReadStatistics( ReadStatistics & oStats );
+
+    //! Starts counting the statistics from 0 again.
+    virtual void resetReadStatistics();
+
+    //! Returns the object with the given full name, such as "/a/b/c", or
+    //! an empty pointer if there isn't one.  By default this walks down
+    //! from the top object, but implementations which can get to the object
+    //! directly may do so.
+    virtual ObjectReaderPtr getObjectByPath( const std::string & iFullName );
+
     //! Return self
     //! ...
     virtual ArchiveReaderPtr asArchivePtr() = 0;
@@ -46,6 +46,78 @@ ArrayPropertyReader::~ArrayPropertyReader()
     // Nothing
 }
 
+//-*****************************************************************************
+void ArrayPropertyReader::prefetch( index_t, index_t )
+{
+    // Nothing
+}
+
+//-*****************************************************************************
+void ArrayPropertyReader::getKeyRuns( ArraySampleKeyRuns & oRuns )
+{
+    oRuns.clear();
+
+    index_t numSamples = getNumSamples();
+    for ( index_t i = 0; i < numSamples; ++i )
+    {
+        ArraySampleKeyRun run;
+        getKey( i, run.key );
+
+        if ( !oRuns.empty() && oRuns.back().key == run.key )
+        {
+            oRuns.back().last = i;
+        }
+        else
+        {
+            run.first = i;
+            run.last = i;
+            oRuns.push_back( run );
+        }
+    }
+}
+
+//-*****************************************************************************
+void ArrayPropertyReader::getStrings( index_t iSample,
+                                      Util::StringArena & oStrings )
+{
+    ABCA_ASSERT( getHeader().getDataType().getPod() == kStringPOD,
+                 "getStrings can only be used on properties of strings" );
+
+    ArraySamplePtr sample;
+    getSample( iSample, sample );
+
+    const std::string * strs =
+        static_cast< const std::string * >( sample->getData() );
+    std::size_t numStrs =
+        sample->getDimensions().numPoints() *
+        sample->getDataType().getExtent();
+
+    oStrings.clear();
+    for ( std::size_t i = 0; i < numStrs; ++i )
+    {
+        oStrings.push_back( strs[i] );
+    }
+}
+
+//-*****************************************************************************
+std::future<ArraySamplePtr>
+ArrayPropertyReader::getSampleAsync( index_t iSampleIndex )
+{
+    std::promise<ArraySamplePtr> promise;
+    try
+    {
+        ArraySamplePtr sample;
+        getSample( iSampleIndex, sample );
+        promise.set_value( sample );
+    }
+    catch ( ... )
+    {
+        promise.set_exception( std::current_exception() );
+    }
+
+    return promise.get_future();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
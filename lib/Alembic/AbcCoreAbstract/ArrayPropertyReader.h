@@ -42,10 +42,26 @@
 #include <Alembic/AbcCoreAbstract/BasePropertyReader.h>
 #include <Alembic/AbcCoreAbstract/ArraySample.h>
 
+#include <future>
+
 namespace Alembic {
 namespace AbcCoreAbstract {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+//! A run of consecutive samples which all have the same key, from
+//! ArrayPropertyReader::getKeyRuns.
+struct ArraySampleKeyRun
+{
+    ArraySampleKey key;
+
+    //! the first and last samples in the run, last included
+    index_t first;
+    index_t last;
+};
+
+typedef std::vector< ArraySampleKeyRun > ArraySampleKeyRuns;
+
 //-*****************************************************************************
 //! An Array Property is a Rank N (usually 1-3) property which has a
 //! multidimensional array of identically typed values for each
@@ -112,6 +128,14 @@ public:
     //! Expose the key for apps that use their own custom cache management.
     virtual bool getKey( index_t iSampleIndex, ArraySampleKey & oKey ) = 0;
 
+    //! The keys of all of the samples at once, as runs of consecutive
+    //! samples with the same key, so finding which samples actually change
+    //! doesn't take a call to getKey for each of them.  The runs cover every
+    //! sample in order, and there are none if there are no samples.
+    //! Implementations should get the keys without reading the sample data.
+    //! The default calls getKey for each sample.
+    virtual void getKeyRuns( ArraySampleKeyRuns & oRuns );
+
     //! The ArraySample may have incorrect dimensions, (even though the packed
     //! data will be correct) expose the correct dimensions here for those
     //! clients that need it.
@@ -141,6 +165,25 @@ public:
     //! and std::wstring as core language-level primitives.
     virtual void getAs( index_t iSample, void *iIntoLocation,
                         PlainOldDataType iPod ) = 0;
+
+    //! Reads a sample of a property of kStringPOD into oStrings, which is
+    //! cleared first, without making a std::string for each element.
+    //! Reading into the same StringArena sample after sample reuses its
+    //! memory.  The default goes through getSample.
+    virtual void getStrings( index_t iSample, Util::StringArena & oStrings );
+
+    //! A hint that the samples from iFirstSample through iLastSample
+    //! will be read soon, so that implementations can start getting them
+    //! off of disk ahead of time.  It doesn't wait for them to be read.
+    //! Indices out of range are clamped.  The default does nothing.
+    virtual void prefetch( index_t iFirstSample, index_t iLastSample );
+
+    //! Reads the requested sample like getSample does, but without waiting
+    //! for it, so that many reads can be in flight from a single thread.
+    //! The future holds the sample, or the exception getSample would have
+    //! thrown.  The default reads it right away and returns a future which
+    //! is already ready.
+    virtual std::future<ArraySamplePtr> getSampleAsync( index_t iSampleIndex );
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreAbstract/ArrayPropertyWriter.h>
+#include <Alembic/AbcCoreAbstract/ArrayPropertyReader.h>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -46,6 +47,44 @@ ArrayPropertyWriter::~ArrayPropertyWriter()
     // Nothing
 }
 
+//-*****************************************************************************
+void ArrayPropertyWriter::setStrings( const Util::StringArena & iStrings )
+{
+    const DataType & dataType = getHeader().getDataType();
+    ABCA_ASSERT( dataType.getPod() == kStringPOD,
+                 "setStrings can only be used on properties of strings" );
+
+    ABCA_ASSERT( iStrings.size() % dataType.getExtent() == 0,
+                 "The number of strings: " << iStrings.size() <<
+                 " isn't a multiple of the extent: " <<
+                 ( int ) dataType.getExtent() );
+
+    std::vector< std::string > strs( iStrings.size() );
+    for ( std::size_t i = 0; i < strs.size(); ++i )
+    {
+        strs[i] = iStrings[i].str();
+    }
+
+    setSample( ArraySample( strs.empty() ? NULL : &strs.front(), dataType,
+        Dimensions( strs.size() / dataType.getExtent() ) ) );
+}
+
+//-*****************************************************************************
+void ArrayPropertyWriter::setSampleFromReader( ArrayPropertyReaderPtr iReader,
+                                               index_t iSampleIndex )
+{
+    ABCA_ASSERT( iReader, "Invalid ArrayPropertyReader" );
+
+    ABCA_ASSERT( iReader->getDataType() == getHeader().getDataType(),
+                 "DataType of the reader: " << iReader->getDataType() <<
+                 ", does not match the DataType of the Array property: " <<
+                 getHeader().getDataType() );
+
+    ArraySamplePtr samp;
+    iReader->getSample( iSampleIndex, samp );
+    setSample( *samp );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
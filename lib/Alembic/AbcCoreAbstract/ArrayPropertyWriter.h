@@ -75,6 +75,20 @@ public:
     //! treated just like regular data elements.
     virtual void setSample( const ArraySample & iSamp ) = 0;
 
+    //! Sets a sample of a property of kStringPOD from the strings in
+    //! iStrings, without needing a std::string for each element.  The
+    //! number of strings has to be a multiple of the extent.  The default
+    //! goes through setSample.
+    virtual void setStrings( const Util::StringArena & iStrings );
+
+    //! Sets the next sample to sample iSampleIndex of iReader, which has to
+    //! have the same DataType.  Implementations which know how iReader
+    //! stores its samples may copy the sample as it is stored, key
+    //! included, without decoding it or hashing it again.  The default reads
+    //! it via getSample and goes through setSample.
+    virtual void setSampleFromReader( ArrayPropertyReaderPtr iReader,
+                                      index_t iSampleIndex );
+
     //! Set the next sample to equal the previous sample.
     //! An important feature!
     virtual void setFromPreviousSample() = 0;
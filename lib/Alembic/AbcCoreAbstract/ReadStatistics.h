@@ -0,0 +1,101 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreAbstract_ReadStatistics_h
+#define Alembic_AbcCoreAbstract_ReadStatistics_h
+
+#include <Alembic/AbcCoreAbstract/Foundation.h>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! What an ArchiveReader has done since it started collecting statistics,
+//! to tell whether reading is bound by I/O, header parsing or converting
+//! the data.  Implementations fill in what applies to them and leave the
+//! rest at 0.
+struct ReadStatistics
+{
+    //! The reads done through one of the archive's streams.
+    struct Stream
+    {
+        Stream() : numReads( 0 ), numBytes( 0 ), nanoseconds( 0 ) {}
+
+        uint64_t numReads;
+        uint64_t numBytes;
+
+        //! time spent waiting on the reads, or copying out of the
+        //! memory mapping
+        uint64_t nanoseconds;
+    };
+
+    ReadStatistics()
+      : numObjectHeaders( 0 )
+      , numPropertyHeaders( 0 )
+      , numArraySamples( 0 )
+      , numScalarSamples( 0 )
+      , numPodConversions( 0 )
+      , numCacheHits( 0 )
+      , numCacheMisses( 0 )
+    {}
+
+    std::vector< Stream > streams;
+
+    //! headers parsed, each object and property header is only parsed once
+    uint64_t numObjectHeaders;
+    uint64_t numPropertyHeaders;
+
+    //! samples decoded, array samples found in the cache aren't counted
+    uint64_t numArraySamples;
+    uint64_t numScalarSamples;
+
+    //! samples read as a different POD than they were written as
+    uint64_t numPodConversions;
+
+    //! array samples found, and not found, in the read array sample cache
+    uint64_t numCacheHits;
+    uint64_t numCacheMisses;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
+
+#endif
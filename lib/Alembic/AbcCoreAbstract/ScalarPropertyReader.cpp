@@ -46,6 +46,30 @@ ScalarPropertyReader::~ScalarPropertyReader()
     // Nothing
 }
 
+//-*****************************************************************************
+void ScalarPropertyReader::prefetch( index_t, index_t )
+{
+    // Nothing
+}
+
+//-*****************************************************************************
+std::future<void>
+ScalarPropertyReader::getSampleAsync( index_t iSample, void *iIntoLocation )
+{
+    std::promise<void> promise;
+    try
+    {
+        getSample( iSample, iIntoLocation );
+        promise.set_value();
+    }
+    catch ( ... )
+    {
+        promise.set_exception( std::current_exception() );
+    }
+
+    return promise.get_future();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
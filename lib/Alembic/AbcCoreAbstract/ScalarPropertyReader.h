@@ -41,6 +41,8 @@
 #include <Alembic/AbcCoreAbstract/Foundation.h>
 #include <Alembic/AbcCoreAbstract/BasePropertyReader.h>
 
+#include <future>
+
 namespace Alembic {
 namespace AbcCoreAbstract {
 namespace ALEMBIC_VERSION_NS {
@@ -106,6 +108,20 @@ public:
     //! Find the valid index with the closest time to the given
     //! time. Invalid to call this with zero samples.
     virtual std::pair<index_t, chrono_t> getNearIndex( chrono_t iTime ) = 0;
+
+    //! A hint that the samples from iFirstSample through iLastSample
+    //! will be read soon, so that implementations can start getting them
+    //! off of disk ahead of time.  It doesn't wait for them to be read.
+    //! Indices out of range are clamped.  The default does nothing.
+    virtual void prefetch( index_t iFirstSample, index_t iLastSample );
+
+    //! Reads the requested sample into iIntoLocation like getSample does,
+    //! but without waiting for it.  iIntoLocation has to stay valid until
+    //! the future is ready, and the future holds the exception getSample
+    //! would have thrown, if any.  The default reads it right away and
+    //! returns a future which is already ready.
+    virtual std::future<void> getSampleAsync( index_t iSample,
+                                              void *iIntoLocation );
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -38,6 +38,7 @@
 #include <Alembic/AbcCoreOgawa/All.h>
 #include <Alembic/AbcCoreLayer/Read.h>
 #include <Alembic/AbcCoreFactory/IFactory.h>
+#include <Alembic/Ogawa/IStreams.h>
 
 #ifdef ALEMBIC_WITH_HDF5
 #include <Alembic/AbcCoreHDF5/All.h>
@@ -52,6 +53,11 @@ IFactory::IFactory()
     m_cacheHierarchy = true;
     m_numStreams = 1;
     m_readStrategy = kMemoryMappedFiles;
+    m_zeroCopy = false;
+    m_numReadThreads = 8;
+    m_collectStatistics = false;
+    m_preloadHierarchy = false;
+    m_shareFiles = false;
     m_policy = Alembic::Abc::ErrorHandler::kThrowPolicy;
 }
 
@@ -59,6 +65,16 @@ IFactory::~IFactory()
 {
 }
 
+void IFactory::setOgawaMaxOpenFiles( size_t iMaxOpenFiles )
+{
+    Alembic::Ogawa::IStreams::setMaxOpenFiles( iMaxOpenFiles );
+}
+
+size_t IFactory::getOgawaMaxOpenFiles()
+{
+    return Alembic::Ogawa::IStreams::getMaxOpenFiles();
+}
+
 Alembic::Abc::IArchive IFactory::getArchive( const std::string & iFileName,
                                              CoreType & oType )
 {
@@ -67,6 +83,11 @@ Alembic::Abc::IArchive IFactory::getArchive( const std::string & iFileName,
     Alembic::AbcCoreOgawa::ReadArchive ogawa(
         m_numStreams,
         m_readStrategy == kMemoryMappedFiles);
+    ogawa.setZeroCopy( m_zeroCopy );
+    ogawa.setNumReadThreads( m_numReadThreads );
+    ogawa.setCollectStatistics( m_collectStatistics );
+    ogawa.setPreloadHierarchy( m_preloadHierarchy );
+    ogawa.setShareFiles( m_shareFiles );
     Alembic::Abc::IArchive archive( ogawa, iFileName,
         Alembic::Abc::ErrorHandler::kQuietNoopPolicy, m_cachePtr );
 
@@ -167,6 +188,9 @@ Alembic::Abc::IArchive IFactory::getArchive(
 {
     // Ogawa is the only one which can do this
     Alembic::AbcCoreOgawa::ReadArchive ogawa( iStreams );
+    ogawa.setNumReadThreads( m_numReadThreads );
+    ogawa.setCollectStatistics( m_collectStatistics );
+    ogawa.setPreloadHierarchy( m_preloadHierarchy );
     Alembic::Abc::IArchive archive( ogawa, "", m_policy, m_cachePtr );
     if ( archive.valid() )
     {
@@ -99,7 +99,8 @@ public:
     //! Gets whether an HDF5 file will use the cached hierarchy
     bool getHDF5CacheHierarchy() const { return m_cacheHierarchy; }
 
-    //! Set the array sample cache, the HDF5 implementation optionally uses this
+    //! Set the array sample cache, both implementations use this if set
+    //! (see AbcCoreOgawa::CreateCache)
     void setSampleCache(
         Alembic::AbcCoreAbstract::ReadArraySampleCachePtr iCachePtr )
     {
@@ -139,6 +140,66 @@ public:
         m_readStrategy = iStrategy;
     }
 
+    //! Gets whether array samples read from memory mapped Ogawa files may
+    //! point directly into the mapping.
+    bool getOgawaZeroCopy() const { return m_zeroCopy; }
+
+    //! Sets whether array samples read from memory mapped Ogawa files may
+    //! point directly into the mapping instead of being copied, the default
+    //! is false.  Only used with kMemoryMappedFiles, and only for non-string
+    //! data which is suitably aligned in the file.
+    void setOgawaZeroCopy( bool iZeroCopy ) { m_zeroCopy = iZeroCopy; }
+
+    //! Gets the number of threads an Ogawa archive uses for getSampleAsync.
+    size_t getOgawaNumReadThreads() const { return m_numReadThreads; }
+
+    //! Sets the number of threads an Ogawa archive starts to read samples
+    //! asked for via getSampleAsync, the default is 8.  With 0 they are
+    //! read on the calling thread.
+    void setOgawaNumReadThreads( size_t iNumReadThreads )
+    {
+        m_numReadThreads = iNumReadThreads;
+    }
+
+    //! Gets whether opened archives collect read statistics.
+    bool getCollectStatistics() const { return m_collectStatistics; }
+
+    //! Sets whether opened archives count what they read, see
+    //! Abc::IArchive::getReadStatistics.  The default is false.  Currently
+    //! only Ogawa archives collect statistics.
+    void setCollectStatistics( bool iCollectStatistics )
+    {
+        m_collectStatistics = iCollectStatistics;
+    }
+
+    //! Gets whether Ogawa archives read their whole hierarchy when opened.
+    bool getOgawaPreloadHierarchy() const { return m_preloadHierarchy; }
+
+    //! Sets whether Ogawa archives read the headers of all their objects and
+    //! compound properties when they are opened, on the read threads (see
+    //! setOgawaNumReadThreads), instead of as each is first asked for.
+    //! The default is false.
+    void setOgawaPreloadHierarchy( bool iPreloadHierarchy )
+    {
+        m_preloadHierarchy = iPreloadHierarchy;
+    }
+
+    //! Gets whether Ogawa archives share open files with each other.
+    bool getOgawaShareFiles() const { return m_shareFiles; }
+
+    //! Sets whether Ogawa archives opened by this factory read through the
+    //! same open file, or memory mapping, as any other archive opened this
+    //! way which reads the same file, so a file opened many times only
+    //! uses one descriptor or mapping.  The default is false.
+    void setOgawaShareFiles( bool iShareFiles ) { m_shareFiles = iShareFiles; }
+
+    //! Sets the most files the shared Ogawa archives read with file streams
+    //! keep open at once, across the whole process.  Past that the least
+    //! recently read ones are closed, and opened again when next read.
+    //! Memory mapped files don't keep one open.  0, the default, is no limit.
+    static void setOgawaMaxOpenFiles( size_t iMaxOpenFiles );
+    static size_t getOgawaMaxOpenFiles();
+
 
     //! Gets the error handler policy
     Alembic::Abc::ErrorHandler::Policy getPolicy() { return m_policy; }
@@ -153,6 +214,11 @@ private:
     bool m_cacheHierarchy;
     size_t m_numStreams;
     OgawaReadStrategy m_readStrategy;
+    bool m_zeroCopy;
+    size_t m_numReadThreads;
+    bool m_collectStatistics;
+    bool m_preloadHierarchy;
+    bool m_shareFiles;
     Alembic::AbcCoreAbstract::ReadArraySampleCachePtr m_cachePtr;
     Alembic::Abc::ErrorHandler::Policy m_policy;
 
@@ -137,9 +137,15 @@ const AbcA::MetaData & ArImpl::getMetaData() const
 //-*****************************************************************************
 AbcA::ObjectReaderPtr ArImpl::getTop()
 {
+    AbcA::ObjectReaderPtr ret = m_top.lock();
+    if ( ret )
+    {
+        return ret;
+    }
+
     Alembic::Util::scoped_lock l( m_lock );
 
-    AbcA::ObjectReaderPtr ret = m_top.lock();
+    ret = m_top.lock();
     if ( ! ret )
     {
         // time to make a new one
@@ -153,7 +159,7 @@ AbcA::ObjectReaderPtr ArImpl::getTop()
 
         ret = Alembic::Util::shared_ptr<OrImpl>(
         new OrImpl( shared_from_this(), tops, m_header ) );
-        m_top = ret;
+        m_top.store( ret );
     }
 
     return ret;
@@ -90,7 +90,7 @@ private:
 
     ArchiveReaderPtrs m_archives;
 
-    Alembic::Util::weak_ptr< AbcA::ObjectReader > m_top;
+    Alembic::Util::AtomicWeakPtr< AbcA::ObjectReader > m_top;
     Alembic::Util::mutex m_lock;
 
     std::vector <  AbcA::TimeSamplingPtr > m_timeSamples;
@@ -143,13 +143,13 @@ const AbcA::PropertyHeader *
 CprImpl::getPropertyHeader( const std::string &iName )
 {
 
-    ChildNameMap::iterator itr = m_childNameMap.find( iName );
+    size_t index = 0;
 
-    if( itr !=  m_childNameMap.end() )
+    if( m_childNameMap.find( iName, index ) )
     {
-        return &( m_children[ itr->second ][
-            m_childHeaderIndex[ itr->second ].first ]->getPropertyHeader(
-                m_childHeaderIndex[ itr->second ].second ) );
+        return &( m_children[ index ][
+            m_childHeaderIndex[ index ].first ]->getPropertyHeader(
+                m_childHeaderIndex[ index ].second ) );
     }
 
     return 0;
@@ -159,12 +159,11 @@ CprImpl::getPropertyHeader( const std::string &iName )
 AbcA::ScalarPropertyReaderPtr
 CprImpl::getScalarProperty( const std::string &iName )
 {
-    ChildNameMap::iterator itr = m_childNameMap.find( iName );
+    size_t index = 0;
 
-    if( itr != m_childNameMap.end() )
+    if( m_childNameMap.find( iName, index ) )
     {
-        return m_children[ itr->second ].back()->getScalarProperty(
-            itr->first );
+        return m_children[ index ].back()->getScalarProperty( iName );
     }
 
     return AbcA::ScalarPropertyReaderPtr();
@@ -174,11 +173,11 @@ CprImpl::getScalarProperty( const std::string &iName )
 AbcA::ArrayPropertyReaderPtr
 CprImpl::getArrayProperty( const std::string &iName )
 {
-    ChildNameMap::iterator itr = m_childNameMap.find( iName );
+    size_t index = 0;
 
-    if( itr != m_childNameMap.end() )
+    if( m_childNameMap.find( iName, index ) )
     {
-        return m_children[ itr->second ].back()->getArrayProperty( itr->first );
+        return m_children[ index ].back()->getArrayProperty( iName );
     }
 
     return AbcA::ArrayPropertyReaderPtr();
@@ -188,11 +187,11 @@ CprImpl::getArrayProperty( const std::string &iName )
 AbcA::CompoundPropertyReaderPtr
 CprImpl::getCompoundProperty( const std::string &iName )
 {
-    ChildNameMap::iterator itr = m_childNameMap.find( iName );
+    size_t index = 0;
 
-    if( itr != m_childNameMap.end() )
+    if( m_childNameMap.find( iName, index ) )
     {
-        return CprImplPtr( new CprImpl( shared_from_this(), itr->second ) );
+        return CprImplPtr( new CprImpl( shared_from_this(), index ) );
     }
 
     return AbcA::CompoundPropertyReaderPtr();
@@ -217,11 +216,12 @@ void CprImpl::init( CompoundReaderPtrs & iCompounds )
             bool shouldReplace =
                 ( propHeader.getMetaData().get( "replace" ) == "1" );
 
-            ChildNameMap::iterator nameIt = m_childNameMap.find(
-                propHeader.getName() );
+            size_t foundIndex = 0;
+            bool found = m_childNameMap.find( propHeader.getName(),
+                                              foundIndex );
 
             // brand new child, add it (if not a prune) and continue
-            if ( nameIt == m_childNameMap.end() )
+            if ( !found )
             {
                 // new prop that was marked for pruning, so skip
                 if ( shouldPrune )
@@ -230,7 +230,7 @@ void CprImpl::init( CompoundReaderPtrs & iCompounds )
                 }
 
                 size_t index = m_childNameMap.size();
-                m_childNameMap[ propHeader.getName() ] = index;
+                m_childNameMap.set( propHeader.getName(), index );
 
                 m_children.resize( index + 1 );
                 m_children[ index ].push_back( *it );
@@ -240,35 +240,28 @@ void CprImpl::init( CompoundReaderPtrs & iCompounds )
             // prune
             else if ( shouldPrune )
             {
-                size_t index = nameIt->second;
+                size_t index = foundIndex;
 
                 // prune, time to clear out existing data
                 m_children.erase( m_children.begin() + index );
                 m_childHeaderIndex.erase( m_childHeaderIndex.begin() + index );
-                m_childNameMap.erase( nameIt );
 
-                // since we removed an element, update the indices in our map
-                for ( nameIt = m_childNameMap.begin();
-                      nameIt != m_childNameMap.end(); ++nameIt )
-                {
-                    if ( nameIt->second > index )
-                    {
-                        nameIt->second --;
-                    }
-                }
+                // since we removed an element, this updates the indices in
+                // our map too
+                m_childNameMap.eraseAndShift( propHeader.getName() );
 
             }
             // only add this onto an existing one IF its a compound and the
             // prop added previously is a compound
             else if ( propHeader.isCompound() &&
-                      m_children[ nameIt->second ][ m_childHeaderIndex[
-                            nameIt->second ].first ]->getPropertyHeader(
-                                m_childHeaderIndex[ nameIt->second ].second
+                      m_children[ foundIndex ][ m_childHeaderIndex[
+                            foundIndex ].first ]->getPropertyHeader(
+                                m_childHeaderIndex[ foundIndex ].second
                             ).isCompound() )
             {
                 // add parent and index to the existing child element, and then
                 // update the MetaData
-                size_t index = nameIt->second;
+                size_t index = foundIndex;
 
                 if ( shouldReplace )
                 {
@@ -291,7 +284,7 @@ void CprImpl::init( CompoundReaderPtrs & iCompounds )
             // type is different
             else
             {
-                size_t index = nameIt->second;
+                size_t index = foundIndex;
                 m_children[ index ].clear();
                 m_children[ index ].push_back( *it );
                 m_childHeaderIndex[ index ].first = 0;
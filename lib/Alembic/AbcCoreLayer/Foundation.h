@@ -46,7 +46,7 @@ namespace ALEMBIC_VERSION_NS {
 
 namespace AbcA = ::Alembic::AbcCoreAbstract;
 
-typedef std::map< std::string, size_t > ChildNameMap;
+typedef Alembic::Util::NameIndex ChildNameMap;
 
 class ArImpl;
 typedef Alembic::Util::shared_ptr< ArImpl > ArImplPtr;
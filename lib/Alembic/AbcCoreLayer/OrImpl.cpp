@@ -112,13 +112,19 @@ AbcA::ObjectReaderPtr OrImpl::getParent()
 //-*****************************************************************************
 AbcA::CompoundPropertyReaderPtr OrImpl::getProperties()
 {
-    Alembic::Util::scoped_lock l( m_lock );
     AbcA::CompoundPropertyReaderPtr ret = m_top.lock();
+    if ( ret )
+    {
+        return ret;
+    }
+
+    Alembic::Util::scoped_lock l( m_lock );
+    ret = m_top.lock();
     if ( ! ret )
     {
         ret = Alembic::Util::shared_ptr<CprImpl>(
             new CprImpl( shared_from_this(), m_properties ) );
-        m_top = ret;
+        m_top.store( ret );
     }
 
     return ret;
@@ -142,11 +148,11 @@ const AbcA::ObjectHeader & OrImpl::getChildHeader( size_t i )
 //-*****************************************************************************
 const AbcA::ObjectHeader * OrImpl::getChildHeader( const std::string &iName )
 {
-    ChildNameMap::iterator findChildItr = m_childNameMap.find( iName );
+    size_t index = 0;
 
-    if( findChildItr != m_childNameMap.end() )
+    if( m_childNameMap.find( iName, index ) )
     {
-        return m_childHeaders[ findChildItr->second ].get();
+        return m_childHeaders[ index ].get();
     }
 
     return 0;
@@ -155,22 +161,11 @@ const AbcA::ObjectHeader * OrImpl::getChildHeader( const std::string &iName )
 //-*****************************************************************************
 AbcA::ObjectReaderPtr OrImpl::getChild( const std::string &iName )
 {
-    ChildNameMap::iterator findChildItr = m_childNameMap.find( iName );
+    size_t index = 0;
 
-    if( findChildItr != m_childNameMap.end() )
+    if( m_childNameMap.find( iName, index ) )
     {
-        Alembic::Util::scoped_lock l( m_lock );
-
-        AbcA::ObjectReaderPtr ret =
-            m_children_ptrs[ findChildItr->second ].lock();
-
-        if ( ! ret )
-        {
-            ret = Alembic::Util::shared_ptr<OrImpl>(
-                new OrImpl( shared_from_this(), findChildItr->second ) );
-            m_children_ptrs[ findChildItr->second ] = ret;
-        }
-        return ret;
+        return getChild( index );
     }
 
     return AbcA::ObjectReaderPtr();
@@ -180,14 +175,21 @@ AbcA::ObjectReaderPtr OrImpl::getChild( size_t i )
 {
     if ( i < m_childHeaders.size() )
     {
+        // usually it has already been made
+        AbcA::ObjectReaderPtr ret = m_children_ptrs[i].lock();
+        if ( ret )
+        {
+            return ret;
+        }
+
         Alembic::Util::scoped_lock l( m_lock );
 
-        AbcA::ObjectReaderPtr ret = m_children_ptrs[i].lock();
+        ret = m_children_ptrs[i].lock();
         if ( ! ret )
         {
             ret = Alembic::Util::shared_ptr<OrImpl>(
                 new OrImpl( shared_from_this(), i ) );
-            m_children_ptrs[i] = ret;
+            m_children_ptrs[i].store( ret );
         }
         return ret;
     }
@@ -266,18 +268,15 @@ void OrImpl::init( std::vector< AbcA::ObjectReaderPtr > & iObjects )
             bool shouldReplace =
                 ( objHeader.getMetaData().get( "replace" ) == "1" );
 
-            ChildNameMap::iterator nameIt = m_childNameMap.find(
-                objHeader.getName() );
-
             size_t index = 0;
 
             // brand new child, add it (if not pruning) and continue
-            if ( nameIt == m_childNameMap.end() )
+            if ( !m_childNameMap.find( objHeader.getName(), index ) )
             {
                 if ( !shouldPrune )
                 {
                     index = m_childNameMap.size();
-                    m_childNameMap[ objHeader.getName() ] = index;
+                    m_childNameMap.set( objHeader.getName(), index );
                     ObjectHeaderPtr headerPtr(
                         new AbcA::ObjectHeader( objHeader ) );
                     m_childHeaders.push_back( headerPtr );
@@ -289,8 +288,6 @@ void OrImpl::init( std::vector< AbcA::ObjectReaderPtr > & iObjects )
                 continue;
             }
 
-            index = nameIt->second;
-
             // no prune, so add to existing data
             if ( !shouldPrune )
             {
@@ -314,17 +311,10 @@ void OrImpl::init( std::vector< AbcA::ObjectReaderPtr > & iObjects )
             m_children.erase( m_children.begin() + index );
             m_children_ptrs.erase( m_children_ptrs.begin() + index );
             m_childHeaders.erase( m_childHeaders.begin() + index );
-            m_childNameMap.erase( nameIt );
 
-            // since we removed an element, update the indices in our name map
-            for ( nameIt = m_childNameMap.begin();
-                  nameIt != m_childNameMap.end(); ++nameIt )
-            {
-                if ( nameIt->second > index )
-                {
-                    nameIt->second --;
-                }
-            }
+            // since we removed an element, this updates the indices in our
+            // name map too
+            m_childNameMap.eraseAndShift( objHeader.getName() );
         }
     }
 }
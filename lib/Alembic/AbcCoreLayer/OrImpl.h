@@ -112,12 +112,13 @@ private:
     // each child is made up of the original parent objects and the index
     // in each of them where that child lives
     std::vector< std::vector< ObjectAndIndex > > m_children;
-    std::vector< Alembic::Util::weak_ptr< AbcA::ObjectReader > > m_children_ptrs;
+    std::vector< Alembic::Util::AtomicWeakPtr< AbcA::ObjectReader > >
+        m_children_ptrs;
     Alembic::Util::mutex m_lock;
 
     // all of our top properties, will be combined into m_top
     std::vector< AbcA::CompoundPropertyReaderPtr > m_properties;
-    Alembic::Util::weak_ptr< AbcA::CompoundPropertyReader > m_top;
+    Alembic::Util::AtomicWeakPtr< AbcA::CompoundPropertyReader > m_top;
 
     ChildNameMap m_childNameMap;
 };
@@ -43,6 +43,46 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+// reads one sample on a read thread, keeping the property alive until then
+class SampleTask : public ReadThreadPool::Task
+{
+public:
+    SampleTask( AbcA::ArrayPropertyReaderPtr iProperty, index_t iSampleIndex )
+      : m_property( iProperty )
+      , m_sampleIndex( iSampleIndex )
+    {
+    }
+
+    virtual void run()
+    {
+        try
+        {
+            AbcA::ArraySamplePtr sample;
+            m_property->getSample( m_sampleIndex, sample );
+            m_promise.set_value( sample );
+        }
+        catch ( ... )
+        {
+            m_promise.set_exception( std::current_exception() );
+        }
+    }
+
+    std::future<AbcA::ArraySamplePtr> getFuture()
+    {
+        return m_promise.get_future();
+    }
+
+private:
+    AbcA::ArrayPropertyReaderPtr m_property;
+    index_t m_sampleIndex;
+    std::promise<AbcA::ArraySamplePtr> m_promise;
+};
+
+}
+
 //-*****************************************************************************
 AprImpl::AprImpl( AbcA::CompoundPropertyReaderPtr iParent,
                   Ogawa::IGroupPtr iGroup,
@@ -50,12 +90,17 @@ AprImpl::AprImpl( AbcA::CompoundPropertyReaderPtr iParent,
   : m_parent( iParent )
   , m_group( iGroup )
   , m_header( iHeader )
+  , m_archive( NULL )
 {
     // Validate all inputs.
     ABCA_ASSERT( m_parent, "Invalid parent" );
     ABCA_ASSERT( m_group, "Invalid array property group" );
     ABCA_ASSERT( m_header, "Invalid header" );
 
+    m_archive = dynamic_cast< ArImpl * >(
+        m_parent->getObject()->getArchive().get() );
+    ABCA_ASSERT( m_archive, "Invalid archive" );
+
     if ( m_header->header.getPropertyType() != AbcA::kArrayProperty )
     {
         ABCA_THROW( "Attempted to create a ArrayPropertyReader from a "
@@ -104,14 +149,57 @@ void AprImpl::getSample( index_t iSampleIndex, AbcA::ArraySamplePtr &oSample )
 {
     size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+    StreamLease stream( m_archive->getStreamManager() );
+    std::size_t id = stream.getID();
+
+    // the data is followed by its dimensions, get them together
+    Ogawa::IDataHandle datas[2];
+    m_group->getData( index, 2, id, datas );
+    const Ogawa::IDataHandle & data = datas[0];
+    const Ogawa::IDataHandle & dims = datas[1];
+
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+
+    AbcA::ReadArraySampleCachePtr cachePtr =
+        m_archive->getReadArraySampleCachePtr();
+
+    AbcA::ArraySampleKey key;
+    if ( cachePtr )
+    {
+        key.readPOD = dataType.getPod();
+        key.origPOD = key.readPOD;
+        key.numBytes = 0;
+
+        Util::uint64_t dataSize = ReadDataSize( data, id );
+        if ( dataSize >= 16 )
+        {
+            key.numBytes = dataSize - 16;
+            data.read( 16, key.digest.d, 0, id );
+        }
 
-    std::size_t id = streamId->getID();
-    Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
-    Ogawa::IDataPtr data = m_group->getData(index, id);
+        // the same bytes could have been read with a different shape
+        // by another property, so make sure that matches too
+        AbcA::ReadArraySampleID found = cachePtr->find( key );
+        if ( found && found.getSample()->getDataType() == dataType &&
+             MatchDimensions( dims, data, id, dataType,
+                              found.getSample()->getDimensions() ) )
+        {
+            m_archive->count( ArImpl::kCacheHits );
+            oSample = found.getSample();
+            return;
+        }
+
+        m_archive->count( ArImpl::kCacheMisses );
+    }
 
-    ReadArraySample( dims, data, id, m_header->header.getDataType(), oSample );
+    ReadArraySample( dims, data, id, dataType, oSample,
+                     m_archive->useZeroCopy() );
+    m_archive->count( ArImpl::kArraySamples );
+
+    if ( cachePtr )
+    {
+        cachePtr->store( key, oSample );
+    }
 }
 
 //-*****************************************************************************
@@ -135,6 +223,19 @@ std::pair<index_t, chrono_t> AprImpl::getNearIndex( chrono_t iTime )
         m_header->nextSampleIndex );
 }
 
+//-*****************************************************************************
+// the key is kept at the start of the data, which the handle already has
+static void ReadKey( const Ogawa::IDataHandle & iData, std::size_t iThreadId,
+                     AbcA::ArraySampleKey & ioKey )
+{
+    Util::uint64_t dataSize = ReadDataSize( iData, iThreadId );
+    if ( dataSize >= 16 )
+    {
+        ioKey.numBytes = dataSize - 16;
+        iData.read( 16, ioKey.digest.d, 0, iThreadId );
+    }
+}
+
 //-*****************************************************************************
 bool AprImpl::getKey( index_t iSampleIndex, AbcA::ArraySampleKey & oKey )
 {
@@ -145,26 +246,106 @@ bool AprImpl::getKey( index_t iSampleIndex, AbcA::ArraySampleKey & oKey )
     // * 2 for Array properties (since we also write the dimensions)
     size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+    StreamLease stream( m_archive->getStreamManager() );
+    std::size_t id = stream.getID();
 
-    std::size_t id = streamId->getID();
-    Ogawa::IDataPtr data = m_group->getData( index, id );
-
-    if ( data )
+    Ogawa::IDataHandle data;
+    if ( m_group->getData( index, id, data ) )
     {
-        if ( data->getSize() >= 16 )
-        {
-            oKey.numBytes = data->getSize() - 16;
-            data->read( 16, oKey.digest.d, 0, id );
-        }
-
+        ReadKey( data, id, oKey );
         return true;
     }
 
     return false;
 }
 
+//-*****************************************************************************
+void AprImpl::readStoredData( index_t iSampleIndex,
+                              std::vector< char > & oData,
+                              bool & oCompressed )
+{
+    size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
+
+    StreamLease stream( m_archive->getStreamManager() );
+    std::size_t id = stream.getID();
+
+    oData.clear();
+    oCompressed = false;
+
+    Ogawa::IDataHandle data;
+    if ( m_group->getData( index, id, data ) && data.getSize() != 0 )
+    {
+        oData.resize( data.getSize() );
+        data.read( oData.size(), &( oData.front() ), 0, id );
+        oCompressed = data.isCompressed();
+    }
+
+    m_archive->count( ArImpl::kArraySamples );
+}
+
+//-*****************************************************************************
+void AprImpl::getKeyRuns( AbcA::ArraySampleKeyRuns & oRuns )
+{
+    oRuns.clear();
+
+    index_t numSamples = m_header->nextSampleIndex;
+    if ( numSamples == 0 )
+    {
+        return;
+    }
+
+    // Only the samples which changed are stored, the first one also stands
+    // in for the samples before firstChangedIndex, and the last one for the
+    // samples from lastChangedIndex on.
+    std::size_t numStored = m_header->verifyIndex( numSamples - 1 ) + 1;
+    index_t firstChanged = m_header->firstChangedIndex;
+
+    StreamLease stream( m_archive->getStreamManager() );
+    std::size_t id = stream.getID();
+
+    // plenty for the keys of most properties to be read all at once,
+    // without the memory it takes growing with how many samples there are
+    const std::size_t MAX_CHUNK = 16384;
+    std::vector< Ogawa::IDataHandle > datas(
+        std::min( numStored, MAX_CHUNK ) );
+
+    AbcA::ArraySampleKeyRun run;
+    run.key.readPOD = m_header->header.getDataType().getPod();
+    run.key.origPOD = run.key.readPOD;
+
+    for ( std::size_t chunk = 0; chunk < numStored; chunk += MAX_CHUNK )
+    {
+        std::size_t numChunk = std::min( numStored - chunk, MAX_CHUNK );
+
+        // every other child, skipping the dimensions
+        m_group->getData( chunk * 2, numChunk, 2, id, &datas.front() );
+
+        for ( std::size_t i = 0; i < numChunk; ++i )
+        {
+            std::size_t stored = chunk + i;
+            index_t sample = firstChanged + ( index_t ) stored - 1;
+            run.first = ( stored == 0 ) ? 0 : sample;
+            run.last = ( stored + 1 == numStored ) ? numSamples - 1 : sample;
+
+            run.key.numBytes = 0;
+            run.key.digest = Util::Digest();
+            if ( datas[i].isValid() )
+            {
+                ReadKey( datas[i], id, run.key );
+            }
+
+            if ( !oRuns.empty() && oRuns.back().key == run.key )
+            {
+                oRuns.back().last = run.last;
+            }
+            else
+            {
+                oRuns.push_back( run );
+            }
+        }
+    }
+}
+
 //-*****************************************************************************
 bool AprImpl::isScalarLike()
 {
@@ -177,14 +358,15 @@ void AprImpl::getDimensions( index_t iSampleIndex,
 {
     size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+    StreamLease stream( m_archive->getStreamManager() );
+    std::size_t id = stream.getID();
 
-    std::size_t id = streamId->getID();
-    Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
-    Ogawa::IDataPtr data = m_group->getData(index, id);
+    // the data is followed by its dimensions, get them together
+    Ogawa::IDataHandle datas[2];
+    m_group->getData( index, 2, id, datas );
 
-    ReadDimensions( dims, data, id, m_header->header.getDataType(), oDim );
+    ReadDimensions( datas[1], datas[0], id, m_header->header.getDataType(),
+                    oDim );
 
 }
 
@@ -194,12 +376,66 @@ void AprImpl::getAs( index_t iSampleIndex, void *iIntoLocation,
 {
     size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+    StreamLease stream( m_archive->getStreamManager() );
+    std::size_t id = stream.getID();
+
+    Ogawa::IDataHandle data;
+    m_group->getData( index, id, data );
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    ReadData( iIntoLocation, data, id, dataType, iPod );
+
+    m_archive->count( ArImpl::kArraySamples );
+    if ( iPod != dataType.getPod() )
+    {
+        m_archive->count( ArImpl::kPodConversions );
+    }
+}
+
+//-*****************************************************************************
+void AprImpl::getStrings( index_t iSample, Util::StringArena & oStrings )
+{
+    ABCA_ASSERT(
+        m_header->header.getDataType().getPod() == Alembic::Util::kStringPOD,
+        "getStrings can only be used on properties of strings" );
+
+    size_t index = m_header->verifyIndex( iSample ) * 2;
+
+    StreamLease stream( m_archive->getStreamManager() );
+    std::size_t id = stream.getID();
+
+    Ogawa::IDataHandle data;
+    m_group->getData( index, id, data );
+    ReadStrings( data, id, oStrings );
+
+    m_archive->count( ArImpl::kArraySamples );
+}
+
+//-*****************************************************************************
+void AprImpl::prefetch( index_t iFirstSample, index_t iLastSample )
+{
+    StreamLease stream( m_archive->getStreamManager() );
+
+    // * 2 for Array properties (since we also write the dimensions)
+    PrefetchSamples( m_group, m_header, 2, iFirstSample, iLastSample,
+                     stream.getID() );
+}
+
+//-*****************************************************************************
+std::future<AbcA::ArraySamplePtr>
+AprImpl::getSampleAsync( index_t iSampleIndex )
+{
+    ReadThreadPool * pool = m_archive->getReadThreadPool();
+
+    if ( ! pool )
+    {
+        return AbcA::ArrayPropertyReader::getSampleAsync( iSampleIndex );
+    }
 
-    std::size_t id = streamId->getID();
-    Ogawa::IDataPtr data = m_group->getData( index, id );
-    ReadData( iIntoLocation, data, id, m_header->header.getDataType(), iPod );
+    Alembic::Util::shared_ptr< SampleTask > task(
+        new SampleTask( shared_from_this(), iSampleIndex ) );
+    std::future<AbcA::ArraySamplePtr> future = task->getFuture();
+    pool->submit( task );
+    return future;
 }
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -38,6 +38,7 @@
 #define Alembic_AbcCoreOgawa_AprImpl_h
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -68,11 +69,27 @@ public:
     virtual std::pair<index_t, chrono_t> getCeilIndex( chrono_t iTime );
     virtual std::pair<index_t, chrono_t> getNearIndex( chrono_t iTime );
     virtual bool getKey( index_t iSampleIndex, AbcA::ArraySampleKey & oKey );
+    virtual void getKeyRuns( AbcA::ArraySampleKeyRuns & oRuns );
     virtual void getDimensions( index_t iSampleIndex,
                                 Alembic::Util::Dimensions & oDim );
     virtual bool isScalarLike();
     virtual void getAs( index_t iSample, void *iIntoLocation,
                         Alembic::Util::PlainOldDataType iPod );
+    virtual void getStrings( index_t iSample,
+                             Alembic::Util::StringArena & oStrings );
+    virtual void prefetch( index_t iFirstSample, index_t iLastSample );
+    virtual std::future<AbcA::ArraySamplePtr>
+    getSampleAsync( index_t iSampleIndex );
+
+    // where the samples are read from and which of them are stored, for
+    // VerifyArchive
+    Ogawa::IGroupPtr getGroup() const { return m_group; }
+    PropertyHeaderPtr getHeaderPtr() const { return m_header; }
+
+    // the data of a sample as it is stored, key included, and whether it is
+    // compressed, for ApwImpl::setSampleFromReader
+    void readStoredData( index_t iSampleIndex, std::vector< char > & oData,
+                         bool & oCompressed );
 
 private:
 
@@ -84,6 +101,10 @@ private:
 
     // Stores the PropertyHeader and other info
     PropertyHeaderPtr m_header;
+
+    // The archive, found once up front so reading a sample doesn't have to
+    // walk back up to it, it outlives us since our parent holds onto it.
+    ArImpl * m_archive;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -35,6 +35,8 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/ApwImpl.h>
+#include <Alembic/AbcCoreOgawa/AprImpl.h>
+#include <Alembic/AbcCoreOgawa/AwImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 
@@ -65,10 +67,15 @@ ApwImpl::ApwImpl( AbcA::CompoundPropertyWriterPtr iParent,
 //-*****************************************************************************
 ApwImpl::~ApwImpl()
 {
-    AbcA::ArchiveWriterPtr archive = m_parent->getObject()->getArchive();
+    ChangeLock change( m_parent->getObject()->getArchive() );
 
-    index_t maxSamples = archive->getMaxNumSamplesForTimeSamplingIndex(
-            m_header->timeSamplingIndex );
+    // frozen now instead of when the group goes away, so a checkpoint never
+    // finds the group gone but not yet in its place in the parent
+    m_group->freeze();
+
+    Util::shared_ptr< AwImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< AwImpl, AbcA::ArchiveWriter >(
+            m_parent->getObject()->getArchive() );
 
     Util::uint32_t numSamples = m_header->nextSampleIndex;
 
@@ -78,11 +85,8 @@ ApwImpl::~ApwImpl()
         numSamples = 1;
     }
 
-    if ( maxSamples < numSamples )
-    {
-        archive->setMaxNumSamplesForTimeSamplingIndex(
-            m_header->timeSamplingIndex, numSamples );
-    }
+    archive->updateMaxNumSamplesForTimeSamplingIndex(
+        m_header->timeSamplingIndex, numSamples );
 
     Util::SpookyHash hash;
     hash.Init(0, 0);
@@ -105,6 +109,7 @@ ApwImpl::~ApwImpl()
 //-*****************************************************************************
 void ApwImpl::setFromPreviousSample()
 {
+    ChangeLock change( this->getObject()->getArchive() );
 
     // Make sure we aren't writing more samples than we have times for
     // This applies to acyclic sampling only
@@ -129,15 +134,6 @@ void ApwImpl::setFromPreviousSample()
 //-*****************************************************************************
 void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
 {
-    // Make sure we aren't writing more samples than we have times for
-    // This applies to acyclic sampling only
-    ABCA_ASSERT(
-        !m_header->header.getTimeSampling()->getTimeSamplingType().isAcyclic()
-        || m_header->header.getTimeSampling()->getNumStoredTimes() >
-        m_header->nextSampleIndex,
-        "Can not write more samples than we have times for when using "
-        "Acyclic sampling." );
-
     ABCA_ASSERT( iSamp.getDataType() == m_header->header.getDataType(),
         "DataType on ArraySample iSamp: " << iSamp.getDataType() <<
         ", does not match the DataType of the Array property: " <<
@@ -157,10 +153,94 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         key.readPOD = Alembic::Util::kInt8POD;
     }
 
+    writeSample( key, iSamp.getDimensions(), &iSamp, NULL );
+}
+
+//-*****************************************************************************
+void ApwImpl::setStrings( const Util::StringArena & iStrings )
+{
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    ABCA_ASSERT( dataType.getPod() == Alembic::Util::kStringPOD,
+                 "setStrings can only be used on properties of strings" );
+
+    ABCA_ASSERT( iStrings.size() % dataType.getExtent() == 0,
+                 "The number of strings: " << iStrings.size() <<
+                 " isn't a multiple of the extent: " <<
+                 ( int ) dataType.getExtent() );
+
+    writeSample( GetStringsKey( iStrings ),
+                 AbcA::Dimensions( iStrings.size() / dataType.getExtent() ),
+                 NULL, &iStrings );
+}
+
+//-*****************************************************************************
+void ApwImpl::setSampleFromReader( AbcA::ArrayPropertyReaderPtr iReader,
+                                   index_t iSampleIndex )
+{
+    Util::shared_ptr< AprImpl > stored =
+        Alembic::Util::dynamic_pointer_cast< AprImpl,
+            AbcA::ArrayPropertyReader >( iReader );
+
+    // not from an Ogawa archive, so there is nothing to copy as it is
+    if ( !stored )
+    {
+        AbcA::ArrayPropertyWriter::setSampleFromReader( iReader,
+                                                        iSampleIndex );
+        return;
+    }
+
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    ABCA_ASSERT( stored->getDataType() == dataType,
+        "DataType of the reader: " << stored->getDataType() <<
+        ", does not match the DataType of the Array property: " <<
+        dataType );
+
+    AbcA::Dimensions dims;
+    stored->getDimensions( iSampleIndex, dims );
+
+    // the stored digest is the one ArraySample::getKey made when it was
+    // written, only the size needs to be put back the way getKey has it
+    AbcA::ArraySample::Key key;
+    stored->getKey( iSampleIndex, key );
+    key.numBytes = dataType.getNumBytes() * dims.numPoints();
+
+    // see setSample
+    if ( key.origPOD != Alembic::Util::kStringPOD &&
+         key.origPOD != Alembic::Util::kWstringPOD )
+    {
+        key.origPOD = Alembic::Util::kInt8POD;
+        key.readPOD = Alembic::Util::kInt8POD;
+    }
+
+    writeSample( key, dims, NULL, NULL, stored.get(), iSampleIndex );
+}
+
+//-*****************************************************************************
+void ApwImpl::writeSample( const AbcA::ArraySample::Key & iKey,
+                           const AbcA::Dimensions & iDims,
+                           const AbcA::ArraySample * iSamp,
+                           const Util::StringArena * iStrings,
+                           AprImpl * iStored,
+                           index_t iStoredIndex )
+{
+    AbcA::ArchiveWriterPtr awp = this->getObject()->getArchive();
+    ChangeLock change( awp );
+
+    // Make sure we aren't writing more samples than we have times for
+    // This applies to acyclic sampling only
+    ABCA_ASSERT(
+        !m_header->header.getTimeSampling()->getTimeSamplingType().isAcyclic()
+        || m_header->header.getTimeSampling()->getNumStoredTimes() >
+        m_header->nextSampleIndex,
+        "Can not write more samples than we have times for when using "
+        "Acyclic sampling." );
+
+    Util::PlainOldDataType pod = m_header->header.getDataType().getPod();
+
     // We need to write the sample
     if ( m_header->nextSampleIndex == 0  ||
          !( m_previousWrittenSampleID &&
-            key == m_previousWrittenSampleID->getKey() ) )
+            iKey == m_previousWrittenSampleID->getKey() ) )
     {
 
         // we only need to repeat samples if this is not the first change
@@ -172,22 +252,50 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
             {
                 assert( smpI > 0 );
                 CopyWrittenData( m_group, m_previousWrittenSampleID );
-                WriteDimensions( m_group, m_dims,
-                                 iSamp.getDataType().getPod() );
+                WriteDimensions( m_group, m_dims, pod );
             }
         }
 
         // Write this sample, which will update its internal
         // cache of what the previously written sample was.
-        AbcA::ArchiveWriterPtr awp = this->getObject()->getArchive();
 
         // Write the sample.
         // This distinguishes between string, wstring, and regular arrays.
-        m_previousWrittenSampleID =
-            WriteData( GetWrittenSampleMap( awp ), m_group, iSamp, key );
+        if ( iSamp )
+        {
+            m_previousWrittenSampleID =
+                WriteData( GetWrittenSampleMap( awp ), m_group, *iSamp, iKey,
+                           awp->getCompressionHint() );
+        }
+        else if ( iStrings )
+        {
+            m_previousWrittenSampleID =
+                WriteData( GetWrittenSampleMap( awp ), m_group, *iStrings,
+                           iKey, awp->getCompressionHint() );
+        }
+        else
+        {
+            // only read it if it hasn't already been written
+            WrittenSampleMap & sampleMap = GetWrittenSampleMap( awp );
+            m_previousWrittenSampleID = sampleMap.find( iKey );
+            if ( m_previousWrittenSampleID )
+            {
+                CopyWrittenData( m_group, m_previousWrittenSampleID );
+            }
+            else
+            {
+                std::vector< char > data;
+                bool compressed = false;
+                iStored->readStoredData( iStoredIndex, data, compressed );
+                m_previousWrittenSampleID = WriteStoredData( sampleMap,
+                    m_group, data, compressed,
+                    m_header->header.getDataType().getExtent() *
+                    iDims.numPoints(), iKey );
+            }
+        }
 
-        m_dims = iSamp.getDimensions();
-        WriteDimensions( m_group, m_dims, iSamp.getDataType().getPod() );
+        m_dims = iDims;
+        WriteDimensions( m_group, m_dims, pod );
 
         // if we haven't written this already, isScalarLike will be true
         if ( m_header->isScalarLike && m_dims.numPoints() != 1 )
@@ -223,6 +331,9 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
                                    digest.words[0], digest.words[1]);
     }
     m_header->nextSampleIndex ++;
+
+    change.unlock();
+    CheckpointIfDue( awp );
 }
 
 //-*****************************************************************************
@@ -250,6 +361,7 @@ void ApwImpl::setTimeSamplingIndex( Util::uint32_t iIndex )
         "Already have written more samples than we have times for when using "
         "Acyclic sampling." );
 
+    ChangeLock change( m_parent->getObject()->getArchive() );
     m_header->header.setTimeSampling(ts);
     m_header->timeSamplingIndex = iIndex;
 }
@@ -44,6 +44,9 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+class AprImpl;
+
 //-*****************************************************************************
 class ApwImpl
     : public AbcA::ArrayPropertyWriter
@@ -65,6 +68,9 @@ public:
 
     // ArrayPropertyWriter overrides
     virtual void setSample( const AbcA::ArraySample & iSamp );
+    virtual void setStrings( const Util::StringArena & iStrings );
+    virtual void setSampleFromReader( AbcA::ArrayPropertyReaderPtr iReader,
+                                      index_t iSampleIndex );
     virtual void setFromPreviousSample();
     virtual size_t getNumSamples();
     virtual void setTimeSamplingIndex( Util::uint32_t iIndex );
@@ -74,6 +80,16 @@ public:
     virtual AbcA::ObjectWriterPtr getObject();
     virtual AbcA::CompoundPropertyWriterPtr getParent();
 
+private:
+    // writes the sample with key iKey, which is either iSamp, iStrings or
+    // sample iStoredIndex of iStored, if it isn't the same as the last one
+    void writeSample( const AbcA::ArraySample::Key & iKey,
+                      const AbcA::Dimensions & iDims,
+                      const AbcA::ArraySample * iSamp,
+                      const Util::StringArena * iStrings,
+                      AprImpl * iStored = NULL,
+                      index_t iStoredIndex = 0 );
+
 protected:
     // Previous written array sample identifier!
     WrittenSampleIDPtr m_previousWrittenSampleID;
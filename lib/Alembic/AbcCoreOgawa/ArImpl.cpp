@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/ArImpl.h>
+#include <Alembic/AbcCoreOgawa/CprData.h>
 #include <Alembic/AbcCoreOgawa/OrData.h>
 #include <Alembic/AbcCoreOgawa/OrImpl.h>
 #include <Alembic/AbcCoreOgawa/ReadUtil.h>
@@ -43,41 +44,240 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+// shared by everything taking part in preloading the hierarchy
+struct PreloadState
+{
+    PreloadState( ArImpl & iArchive, ReadThreadPool * iPool )
+      : archive( iArchive )
+      , pool( iPool )
+      , pending( 0 )
+    {
+    }
+
+    ArImpl & archive;
+
+    // NULL when the tasks run on the thread that opened the archive, in
+    // which case they wait in serial
+    ReadThreadPool * pool;
+    std::deque< ReadThreadPool::TaskPtr > serial;
+
+    // how many tasks haven't finished yet
+    std::mutex lock;
+    std::condition_variable finished;
+    std::size_t pending;
+};
+
+typedef Alembic::Util::shared_ptr< PreloadState > PreloadStatePtr;
+
+//-*****************************************************************************
+// reads every compound property below iData, there aren't usually enough of
+// them to be worth splitting up
+void PreloadCompounds( ArImpl & iArchive, CprDataPtr iData,
+                       std::size_t iThreadId )
+{
+    if ( ! iData )
+    {
+        return;
+    }
+
+    for ( std::size_t i = 0; i < iData->getNumProperties(); ++i )
+    {
+        CprDataPtr data;
+        try
+        {
+            data = iData->preloadCompound( i, iArchive, iThreadId );
+        }
+        catch ( ... )
+        {
+            // it will throw again when it is asked for
+        }
+
+        PreloadCompounds( iArchive, data, iThreadId );
+    }
+}
+
+void PreloadChildren( PreloadStatePtr iState, OrDataPtr iData );
+
+//-*****************************************************************************
+// reads one object and its compound properties, and hands its children off
+// to be read by tasks of their own, so that wide hierarchies and deep ones
+// both spread out over the threads
+class ObjectTask : public ReadThreadPool::Task
+{
+public:
+    ObjectTask( PreloadStatePtr iState, OrDataPtr iParent, std::size_t iIndex )
+      : m_state( iState )
+      , m_parent( iParent )
+      , m_index( iIndex )
+    {
+    }
+
+    virtual void run()
+    {
+        // preloadHierarchy waits for pending to get back to 0, so whatever
+        // goes wrong we have to count ourselves as done
+        try
+        {
+            preload();
+        }
+        catch ( ... )
+        {
+            // whatever didn't get read is read when it is asked for
+        }
+
+        std::lock_guard< std::mutex > l( m_state->lock );
+        if ( --m_state->pending == 0 )
+        {
+            m_state->finished.notify_all();
+        }
+    }
+
+private:
+    void preload()
+    {
+        StreamLease stream( m_state->archive.getStreamManager() );
+
+        OrDataPtr data;
+        try
+        {
+            data = m_parent->preloadChild( m_index, m_state->archive,
+                                           stream.getID() );
+        }
+        catch ( ... )
+        {
+            // it will throw again when it is asked for
+        }
+
+        if ( data )
+        {
+            PreloadChildren( m_state, data );
+            PreloadCompounds( m_state->archive, data->getPropertiesData(),
+                              stream.getID() );
+        }
+    }
+
+    PreloadStatePtr m_state;
+    OrDataPtr m_parent;
+    std::size_t m_index;
+};
+
+//-*****************************************************************************
+// each task is only counted as pending once it is sure to run, so that if
+// making or handing one off throws the count doesn't wait on it forever
+void PreloadChildren( PreloadStatePtr iState, OrDataPtr iData )
+{
+    std::size_t numChildren = iData->getNumChildren();
+
+    for ( std::size_t i = 0; i < numChildren; ++i )
+    {
+        ReadThreadPool::TaskPtr task( new ObjectTask( iState, iData, i ) );
+        if ( iState->pool )
+        {
+            {
+                std::lock_guard< std::mutex > l( iState->lock );
+                ++iState->pending;
+            }
+
+            try
+            {
+                iState->pool->submit( task );
+            }
+            catch ( ... )
+            {
+                std::lock_guard< std::mutex > l( iState->lock );
+                if ( --iState->pending == 0 )
+                {
+                    iState->finished.notify_all();
+                }
+                throw;
+            }
+        }
+        else
+        {
+            std::lock_guard< std::mutex > l( iState->lock );
+            iState->serial.push_back( task );
+            ++iState->pending;
+        }
+    }
+}
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 ArImpl::ArImpl( const std::string &iFileName,
                 std::size_t iNumStreams,
-                bool iUseMMap)
+                bool iUseMMap,
+                bool iZeroCopy,
+                AbcA::ReadArraySampleCachePtr iCache,
+                std::size_t iNumReadThreads,
+                bool iCollectStatistics,
+                bool iPreloadHierarchy,
+                bool iShareFiles )
   : m_fileName( iFileName )
-  , m_archive( iFileName, iNumStreams, iUseMMap )
+  , m_zeroCopy( iUseMMap && iZeroCopy )
+  , m_archive( iFileName, iNumStreams, iUseMMap, iShareFiles )
   , m_header( new AbcA::ObjectHeader() )
   , m_manager( iNumStreams )
+  , m_readArraySampleCache( iCache )
+  , m_numReadThreads( iNumReadThreads )
+  , m_collectStatistics( iCollectStatistics )
+  , m_preloadHierarchy( iPreloadHierarchy )
+  , m_pathIndexRead( false )
 {
     ABCA_ASSERT( m_archive.isValid(),
                  "Could not open as Ogawa file: " << m_fileName );
 
-    ABCA_ASSERT( m_archive.isFrozen(),
-        "Ogawa file not cleanly closed while being written: " << m_fileName );
+    // an archive which was never closed can still be read as of its last
+    // checkpoint, see WriteArchive::setCheckpointInterval
+    ABCA_ASSERT( m_archive.isFrozen() ||
+                 m_archive.getStreams()->isCheckpoint(),
+        "Ogawa file not cleanly closed while being written, and without a "
+        "checkpoint: " << m_fileName );
 
     init();
 }
 
 //-*****************************************************************************
-ArImpl::ArImpl( const std::vector< std::istream * > & iStreams )
-  : m_archive( iStreams )
+ArImpl::ArImpl( const std::vector< std::istream * > & iStreams,
+                AbcA::ReadArraySampleCachePtr iCache,
+                std::size_t iNumReadThreads,
+                bool iCollectStatistics,
+                bool iPreloadHierarchy )
+  : m_zeroCopy( false )
+  , m_archive( iStreams )
   , m_header( new AbcA::ObjectHeader() )
   , m_manager( iStreams.size() )
+  , m_readArraySampleCache( iCache )
+  , m_numReadThreads( iNumReadThreads )
+  , m_collectStatistics( iCollectStatistics )
+  , m_preloadHierarchy( iPreloadHierarchy )
+  , m_pathIndexRead( false )
 {
     ABCA_ASSERT( m_archive.isValid(),
                  "Could not open as Ogawa file from provided streams." );
 
-    ABCA_ASSERT( m_archive.isFrozen(),
-        "Ogawa streams not cleanly closed while being written. " );
+    ABCA_ASSERT( m_archive.isFrozen() ||
+                 m_archive.getStreams()->isCheckpoint(),
+        "Ogawa streams not cleanly closed while being written, and without a "
+        "checkpoint. " );
 
     init();
 }
 
 //-*****************************************************************************
 void ArImpl::init()
+{
+    resetReadStatistics();
+    m_archive.getStreams()->setCollectStatistics( m_collectStatistics );
+
+    readTop();
+}
+
+//-*****************************************************************************
+void ArImpl::readTop()
 {
     Ogawa::IGroupPtr group = m_archive.getGroup();
 
@@ -117,10 +317,18 @@ void ArImpl::init()
 
     m_archiveVersion = fileVersion;
 
-    ReadTimeSamplesAndMax( group->getData( 4, 0 ),
-                           m_timeSamples, m_maxSamples );
+    // read into fresh vectors, since this is done again by refresh
+    std::vector < AbcA::TimeSamplingPtr > timeSamples;
+    std::vector < AbcA::index_t > maxSamples;
+    ReadTimeSamplesAndMax( group->getData( 4, 0 ), timeSamples, maxSamples );
+    m_timeSamples.swap( timeSamples );
+    m_maxSamples.swap( maxSamples );
 
-    ReadIndexedMetaData( group->getData( 5, 0 ), m_indexMetaData );
+    // the existing object data holds onto this, which is fine since the
+    // writer only ever adds to it
+    std::vector< AbcA::MetaData > indexMetaData;
+    ReadIndexedMetaData( group->getData( 5, 0 ), indexMetaData );
+    m_indexMetaData.swap( indexMetaData );
 
     m_data = Alembic::Util::shared_ptr < OrData >( new OrData(
         group->getGroup( 2, false, 0 ), "", 0, *this,
@@ -138,6 +346,73 @@ void ArImpl::init()
         m_header->getMetaData().deserialize( metaData );
     }
 
+    if ( m_preloadHierarchy )
+    {
+        preloadHierarchy();
+    }
+}
+
+//-*****************************************************************************
+bool ArImpl::refresh()
+{
+    if ( !m_archive.refresh() )
+    {
+        return false;
+    }
+
+    readTop();
+
+    // readers already gotten hold onto the old top object, the next getTop
+    // makes one with what was just read
+    m_top.store( AbcA::ObjectReaderPtr() );
+
+    {
+        Alembic::Util::scoped_lock l( m_pathIndexLock );
+        m_pathIndexRead = false;
+        m_pathIndex.clear();
+    }
+
+    return true;
+}
+
+//-*****************************************************************************
+void ArImpl::preloadHierarchy()
+{
+    PreloadStatePtr state( new PreloadState( *this, getReadThreadPool() ) );
+
+    // the tasks which did get handed off still have to be waited for
+    try
+    {
+        PreloadChildren( state, m_data );
+
+        StreamLease stream( m_manager );
+        PreloadCompounds( *this, m_data->getPropertiesData(),
+                          stream.getID() );
+    }
+    catch ( ... )
+    {
+        // whatever didn't get read is read when it is asked for
+    }
+
+    // the tasks don't hold onto us, so wait for all of them to finish,
+    // running them ourselves if there are no threads to
+    std::unique_lock< std::mutex > l( state->lock );
+    while ( state->pending != 0 )
+    {
+        if ( state->serial.empty() )
+        {
+            state->finished.wait( l );
+            continue;
+        }
+
+        ReadThreadPool::TaskPtr task = state->serial.front();
+        state->serial.pop_front();
+
+        l.unlock();
+        task->run();
+        task.reset();
+        l.lock();
+    }
 }
 
 //-*****************************************************************************
@@ -155,20 +430,106 @@ const AbcA::MetaData &ArImpl::getMetaData() const
 //-*****************************************************************************
 AbcA::ObjectReaderPtr ArImpl::getTop()
 {
+    AbcA::ObjectReaderPtr ret = m_top.lock();
+    if ( ret )
+    {
+        return ret;
+    }
+
     Alembic::Util::scoped_lock l( m_orlock );
 
-    AbcA::ObjectReaderPtr ret = m_top.lock();
+    ret = m_top.lock();
     if ( ! ret )
     {
         // time to make a new one
         ret = Alembic::Util::shared_ptr<OrImpl>(
             new OrImpl( shared_from_this(), m_data, m_header ) );
-        m_top = ret;
+        m_top.store( ret );
     }
 
     return ret;
 }
 
+//-*****************************************************************************
+AbcA::ObjectReaderPtr ArImpl::getObjectByPath( const std::string & iFullName )
+{
+    // only trust the index with full names as they were written, anything
+    // else, like "/" or "a//b", gets walked down to
+    if ( iFullName.size() < 2 || iFullName[0] != '/' ||
+         iFullName[ iFullName.size() - 1 ] == '/' ||
+         iFullName.find( "//" ) != std::string::npos || !readPathIndex() )
+    {
+        return AbcA::ArchiveReader::getObjectByPath( iFullName );
+    }
+
+    // the index is only a shortcut, so if it turns out to be bad walk down
+    // to the object instead, which reports any errors as it always has
+    try
+    {
+        Util::uint64_t pos = 0;
+        ObjectHeaderPtr header;
+        if ( !FindInPathIndex( m_pathIndex, iFullName, m_indexMetaData,
+                               pos, header ) )
+        {
+            return AbcA::ObjectReaderPtr();
+        }
+
+        StreamIDPtr streamId = getStreamID();
+        std::size_t id = streamId->getID();
+        Ogawa::IGroupPtr group = m_archive.getGroup( pos, false, id );
+
+        OrDataPtr data( new OrData( group, iFullName, id, *this,
+                                    m_indexMetaData ) );
+
+        // the parent gets found when it is asked for
+        return Alembic::Util::shared_ptr<OrImpl>(
+            new OrImpl( shared_from_this(), data, header ) );
+    }
+    catch ( std::exception & )
+    {
+    }
+
+    return AbcA::ArchiveReader::getObjectByPath( iFullName );
+}
+
+//-*****************************************************************************
+bool ArImpl::readPathIndex()
+{
+    Alembic::Util::scoped_lock l( m_pathIndexLock );
+
+    if ( m_pathIndexRead )
+    {
+        return !m_pathIndex.empty();
+    }
+    m_pathIndexRead = true;
+
+    // older archives don't have it, and those which were written by
+    // something else may have anything at all there
+    Ogawa::IGroupPtr group = m_archive.getGroup();
+    if ( group->getNumChildren() < 7 || !group->isChildData( 6 ) )
+    {
+        return false;
+    }
+
+    try
+    {
+        StreamLease stream( m_manager );
+        Ogawa::IDataPtr data = group->getData( 6, stream.getID() );
+        if ( data && data->getSize() >= 8 )
+        {
+            m_pathIndex.resize( data->getSize() );
+            data->read( m_pathIndex.size(), &( m_pathIndex[0] ), 0,
+                        stream.getID() );
+        }
+    }
+    catch ( std::exception & )
+    {
+        m_pathIndex.clear();
+    }
+
+    return !m_pathIndex.empty();
+}
+
 //-*****************************************************************************
 AbcA::TimeSamplingPtr ArImpl::getTimeSampling( Util::uint32_t iIndex )
 {
@@ -213,6 +574,62 @@ const std::vector< AbcA::MetaData > & ArImpl::getIndexedMetaData()
     return m_indexMetaData;
 }
 
+//-*****************************************************************************
+bool ArImpl::getReadStatistics( AbcA::ReadStatistics & oStats )
+{
+    if ( ! m_collectStatistics )
+    {
+        return false;
+    }
+
+    Ogawa::IStreamsPtr streams = m_archive.getStreams();
+    oStats.streams.resize( streams->getNumStreams() );
+    for ( std::size_t i = 0; i < oStats.streams.size(); ++i )
+    {
+        AbcA::ReadStatistics::Stream & stream = oStats.streams[i];
+        streams->getStatistics( i, stream.numReads, stream.numBytes,
+                                stream.nanoseconds );
+    }
+
+    oStats.numObjectHeaders = m_counters[kObjectHeaders];
+    oStats.numPropertyHeaders = m_counters[kPropertyHeaders];
+    oStats.numArraySamples = m_counters[kArraySamples];
+    oStats.numScalarSamples = m_counters[kScalarSamples];
+    oStats.numPodConversions = m_counters[kPodConversions];
+    oStats.numCacheHits = m_counters[kCacheHits];
+    oStats.numCacheMisses = m_counters[kCacheMisses];
+    return true;
+}
+
+//-*****************************************************************************
+void ArImpl::resetReadStatistics()
+{
+    for ( std::size_t i = 0; i < kNumCounters; ++i )
+    {
+        m_counters[i].store( 0, std::memory_order_relaxed );
+    }
+
+    m_archive.getStreams()->resetStatistics();
+}
+
+//-*****************************************************************************
+ReadThreadPool * ArImpl::getReadThreadPool()
+{
+    if ( m_numReadThreads == 0 )
+    {
+        return NULL;
+    }
+
+    Alembic::Util::scoped_lock l( m_readThreadPoolLock );
+
+    if ( ! m_readThreadPool )
+    {
+        m_readThreadPool.reset( new ReadThreadPool( m_numReadThreads ) );
+    }
+
+    return m_readThreadPool.get();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
@@ -39,6 +39,9 @@
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/StreamManager.h>
+#include <Alembic/AbcCoreOgawa/ReadThreadPool.h>
+
+#include <atomic>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -57,9 +60,21 @@ private:
 
     ArImpl( const std::string &iFileName,
             size_t iNumStreams=1,
-            bool iUseMMap=true);
-
-    ArImpl( const std::vector< std::istream * > & iStreams );
+            bool iUseMMap=true,
+            bool iZeroCopy=false,
+            AbcA::ReadArraySampleCachePtr iCache=
+                AbcA::ReadArraySampleCachePtr(),
+            size_t iNumReadThreads=0,
+            bool iCollectStatistics=false,
+            bool iPreloadHierarchy=false,
+            bool iShareFiles=false );
+
+    ArImpl( const std::vector< std::istream * > & iStreams,
+            AbcA::ReadArraySampleCachePtr iCache=
+                AbcA::ReadArraySampleCachePtr(),
+            size_t iNumReadThreads=0,
+            bool iCollectStatistics=false,
+            bool iPreloadHierarchy=false );
 
 public:
 
@@ -80,12 +95,13 @@ public:
 
     virtual AbcA::ReadArraySampleCachePtr getReadArraySampleCachePtr()
     {
-        return AbcA::ReadArraySampleCachePtr();
+        return m_readArraySampleCache;
     }
 
     virtual void
     setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr )
     {
+        m_readArraySampleCache = iPtr;
     }
 
     virtual AbcA::index_t getMaxNumSamplesForTimeSamplingIndex(
@@ -101,19 +117,75 @@ public:
         return m_archiveVersion;
     }
 
+    virtual bool getReadStatistics( AbcA::ReadStatistics & oStats );
+
+    virtual void resetReadStatistics();
+
+    // goes straight to the object if the archive was written with a path
+    // index, see WriteArchive::setPathIndex
+    virtual AbcA::ObjectReaderPtr
+    getObjectByPath( const std::string & iFullName );
+
     StreamIDPtr getStreamID();
 
+    // for leasing streams on the stack, see StreamLease
+    StreamManager & getStreamManager() { return m_manager; }
+
+    // whether array samples may point directly into the memory mapped file
+    bool useZeroCopy() const { return m_zeroCopy; }
+
     const std::vector< AbcA::MetaData > & getIndexedMetaData();
 
+    // picks up what has been written since the archive was opened, see
+    // RefreshArchive
+    bool refresh();
+
+    // the threads which run asynchronous sample reads, started on first use,
+    // NULL if they should be read on the calling thread instead
+    ReadThreadPool * getReadThreadPool();
+
+    // what gets counted here, the reads themselves are counted by Ogawa
+    enum Counter
+    {
+        kObjectHeaders,
+        kPropertyHeaders,
+        kArraySamples,
+        kScalarSamples,
+        kPodConversions,
+        kCacheHits,
+        kCacheMisses,
+        kNumCounters
+    };
+
+    void count( Counter iCounter, Util::uint64_t iNum = 1 )
+    {
+        if ( m_collectStatistics )
+        {
+            m_counters[iCounter].fetch_add( iNum, std::memory_order_relaxed );
+        }
+    }
+
 private:
     void init();
 
+    // reads everything hanging off of the top group of m_archive
+    void readTop();
+
+    // reads every object and compound property below the top object, see
+    // ReadArchive::setPreloadHierarchy
+    void preloadHierarchy();
+
+    // reads the path index the first time it is needed, returns whether
+    // there is one
+    bool readPathIndex();
+
     std::string m_fileName;
     size_t m_numStreams;
+    bool m_zeroCopy;
 
     Ogawa::IArchive m_archive;
 
-    Alembic::Util::weak_ptr< AbcA::ObjectReader > m_top;
+    Alembic::Util::AtomicWeakPtr< AbcA::ObjectReader > m_top;
     Alembic::Util::shared_ptr < OrData > m_data;
     Alembic::Util::mutex m_orlock;
 
@@ -127,6 +199,22 @@ private:
     StreamManager m_manager;
 
     std::vector< AbcA::MetaData > m_indexMetaData;
+
+    AbcA::ReadArraySampleCachePtr m_readArraySampleCache;
+
+    size_t m_numReadThreads;
+    Alembic::Util::unique_ptr< ReadThreadPool > m_readThreadPool;
+    Alembic::Util::mutex m_readThreadPoolLock;
+
+    bool m_collectStatistics;
+    std::atomic< Util::uint64_t > m_counters[kNumCounters];
+
+    bool m_preloadHierarchy;
+
+    // see WriteArchive::setPathIndex
+    bool m_pathIndexRead;
+    std::vector< char > m_pathIndex;
+    Alembic::Util::mutex m_pathIndexLock;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -45,12 +45,23 @@ namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 AwImpl::AwImpl( const std::string &iFileName,
-                const AbcA::MetaData &iMetaData )
+                const AbcA::MetaData &iMetaData,
+                std::size_t iBufferSize,
+                std::size_t iAsyncQueueSize,
+                bool iPathIndex,
+                std::size_t iMaxDedupBytes,
+                std::size_t iCheckpointInterval )
   : m_fileName( iFileName )
   , m_metaData( iMetaData )
-  , m_archive( iFileName )
+  , m_archive( iFileName, iBufferSize, iAsyncQueueSize )
   , m_metaDataMap( new MetaDataMap() )
+  , m_pathIndex( iPathIndex )
+  , m_checkpointInterval( iCheckpointInterval )
+  , m_lastCheckpointSize( 0 )
+  , m_numChanging( 0 )
+  , m_checkpointing( false )
 {
+    m_writtenSampleMap.setMaxBytes( iMaxDedupBytes );
 
     // add default time sampling
     AbcA::TimeSamplingPtr ts( new AbcA::TimeSampling() );
@@ -67,11 +78,23 @@ AwImpl::AwImpl( const std::string &iFileName,
 
 //-*****************************************************************************
 AwImpl::AwImpl( std::ostream * iStream,
-                const AbcA::MetaData &iMetaData )
+                const AbcA::MetaData &iMetaData,
+                std::size_t iBufferSize,
+                std::size_t iAsyncQueueSize,
+                bool iPathIndex,
+                std::size_t iMaxDedupBytes,
+                std::size_t iCheckpointInterval )
   : m_metaData( iMetaData )
-  , m_archive( iStream )
+  , m_archive( iStream, iBufferSize, iAsyncQueueSize )
   , m_metaDataMap( new MetaDataMap() )
+  , m_pathIndex( iPathIndex )
+  , m_checkpointInterval( iCheckpointInterval )
+  , m_lastCheckpointSize( 0 )
+  , m_numChanging( 0 )
+  , m_checkpointing( false )
 {
+    m_writtenSampleMap.setMaxBytes( iMaxDedupBytes );
+
     // add default time sampling
     AbcA::TimeSamplingPtr ts( new AbcA::TimeSampling() );
     m_timeSamples.push_back(ts);
@@ -107,21 +130,20 @@ void AwImpl::init()
     // seed with the common empty keys
     AbcA::ArraySampleKey emptyKey;
     emptyKey.numBytes = 0;
-    Ogawa::ODataPtr emptyData( new Ogawa::OData() );
 
     emptyKey.origPOD = Alembic::Util::kInt8POD;
     emptyKey.readPOD = Alembic::Util::kInt8POD;
-    WrittenSampleIDPtr wsid( new WrittenSampleID( emptyKey, emptyData, 0 ) );
+    WrittenSampleIDPtr wsid( new WrittenSampleID( emptyKey, 0, 0 ) );
     m_writtenSampleMap.store( wsid );
 
     emptyKey.origPOD = Alembic::Util::kStringPOD;
     emptyKey.readPOD = Alembic::Util::kStringPOD;
-    wsid.reset( new WrittenSampleID( emptyKey, emptyData, 0 ) );
+    wsid.reset( new WrittenSampleID( emptyKey, 0, 0 ) );
     m_writtenSampleMap.store( wsid );
 
     emptyKey.origPOD = Alembic::Util::kWstringPOD;
     emptyKey.readPOD = Alembic::Util::kWstringPOD;
-    wsid.reset( new WrittenSampleID( emptyKey, emptyData, 0 ) );
+    wsid.reset( new WrittenSampleID( emptyKey, 0, 0 ) );
     m_writtenSampleMap.store( wsid );
 }
 
@@ -161,6 +183,8 @@ AbcA::ObjectWriterPtr AwImpl::getTop()
 //-*****************************************************************************
 Util::uint32_t AwImpl::addTimeSampling( const AbcA::TimeSampling & iTs )
 {
+    Alembic::Util::scoped_lock l( m_lock );
+
     index_t numTS = m_timeSamples.size();
     for (index_t i = 0; i < numTS; ++i)
     {
@@ -185,6 +209,8 @@ Util::uint32_t AwImpl::addTimeSampling( const AbcA::TimeSampling & iTs )
 //-*****************************************************************************
 AbcA::TimeSamplingPtr AwImpl::getTimeSampling( Util::uint32_t iIndex )
 {
+    Alembic::Util::scoped_lock l( m_lock );
+
     ABCA_ASSERT( iIndex < m_timeSamples.size(),
         "Invalid index provided to getTimeSampling." );
 
@@ -195,6 +221,8 @@ AbcA::TimeSamplingPtr AwImpl::getTimeSampling( Util::uint32_t iIndex )
 AbcA::index_t
 AwImpl::getMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex )
 {
+    Alembic::Util::scoped_lock l( m_lock );
+
     if ( iIndex < m_maxSamples.size() )
     {
         return m_maxSamples[iIndex];
@@ -206,12 +234,153 @@ AwImpl::getMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex )
 void AwImpl::setMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex,
                                                    AbcA::index_t iMaxIndex )
 {
+    Alembic::Util::scoped_lock l( m_lock );
+
     if ( iIndex < m_maxSamples.size() )
     {
         m_maxSamples[iIndex] = iMaxIndex;
     }
 }
 
+//-*****************************************************************************
+void AwImpl::updateMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex,
+    AbcA::index_t iNumSamples )
+{
+    Alembic::Util::scoped_lock l( m_lock );
+
+    if ( iIndex < m_maxSamples.size() && m_maxSamples[iIndex] < iNumSamples )
+    {
+        m_maxSamples[iIndex] = iNumSamples;
+    }
+}
+
+//-*****************************************************************************
+Util::uint32_t AwImpl::getNumTimeSamplings()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_timeSamples.size();
+}
+
+//-*****************************************************************************
+void AwImpl::checkpoint()
+{
+    if ( !m_data || !m_archive.isValid() )
+    {
+        return;
+    }
+
+    // wait for the samples, objects and properties being written on other
+    // threads, and hold off any more until the checkpoint is written
+    {
+        std::unique_lock< std::mutex > l( m_changeLock );
+        m_checkpointing = true;
+        while ( m_numChanging != 0 )
+        {
+            m_changeDone.wait( l );
+        }
+    }
+
+    try
+    {
+        writeCheckpoint();
+    }
+    catch ( ... )
+    {
+        std::unique_lock< std::mutex > l( m_changeLock );
+        m_checkpointing = false;
+        m_changeDone.notify_all();
+        throw;
+    }
+
+    std::unique_lock< std::mutex > l( m_changeLock );
+    m_checkpointing = false;
+    m_changeDone.notify_all();
+}
+
+//-*****************************************************************************
+void AwImpl::writeCheckpoint()
+{
+    std::vector < AbcA::index_t > maxSamples;
+    std::vector < AbcA::TimeSamplingPtr > timeSamples;
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        maxSamples = m_maxSamples;
+        timeSamples = m_timeSamples;
+    }
+
+    // laid out just like the destructor does it, minus the path index
+    Ogawa::OGroupPtr root = m_archive.getGroup()->snapshot();
+    root->replaceGroup( 2, m_data->writeSnapshot( m_metaDataMap,
+                                                  maxSamples ) );
+
+    std::string metaData = m_metaData.serialize();
+    root->addData( metaData.size(), metaData.c_str() );
+
+    std::vector< Util::uint8_t > data;
+    for ( std::size_t i = 0; i < timeSamples.size(); ++i )
+    {
+        Util::uint32_t maxSample = maxSamples[i];
+        WriteTimeSampling( data, maxSample, *timeSamples[i] );
+    }
+    root->addData( data.size(), &( data.front() ) );
+
+    m_metaDataMap->write( root );
+
+    root->freeze();
+    m_archive.checkpoint( root );
+
+    m_lastCheckpointSize = m_archive.getSize();
+}
+
+//-*****************************************************************************
+void AwImpl::checkpointIfDue()
+{
+    if ( m_checkpointInterval == 0 ||
+         m_archive.getSize() - m_lastCheckpointSize < m_checkpointInterval )
+    {
+        return;
+    }
+
+    // whichever thread gets here first writes it, the rest carry on
+    std::unique_lock< std::mutex > l( m_checkpointLock, std::try_to_lock );
+    if ( l.owns_lock() &&
+         m_archive.getSize() - m_lastCheckpointSize >= m_checkpointInterval )
+    {
+        checkpoint();
+    }
+}
+
+//-*****************************************************************************
+void AwImpl::beginChange()
+{
+    if ( m_checkpointInterval == 0 )
+    {
+        return;
+    }
+
+    std::unique_lock< std::mutex > l( m_changeLock );
+    while ( m_checkpointing )
+    {
+        m_changeDone.wait( l );
+    }
+    ++m_numChanging;
+}
+
+//-*****************************************************************************
+void AwImpl::endChange()
+{
+    if ( m_checkpointInterval == 0 )
+    {
+        return;
+    }
+
+    std::unique_lock< std::mutex > l( m_changeLock );
+    if ( --m_numChanging == 0 && m_checkpointing )
+    {
+        m_changeDone.notify_all();
+    }
+}
+
 //-*****************************************************************************
 AwImpl::~AwImpl()
 {
@@ -248,7 +417,24 @@ AwImpl::~AwImpl()
         }
 
         m_archive.getGroup()->addData( data.size(), &( data.front() ) );
+
+        // this has to be packed before the meta data map is written, since
+        // it may add to it
+        std::vector< Util::uint8_t > pathIndex;
+        if ( m_pathIndex )
+        {
+            WritePathIndex( pathIndex, m_pathIndexEntries, m_metaDataMap );
+        }
+
         m_metaDataMap->write( m_archive.getGroup() );
+
+        // older readers only look at the first 6 children so this is safely
+        // ignored by them
+        if ( m_pathIndex )
+        {
+            m_archive.getGroup()->addData( pathIndex.size(),
+                                           &( pathIndex.front() ) );
+        }
     }
 
 }
@@ -41,6 +41,10 @@
 #include <Alembic/AbcCoreOgawa/WrittenSampleMap.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
@@ -57,10 +61,20 @@ private:
     friend class WriteArchive;
 
     AwImpl( const std::string &iFileName,
-            const AbcA::MetaData &iMetaData );
+            const AbcA::MetaData &iMetaData,
+            std::size_t iBufferSize=0,
+            std::size_t iAsyncQueueSize=0,
+            bool iPathIndex=false,
+            std::size_t iMaxDedupBytes=0,
+            std::size_t iCheckpointInterval=0 );
 
     AwImpl( std::ostream * iStream,
-            const AbcA::MetaData & iMetaData );
+            const AbcA::MetaData & iMetaData,
+            std::size_t iBufferSize=0,
+            std::size_t iAsyncQueueSize=0,
+            bool iPathIndex=false,
+            std::size_t iMaxDedupBytes=0,
+            std::size_t iCheckpointInterval=0 );
 
 public:
     virtual ~AwImpl();
@@ -93,8 +107,7 @@ public:
 
     virtual AbcA::TimeSamplingPtr getTimeSampling( Util::uint32_t iIndex );
 
-    virtual Util::uint32_t getNumTimeSamplings()
-    { return m_timeSamples.size(); }
+    virtual Util::uint32_t getNumTimeSamplings();
 
     virtual AbcA::index_t getMaxNumSamplesForTimeSamplingIndex(
         Util::uint32_t iIndex );
@@ -102,8 +115,43 @@ public:
     virtual void setMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex,
                                                       AbcA::index_t iMaxIndex );
 
+    // raises the max number of samples for iIndex to iNumSamples if it is
+    // less than that, in one step so properties can be closed on different
+    // threads at once
+    void updateMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex,
+                                                  AbcA::index_t iNumSamples );
+
+    // whether objects should tell us where their groups went, see
+    // WriteArchive::setPathIndex
+    bool usePathIndex() const { return m_pathIndex; }
+
+    void addToPathIndex( ObjectHeaderPtr iHeader, Util::uint64_t iPos )
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        m_pathIndexEntries.push_back( PathIndexEntry( iPos, iHeader ) );
+    }
+
+    // writes a checkpoint if at least the checkpoint interval worth of bytes
+    // have been written since the last one, and no other thread is already
+    // writing one
+    void checkpointIfDue();
+
+    // see ChangeLock, these do nothing when checkpoints are off
+    void beginChange();
+    void endChange();
+
 private:
     void init();
+
+    // writes a provisional top group with everything written so far and
+    // points the file at it, so the file can be read if it is never closed,
+    // see WriteArchive::setCheckpointInterval.  Expects m_checkpointLock to
+    // be held.
+    void checkpoint();
+
+    // the part of checkpoint done with every other change held off
+    void writeCheckpoint();
+
     std::string m_fileName;
     AbcA::MetaData m_metaData;
     Alembic::Ogawa::OArchive m_archive;
@@ -117,6 +165,27 @@ private:
 
     WrittenSampleMap m_writtenSampleMap;
     MetaDataMapPtr m_metaDataMap;
+
+    bool m_pathIndex;
+    std::vector< PathIndexEntry > m_pathIndexEntries;
+
+    // 0 when checkpoints are off
+    Util::uint64_t m_checkpointInterval;
+
+    // only changed by whoever holds m_checkpointLock
+    std::atomic< Util::uint64_t > m_lastCheckpointSize;
+    std::mutex m_checkpointLock;
+
+    // how many changes are underway, a checkpoint waits for them to finish
+    // and holds off new ones until it is written
+    std::mutex m_changeLock;
+    std::condition_variable m_changeDone;
+    std::size_t m_numChanging;
+    bool m_checkpointing;
+
+    // guards the time samplings, max samples and path index, which objects
+    // and properties on different threads may update at once
+    Alembic::Util::mutex m_lock;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
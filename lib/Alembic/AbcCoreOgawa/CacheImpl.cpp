@@ -0,0 +1,159 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/CacheImpl.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+CacheImpl::CacheImpl( std::size_t iMaxBytes )
+  : m_maxBytes( iMaxBytes )
+  , m_numBytes( 0 )
+  , m_clock( 0 )
+{
+}
+
+//-*****************************************************************************
+CacheImpl::~CacheImpl()
+{
+}
+
+//-*****************************************************************************
+void CacheImpl::touch( Shard & iShard, EntryList::iterator iEntry )
+{
+    iEntry->lastUsed = ++m_clock;
+    iShard.entries.splice( iShard.entries.begin(), iShard.entries, iEntry );
+}
+
+//-*****************************************************************************
+AbcA::ReadArraySampleID
+CacheImpl::find( const AbcA::ArraySample::Key &iKey )
+{
+    Shard & shard = getShard( iKey );
+    Alembic::Util::scoped_lock l( shard.lock );
+
+    Map::iterator found = shard.map.find( iKey );
+    if ( found == shard.map.end() )
+    {
+        return AbcA::ReadArraySampleID();
+    }
+
+    // move it to the front since it was just used
+    EntryList::iterator entry = found->second;
+    touch( shard, entry );
+
+    return AbcA::ReadArraySampleID( iKey, entry->sample );
+}
+
+//-*****************************************************************************
+AbcA::ReadArraySampleID
+CacheImpl::store( const AbcA::ArraySample::Key &iKey,
+                  AbcA::ArraySamplePtr iSamp )
+{
+    ABCA_ASSERT( iSamp, "Cannot store a null sample" );
+
+    // too big to ever fit, hand it right back without holding on to it
+    if ( iKey.numBytes > m_maxBytes )
+    {
+        return AbcA::ReadArraySampleID( iKey, iSamp );
+    }
+
+    {
+        Shard & shard = getShard( iKey );
+        Alembic::Util::scoped_lock l( shard.lock );
+
+        // somebody else may have beaten us to it
+        Map::iterator found = shard.map.find( iKey );
+        if ( found != shard.map.end() )
+        {
+            EntryList::iterator entry = found->second;
+            touch( shard, entry );
+            return AbcA::ReadArraySampleID( iKey, entry->sample );
+        }
+
+        shard.entries.push_front( Entry( iKey, iSamp, ++m_clock ) );
+        shard.map[iKey] = shard.entries.begin();
+        m_numBytes += iKey.numBytes;
+    }
+
+    evict();
+
+    return AbcA::ReadArraySampleID( iKey, iSamp );
+}
+
+//-*****************************************************************************
+void CacheImpl::evict()
+{
+    // only one shard is locked at a time, so the oldest sample found may
+    // have been used again by the time it is dropped, which is close enough
+    while ( m_numBytes > m_maxBytes )
+    {
+        std::size_t oldest = kNumShards;
+        Util::uint64_t oldestUsed = 0;
+        for ( std::size_t i = 0; i < kNumShards; ++i )
+        {
+            Alembic::Util::scoped_lock l( m_shards[i].lock );
+            if ( !m_shards[i].entries.empty() &&
+                 ( oldest == kNumShards ||
+                   m_shards[i].entries.back().lastUsed < oldestUsed ) )
+            {
+                oldest = i;
+                oldestUsed = m_shards[i].entries.back().lastUsed;
+            }
+        }
+
+        if ( oldest == kNumShards )
+        {
+            break;
+        }
+
+        Shard & shard = m_shards[oldest];
+        Alembic::Util::scoped_lock l( shard.lock );
+        if ( !shard.entries.empty() )
+        {
+            const Entry & last = shard.entries.back();
+            m_numBytes -= last.key.numBytes;
+            shard.map.erase( last.key );
+            shard.entries.pop_back();
+        }
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
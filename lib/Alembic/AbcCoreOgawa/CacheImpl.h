@@ -0,0 +1,137 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreOgawa_CacheImpl_h
+#define Alembic_AbcCoreOgawa_CacheImpl_h
+
+#include <Alembic/AbcCoreOgawa/Foundation.h>
+
+#include <atomic>
+#include <list>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! A thread safe read array sample cache which holds on to at most
+//! a given number of bytes of sample data, dropping the least recently used
+//! samples first.
+//! The samples are spread over a number of shards by their digest, each with
+//! its own lock, so threads reading different samples rarely wait on each
+//! other.  The shards share the byte budget, a single sample may use all of
+//! it, and room is made by dropping the least recently used sample of
+//! whichever shard has the oldest one.
+//! Dropping a sample from the cache only releases the cache's reference to
+//! it, anybody still holding on to the sample keeps it alive.
+class CacheImpl : public AbcA::ReadArraySampleCache
+{
+public:
+    //-*************************************************************************
+    // PUBLIC INTERFACE
+    //-*************************************************************************
+    explicit CacheImpl( std::size_t iMaxBytes );
+
+    virtual ~CacheImpl();
+
+    virtual AbcA::ReadArraySampleID
+    find( const AbcA::ArraySample::Key &iKey );
+
+    virtual AbcA::ReadArraySampleID
+    store( const AbcA::ArraySample::Key &iKey,
+           AbcA::ArraySamplePtr iSamp );
+
+    std::size_t getMaxBytes() const { return m_maxBytes; }
+
+    // how many bytes of sample data are currently held
+    std::size_t getNumBytes() const { return m_numBytes; }
+
+private:
+    //-*************************************************************************
+    // INTERNAL STORAGE
+    // Each shard keeps its samples in least recently used order, with the
+    // most recently used at the front, and a hash map into that list.
+    // Every use is stamped from a counter shared by all of the shards so the
+    // oldest samples across them can be told apart.
+    //-*************************************************************************
+    struct Entry
+    {
+        Entry( const AbcA::ArraySample::Key &iKey, AbcA::ArraySamplePtr iSamp,
+               Util::uint64_t iLastUsed )
+          : key( iKey ), sample( iSamp ), lastUsed( iLastUsed ) {}
+
+        AbcA::ArraySample::Key key;
+        AbcA::ArraySamplePtr sample;
+        Util::uint64_t lastUsed;
+    };
+
+    typedef std::list< Entry > EntryList;
+    typedef AbcA::UnorderedMapUtil< EntryList::iterator >::umap_type Map;
+
+    struct Shard
+    {
+        Alembic::Util::mutex lock;
+        EntryList entries;
+        Map map;
+    };
+
+    enum { kNumShards = 16 };
+
+    Shard & getShard( const AbcA::ArraySample::Key &iKey )
+    {
+        return m_shards[ iKey.digest.words[0] % kNumShards ];
+    }
+
+    // moves the entry to the front of its shard, which has to be locked
+    void touch( Shard & iShard, EntryList::iterator iEntry );
+
+    // drops samples until we are within m_maxBytes, with no shard locked
+    void evict();
+
+    std::size_t m_maxBytes;
+    std::atomic< std::size_t > m_numBytes;
+    std::atomic< Util::uint64_t > m_clock;
+    Shard m_shards[kNumShards];
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
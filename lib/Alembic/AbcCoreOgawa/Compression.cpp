@@ -0,0 +1,365 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/Compression.h>
+
+#include <algorithm>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+// The compressed buffer is the element size used when regrouping the bytes,
+// followed by a series of sequences.  Each sequence is a token byte holding
+// the number of literal bytes in the high 4 bits and the match length (minus
+// kMinMatch) in the low 4 bits, a value of 15 in either means more of the
+// length follows as bytes, 255 meaning keep going.  Then come the literal
+// bytes, then a 2 byte little endian offset back to where the match starts.
+// The last sequence is only literals and has no offset.
+
+const std::size_t kMinMatch = 4;
+const std::size_t kMaxOffset = 65535;
+
+// the last bytes are always stored as literals, so finding a match never
+// has to worry about reading past the end
+const std::size_t kTailLiterals = 12;
+
+//-*****************************************************************************
+inline Util::uint32_t Read32( const Util::uint8_t * iPtr )
+{
+    Util::uint32_t val;
+    memcpy( &val, iPtr, 4 );
+    return val;
+}
+
+//-*****************************************************************************
+inline void WriteLength( std::size_t iLength, std::vector< char > & oBuffer )
+{
+    while ( iLength >= 255 )
+    {
+        oBuffer.push_back( ( char ) 255 );
+        iLength -= 255;
+    }
+    oBuffer.push_back( ( char ) iLength );
+}
+
+//-*****************************************************************************
+inline void WriteSequence( const Util::uint8_t * iLiterals,
+                           std::size_t iNumLiterals,
+                           std::size_t iOffset,
+                           std::size_t iMatchLength,
+                           std::vector< char > & oBuffer )
+{
+    std::size_t litToken = iNumLiterals < 15 ? iNumLiterals : 15;
+    std::size_t matchToken = 0;
+    if ( iMatchLength != 0 )
+    {
+        matchToken = iMatchLength - kMinMatch;
+        matchToken = matchToken < 15 ? matchToken : 15;
+    }
+
+    oBuffer.push_back( ( char )( ( litToken << 4 ) | matchToken ) );
+
+    if ( litToken == 15 )
+    {
+        WriteLength( iNumLiterals - 15, oBuffer );
+    }
+
+    oBuffer.insert( oBuffer.end(), iLiterals, iLiterals + iNumLiterals );
+
+    if ( iMatchLength != 0 )
+    {
+        oBuffer.push_back( ( char )( iOffset & 0xff ) );
+        oBuffer.push_back( ( char )( iOffset >> 8 ) );
+
+        if ( matchToken == 15 )
+        {
+            WriteLength( iMatchLength - kMinMatch - 15, oBuffer );
+        }
+    }
+}
+
+//-*****************************************************************************
+// reads one of the extended lengths, returns false if we run out of buffer
+inline bool ReadLength( const Util::uint8_t *& ioPtr,
+                        const Util::uint8_t * iEnd,
+                        std::size_t & ioLength )
+{
+    Util::uint8_t val = 255;
+    while ( val == 255 )
+    {
+        if ( ioPtr >= iEnd )
+        {
+            return false;
+        }
+        val = *ioPtr++;
+        ioLength += val;
+    }
+    return true;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+bool CompressData( const void * iData,
+                   std::size_t iSize,
+                   std::size_t iElementSize,
+                   int iLevel,
+                   std::vector< char > & oBuffer )
+{
+    oBuffer.clear();
+
+    if ( iSize <= kTailLiterals + kMinMatch )
+    {
+        return false;
+    }
+
+    if ( iElementSize == 0 || iElementSize > 255 || iElementSize > iSize )
+    {
+        iElementSize = 1;
+    }
+
+    // regroup the bytes, byte 0 of every element, then byte 1 and so on
+    const Util::uint8_t * src = static_cast< const Util::uint8_t * >( iData );
+    std::vector< Util::uint8_t > shuffled;
+    if ( iElementSize > 1 )
+    {
+        shuffled.resize( iSize );
+        std::size_t numElements = iSize / iElementSize;
+        for ( std::size_t i = 0; i < numElements; ++i )
+        {
+            for ( std::size_t b = 0; b < iElementSize; ++b )
+            {
+                shuffled[ b * numElements + i ] = src[ i * iElementSize + b ];
+            }
+        }
+
+        // whatever doesn't make up a whole element is left alone at the end
+        std::size_t numShuffled = numElements * iElementSize;
+        memcpy( &shuffled[ numShuffled ], src + numShuffled,
+                iSize - numShuffled );
+        src = &shuffled.front();
+    }
+
+    oBuffer.reserve( iSize );
+    oBuffer.push_back( ( char ) iElementSize );
+
+    // a table with more than about two slots per byte of input doesn't find
+    // any more matches, it just takes longer to clear
+    int level = iLevel < 0 ? 0 : ( iLevel > 9 ? 9 : iLevel );
+    std::size_t maxBits = 12 + level;
+    std::size_t hashBits = 1;
+    while ( hashBits < maxBits && ( std::size_t( 1 ) << hashBits ) < iSize )
+    {
+        ++hashBits;
+    }
+    hashBits = std::min( hashBits + 1, maxBits );
+
+    // kept around from one sample to the next, so only the first sample on
+    // each thread, or one bigger than those before it, has to allocate
+    static thread_local std::vector< Util::uint32_t > table;
+    table.assign( std::size_t( 1 ) << hashBits, 0 );
+
+    std::size_t anchor = 0;
+    std::size_t pos = 0;
+    std::size_t limit = iSize - kTailLiterals;
+
+    while ( pos < limit )
+    {
+        Util::uint32_t seq = Read32( src + pos );
+        Util::uint32_t hash = ( seq * 2654435761U ) >> ( 32 - hashBits );
+
+        // positions are stored + 1 so 0 means nothing is there yet
+        std::size_t ref = table[ hash ];
+        table[ hash ] = ( Util::uint32_t )( pos + 1 );
+
+        if ( ref == 0 || pos - ( ref - 1 ) > kMaxOffset ||
+             Read32( src + ref - 1 ) != seq )
+        {
+            ++pos;
+            continue;
+        }
+
+        ref -= 1;
+        std::size_t length = kMinMatch;
+        while ( pos + length < limit &&
+                src[ ref + length ] == src[ pos + length ] )
+        {
+            ++length;
+        }
+
+        WriteSequence( src + anchor, pos - anchor, pos - ref, length,
+                       oBuffer );
+
+        // bail out early, we aren't going to win
+        if ( oBuffer.size() >= iSize )
+        {
+            return false;
+        }
+
+        pos += length;
+        anchor = pos;
+    }
+
+    WriteSequence( src + anchor, iSize - anchor, 0, 0, oBuffer );
+
+    return oBuffer.size() < iSize;
+}
+
+//-*****************************************************************************
+bool DecompressData( const char * iBuffer,
+                     std::size_t iBufferSize,
+                     void * oData,
+                     std::size_t iSize )
+{
+    if ( iBufferSize < 2 || iSize == 0 )
+    {
+        return false;
+    }
+
+    const Util::uint8_t * ptr =
+        reinterpret_cast< const Util::uint8_t * >( iBuffer );
+    const Util::uint8_t * end = ptr + iBufferSize;
+
+    std::size_t elementSize = *ptr++;
+    if ( elementSize == 0 )
+    {
+        return false;
+    }
+
+    std::vector< Util::uint8_t > shuffled;
+    Util::uint8_t * dst = static_cast< Util::uint8_t * >( oData );
+    if ( elementSize > 1 )
+    {
+        shuffled.resize( iSize );
+        dst = &shuffled.front();
+    }
+
+    std::size_t pos = 0;
+    while ( pos < iSize )
+    {
+        if ( ptr >= end )
+        {
+            return false;
+        }
+
+        Util::uint8_t token = *ptr++;
+
+        std::size_t numLiterals = token >> 4;
+        if ( numLiterals == 15 && !ReadLength( ptr, end, numLiterals ) )
+        {
+            return false;
+        }
+
+        if ( numLiterals > std::size_t( end - ptr ) ||
+             numLiterals > iSize - pos )
+        {
+            return false;
+        }
+
+        memcpy( dst + pos, ptr, numLiterals );
+        ptr += numLiterals;
+        pos += numLiterals;
+
+        // the last sequence has no match
+        if ( pos == iSize )
+        {
+            break;
+        }
+
+        if ( end - ptr < 2 )
+        {
+            return false;
+        }
+
+        std::size_t offset = ptr[0] | ( std::size_t( ptr[1] ) << 8 );
+        ptr += 2;
+
+        std::size_t length = token & 0xf;
+        if ( length == 15 && !ReadLength( ptr, end, length ) )
+        {
+            return false;
+        }
+        length += kMinMatch;
+
+        if ( offset == 0 || offset > pos || length > iSize - pos )
+        {
+            return false;
+        }
+
+        // the match may overlap what it is writing, so go a byte at a time
+        const Util::uint8_t * match = dst + pos - offset;
+        for ( std::size_t i = 0; i < length; ++i )
+        {
+            dst[ pos + i ] = match[ i ];
+        }
+        pos += length;
+    }
+
+    if ( ptr != end )
+    {
+        return false;
+    }
+
+    if ( elementSize > 1 )
+    {
+        if ( elementSize > iSize )
+        {
+            return false;
+        }
+
+        Util::uint8_t * out = static_cast< Util::uint8_t * >( oData );
+        std::size_t numElements = iSize / elementSize;
+        for ( std::size_t i = 0; i < numElements; ++i )
+        {
+            for ( std::size_t b = 0; b < elementSize; ++b )
+            {
+                out[ i * elementSize + b ] = dst[ b * numElements + i ];
+            }
+        }
+
+        std::size_t numShuffled = numElements * elementSize;
+        memcpy( out + numShuffled, dst + numShuffled, iSize - numShuffled );
+    }
+
+    return true;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
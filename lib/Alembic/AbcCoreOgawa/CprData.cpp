@@ -65,10 +65,17 @@ CprData::CprData( Ogawa::IGroupPtr iGroup,
         ReadPropertyHeaders( m_group, numChildren - 1, iThreadId,
                              iArchive, iIndexedMetaData, headers );
 
+        ArImpl * archive = dynamic_cast< ArImpl * >( &iArchive );
+        if ( archive )
+        {
+            archive->count( ArImpl::kPropertyHeaders, headers.size() );
+        }
+
         m_propertyHeaders = new SubProperty[ headers.size() ];
+        m_subProperties.reserve( headers.size() );
         for ( std::size_t i = 0; i < headers.size(); ++i )
         {
-            m_subProperties[headers[i]->header.getName()] = i;
+            m_subProperties.set( headers[i]->header.getName(), i );
             m_propertyHeaders[i].header = headers[i];
         }
     }
@@ -108,13 +115,13 @@ CprData::getPropertyHeader( AbcA::CompoundPropertyReaderPtr iParent,
 {
     // map of names to indexes filled by ctor (CprAttrVistor),
     // so multithread safe.
-    SubPropertiesMap::iterator fiter = m_subProperties.find( iName );
-    if ( fiter == m_subProperties.end() )
+    std::size_t index = 0;
+    if ( !m_subProperties.find( iName, index ) )
     {
         return NULL;
     }
 
-    return &(getPropertyHeader(iParent, fiter->second));
+    return &(getPropertyHeader(iParent, index));
 }
 
 //-*****************************************************************************
@@ -122,13 +129,13 @@ AbcA::ScalarPropertyReaderPtr
 CprData::getScalarProperty( AbcA::CompoundPropertyReaderPtr iParent,
                             const std::string &iName )
 {
-    SubPropertiesMap::iterator fiter = m_subProperties.find( iName );
-    if ( fiter == m_subProperties.end() )
+    std::size_t index = 0;
+    if ( !m_subProperties.find( iName, index ) )
     {
         return AbcA::ScalarPropertyReaderPtr();
     }
 
-    SubProperty & sub = m_propertyHeaders[fiter->second];
+    SubProperty & sub = m_propertyHeaders[index];
 
     if ( !(sub.header->header.isScalar()) )
     {
@@ -137,15 +144,23 @@ CprData::getScalarProperty( AbcA::CompoundPropertyReaderPtr iParent,
                     << sub.header->header.getPropertyType() );
     }
 
-    Alembic::Util::scoped_lock l( sub.lock );
+    // usually it has already been made
     AbcA::BasePropertyReaderPtr bptr = sub.made.lock();
+    if ( bptr )
+    {
+        return Alembic::Util::dynamic_pointer_cast<AbcA::ScalarPropertyReader,
+            AbcA::BasePropertyReader>( bptr );
+    }
+
+    Alembic::Util::scoped_lock l( sub.lock );
+    bptr = sub.made.lock();
     if ( ! bptr )
     {
         StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
             AbcA::ArchiveReader > (
                 iParent->getObject()->getArchive() )->getStreamID();
 
-        Ogawa::IGroupPtr group = m_group->getGroup( fiter->second, true,
+        Ogawa::IGroupPtr group = m_group->getGroup( index, true,
                                                     streamId->getID() );
 
         ABCA_ASSERT( group, "Scalar Property not backed by a valid group.");
@@ -153,7 +168,7 @@ CprData::getScalarProperty( AbcA::CompoundPropertyReaderPtr iParent,
         // Make a new one.
         bptr = Alembic::Util::shared_ptr<SprImpl>(
             new SprImpl( iParent, group, sub.header ) );
-        sub.made = bptr;
+        sub.made.store( bptr );
     }
 
     AbcA::ScalarPropertyReaderPtr ret =
@@ -169,13 +184,13 @@ CprData::getArrayProperty( AbcA::CompoundPropertyReaderPtr iParent,
 {
     // map of names to indexes filled by ctor (CprAttrVistor),
     // so multithread safe.
-    SubPropertiesMap::iterator fiter = m_subProperties.find( iName );
-    if ( fiter == m_subProperties.end() )
+    std::size_t index = 0;
+    if ( !m_subProperties.find( iName, index ) )
     {
         return AbcA::ArrayPropertyReaderPtr();
     }
 
-    SubProperty & sub = m_propertyHeaders[fiter->second];
+    SubProperty & sub = m_propertyHeaders[index];
 
     if ( !(sub.header->header.isArray()) )
     {
@@ -184,15 +199,23 @@ CprData::getArrayProperty( AbcA::CompoundPropertyReaderPtr iParent,
                     << sub.header->header.getPropertyType() );
     }
 
-    Alembic::Util::scoped_lock l( sub.lock );
+    // usually it has already been made
     AbcA::BasePropertyReaderPtr bptr = sub.made.lock();
+    if ( bptr )
+    {
+        return Alembic::Util::dynamic_pointer_cast<AbcA::ArrayPropertyReader,
+            AbcA::BasePropertyReader>( bptr );
+    }
+
+    Alembic::Util::scoped_lock l( sub.lock );
+    bptr = sub.made.lock();
     if ( ! bptr )
     {
         StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
             AbcA::ArchiveReader > (
                 iParent->getObject()->getArchive() )->getStreamID();
 
-        Ogawa::IGroupPtr group = m_group->getGroup( fiter->second, true,
+        Ogawa::IGroupPtr group = m_group->getGroup( index, true,
                                                     streamId->getID() );
 
         ABCA_ASSERT( group, "Array Property not backed by a valid group.");
@@ -201,7 +224,7 @@ CprData::getArrayProperty( AbcA::CompoundPropertyReaderPtr iParent,
         bptr = Alembic::Util::shared_ptr<AprImpl>(
             new AprImpl( iParent, group, sub.header ) );
 
-        sub.made = bptr;
+        sub.made.store( bptr );
     }
 
     AbcA::ArrayPropertyReaderPtr ret =
@@ -217,13 +240,13 @@ CprData::getCompoundProperty( AbcA::CompoundPropertyReaderPtr iParent,
 {
     // map of names to indexes filled by ctor (CprAttrVistor),
     // so multithread safe.
-    SubPropertiesMap::iterator fiter = m_subProperties.find( iName );
-    if ( fiter == m_subProperties.end() )
+    std::size_t index = 0;
+    if ( !m_subProperties.find( iName, index ) )
     {
         return AbcA::CompoundPropertyReaderPtr();
     }
 
-    SubProperty & sub = m_propertyHeaders[fiter->second];
+    SubProperty & sub = m_propertyHeaders[index];
 
     if ( !(sub.header->header.isCompound()) )
     {
@@ -232,9 +255,23 @@ CprData::getCompoundProperty( AbcA::CompoundPropertyReaderPtr iParent,
                     << sub.header->header.getPropertyType() );
     }
 
-    Alembic::Util::scoped_lock l( sub.lock );
+    // usually it has already been made
     AbcA::BasePropertyReaderPtr bptr = sub.made.lock();
-    if ( ! bptr )
+    if ( bptr )
+    {
+        return Alembic::Util::dynamic_pointer_cast<AbcA::CompoundPropertyReader,
+            AbcA::BasePropertyReader>( bptr );
+    }
+
+    Alembic::Util::scoped_lock l( sub.lock );
+    bptr = sub.made.lock();
+    if ( ! bptr && sub.data )
+    {
+        bptr = Alembic::Util::shared_ptr<CprImpl>(
+            new CprImpl( iParent, sub.data, sub.header ) );
+        sub.made.store( bptr );
+    }
+    else if ( ! bptr )
     {
         Alembic::Util::shared_ptr<  ArImpl > implPtr =
             Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader > (
@@ -242,7 +279,7 @@ CprData::getCompoundProperty( AbcA::CompoundPropertyReaderPtr iParent,
 
         StreamIDPtr streamId = implPtr->getStreamID();
 
-        Ogawa::IGroupPtr group = m_group->getGroup( fiter->second, false,
+        Ogawa::IGroupPtr group = m_group->getGroup( index, false,
                                                     streamId->getID() );
 
         ABCA_ASSERT( group, "Compound Property not backed by a valid group.");
@@ -252,7 +289,7 @@ CprData::getCompoundProperty( AbcA::CompoundPropertyReaderPtr iParent,
             new CprImpl( iParent, group, sub.header, streamId->getID(),
                          implPtr->getIndexedMetaData() ) );
 
-        sub.made = bptr;
+        sub.made.store( bptr );
     }
 
     AbcA::CompoundPropertyReaderPtr ret =
@@ -261,6 +298,34 @@ CprData::getCompoundProperty( AbcA::CompoundPropertyReaderPtr iParent,
     return ret;
 }
 
+//-*****************************************************************************
+CprDataPtr CprData::preloadCompound( size_t i,
+                                     AbcA::ArchiveReader & iArchive,
+                                     size_t iThreadId )
+{
+    ABCA_ASSERT( i < m_subProperties.size(),
+        "Out of range index in CprData::preloadCompound: " << i );
+
+    SubProperty & sub = m_propertyHeaders[i];
+    if ( !sub.header->header.isCompound() )
+    {
+        return CprDataPtr();
+    }
+
+    ArImpl * archive = dynamic_cast< ArImpl * >( &iArchive );
+    ABCA_ASSERT( archive, "Invalid archive in CprData::preloadCompound" );
+
+    Ogawa::IGroupPtr group = m_group->getGroup( i, false, iThreadId );
+    ABCA_ASSERT( group, "Compound Property not backed by a valid group.");
+
+    CprDataPtr data( new CprData( group, iThreadId, iArchive,
+                                  archive->getIndexedMetaData() ) );
+
+    Alembic::Util::scoped_lock l( sub.lock );
+    sub.data = data;
+    return data;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
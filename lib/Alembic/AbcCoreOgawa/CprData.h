@@ -77,6 +77,14 @@ public:
     getCompoundProperty( AbcA::CompoundPropertyReaderPtr iParent,
                          const std::string &iName );
 
+    // Reads sub property i ahead of it being asked for, and hangs on to it
+    // for getCompoundProperty, see ReadArchive::setPreloadHierarchy.
+    // Returns NULL if it isn't a compound property, and throws if it can't
+    // be read, leaving it to be read when it is asked for instead.
+    Alembic::Util::shared_ptr< CprData >
+    preloadCompound( size_t i, AbcA::ArchiveReader & iArchive,
+                     size_t iThreadId );
+
 private:
     Ogawa::IGroupPtr m_group;
 
@@ -86,12 +94,13 @@ private:
         PropertyHeaderPtr header;
         WeakBprPtr made;
         Alembic::Util::mutex lock;
-    };
 
-    typedef std::map<std::string, size_t> SubPropertiesMap;
+        // set when a compound property was preloaded
+        Alembic::Util::shared_ptr< CprData > data;
+    };
 
     SubProperty * m_propertyHeaders;
-    SubPropertiesMap m_subProperties;
+    Alembic::Util::NameIndex m_subProperties;
 };
 
 typedef Alembic::Util::shared_ptr<CprData> CprDataPtr;
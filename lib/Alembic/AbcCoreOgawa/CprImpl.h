@@ -61,6 +61,11 @@ public:
     CprImpl( AbcA::ObjectReaderPtr iParent,
              CprDataPtr iData );
 
+    // for a compound whose data was already read
+    CprImpl( AbcA::CompoundPropertyReaderPtr iParent,
+             CprDataPtr iData,
+             PropertyHeaderPtr iHeader );
+
     virtual ~CprImpl();
 
     //-*************************************************************************
@@ -137,12 +137,18 @@ CpwData::createScalarProperty( AbcA::CompoundPropertyWriterPtr iParent,
     PropertyHeaderPtr headerPtr( new PropertyHeaderAndFriends( iName,
         AbcA::kScalarProperty, iMetaData, iDataType, ts, iTimeSamplingIndex ) );
 
-    Alembic::Util::shared_ptr<SpwImpl>
-        ret( new SpwImpl( iParent, m_group->addGroup(), headerPtr,
-                          m_propertyHeaders.size() ) );
+    // declared first so it goes away after the lock if anything throws
+    Alembic::Util::shared_ptr<SpwImpl> ret;
+    ChangeLock change( iParent->getObject()->getArchive() );
+
+    Ogawa::OGroupPtr group = m_group->addGroup();
+    ret.reset( new SpwImpl( iParent, group, headerPtr,
+                           m_propertyHeaders.size() ) );
 
     m_propertyHeaders.push_back( headerPtr );
     m_madeProperties[iName] = WeakBpwPtr( ret );
+    m_propertyGroups.push_back( group );
+    m_propertyData.push_back( Util::weak_ptr< CpwData >() );
 
     m_hashes.push_back(0);
     m_hashes.push_back(0);
@@ -179,12 +185,18 @@ CpwData::createArrayProperty( AbcA::CompoundPropertyWriterPtr iParent,
     PropertyHeaderPtr headerPtr( new PropertyHeaderAndFriends( iName,
         AbcA::kArrayProperty, iMetaData, iDataType, ts, iTimeSamplingIndex ) );
 
-    Alembic::Util::shared_ptr<ApwImpl>
-        ret( new ApwImpl( iParent, m_group->addGroup(), headerPtr,
-                          m_propertyHeaders.size() ) );
+    // declared first so it goes away after the lock if anything throws
+    Alembic::Util::shared_ptr<ApwImpl> ret;
+    ChangeLock change( iParent->getObject()->getArchive() );
+
+    Ogawa::OGroupPtr group = m_group->addGroup();
+    ret.reset( new ApwImpl( iParent, group, headerPtr,
+                           m_propertyHeaders.size() ) );
 
     m_propertyHeaders.push_back( headerPtr );
     m_madeProperties[iName] = WeakBpwPtr( ret );
+    m_propertyGroups.push_back( group );
+    m_propertyData.push_back( Util::weak_ptr< CpwData >() );
 
     m_hashes.push_back(0);
     m_hashes.push_back(0);
@@ -206,12 +218,17 @@ CpwData::createCompoundProperty( AbcA::CompoundPropertyWriterPtr iParent,
    PropertyHeaderPtr headerPtr( new PropertyHeaderAndFriends( iName,
                                 iMetaData ) );
 
-    Alembic::Util::shared_ptr<CpwImpl>
-        ret( new CpwImpl( iParent, m_group->addGroup(), headerPtr,
-                          m_propertyHeaders.size() ) );
+    // declared first so it goes away after the lock if anything throws
+    Alembic::Util::shared_ptr<CpwImpl> ret;
+    ChangeLock change( iParent->getObject()->getArchive() );
+
+    ret.reset( new CpwImpl( iParent, m_group->addGroup(), headerPtr,
+                            m_propertyHeaders.size() ) );
 
     m_propertyHeaders.push_back( headerPtr );
     m_madeProperties[iName] = WeakBpwPtr( ret );
+    m_propertyGroups.push_back( Util::weak_ptr< Ogawa::OGroup >() );
+    m_propertyData.push_back( ret->m_data );
 
     m_hashes.push_back(0);
     m_hashes.push_back(0);
@@ -219,15 +236,103 @@ CpwData::createCompoundProperty( AbcA::CompoundPropertyWriterPtr iParent,
     return ret;
 }
 
+//-*****************************************************************************
+void CpwData::freeze()
+{
+    m_group->freeze();
+}
+
 //-*****************************************************************************
 void CpwData::writePropertyHeaders( MetaDataMapPtr iMetaDataMap )
 {
-    // pack in child header and other info
     std::vector< Util::uint8_t > data;
+    packPropertyHeaders( iMetaDataMap, data );
+
+    if ( !data.empty() )
+    {
+        m_group->addData( data.size(), &( data.front() ) );
+    }
+}
+
+//-*****************************************************************************
+Ogawa::OGroupPtr CpwData::writeSnapshot( MetaDataMapPtr iMetaDataMap,
+    std::vector< AbcA::index_t > & ioMaxSamples )
+{
+    // closed, which means the max samples were already handed to the archive
+    if ( m_group->isFrozen() )
+    {
+        return m_group;
+    }
+
+    Ogawa::OGroupPtr group = m_group->snapshot();
+
+    // the properties which are still being written, the rest are already
+    // frozen and in place.  We go through the data and groups rather than
+    // the property writers since those let go of their weak pointers before
+    // they are done closing.
+    for ( size_t i = 0; i < m_propertyHeaders.size(); ++i )
+    {
+        PropertyHeaderPtr prop = m_propertyHeaders[i];
+
+        Ogawa::OGroupPtr propGroup;
+        if ( prop->header.isCompound() )
+        {
+            CpwDataPtr data = m_propertyData[i].lock();
+            if ( data )
+            {
+                propGroup = data->writeSnapshot( iMetaDataMap, ioMaxSamples );
+            }
+        }
+        else
+        {
+            propGroup = m_propertyGroups[i].lock();
+            if ( propGroup && !propGroup->isFrozen() )
+            {
+                propGroup = propGroup->snapshot();
+                propGroup->freeze();
+            }
+
+            // same as what the property writer will report when it is done
+            Util::uint32_t numSamples = prop->nextSampleIndex;
+            if ( prop->lastChangedIndex == 0 && numSamples > 0 )
+            {
+                numSamples = 1;
+            }
+
+            if ( prop->timeSamplingIndex < ioMaxSamples.size() &&
+                 ioMaxSamples[prop->timeSamplingIndex] < numSamples )
+            {
+                ioMaxSamples[prop->timeSamplingIndex] = numSamples;
+            }
+        }
+
+        if ( propGroup )
+        {
+            group->replaceGroup( i, propGroup );
+        }
+    }
+
+    std::vector< Util::uint8_t > data;
+    packPropertyHeaders( iMetaDataMap, data );
+
+    if ( !data.empty() )
+    {
+        group->addData( data.size(), &( data.front() ) );
+    }
+
+    group->freeze();
+    return group;
+}
+
+//-*****************************************************************************
+void CpwData::packPropertyHeaders( MetaDataMapPtr iMetaDataMap,
+                                   std::vector< Util::uint8_t > & oData )
+{
+    // pack in child header and other info
     for ( size_t i = 0; i < getNumProperties(); ++i )
     {
         PropertyHeaderPtr prop = m_propertyHeaders[i];
-        WritePropertyInfo( data,
+        WritePropertyInfo( oData,
                            prop->header,
                            prop->isScalarLike,
                            prop->isHomogenous,
@@ -237,11 +342,6 @@ void CpwData::writePropertyHeaders( MetaDataMapPtr iMetaDataMap )
                            prop->lastChangedIndex,
                            iMetaDataMap );
     }
-
-    if ( !data.empty() )
-    {
-        m_group->addData( data.size(), &( data.front() ) );
-    }
 }
 
 //-*****************************************************************************
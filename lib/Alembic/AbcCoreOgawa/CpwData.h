@@ -84,6 +84,15 @@ public:
 
     void writePropertyHeaders( MetaDataMapPtr iMetaDataMap );
 
+    // called once nothing else will be added
+    void freeze();
+
+    // writes a frozen copy of the group, with the headers of everything
+    // written so far, see OwData::writeSnapshot
+    Ogawa::OGroupPtr writeSnapshot( MetaDataMapPtr iMetaDataMap,
+                                    std::vector< AbcA::index_t > &
+                                    ioMaxSamples );
+
     void fillHash( size_t iIndex, Util::uint64_t iHash0,
                    Util::uint64_t iHash1 );
 
@@ -91,6 +100,9 @@ public:
 
 private:
 
+    void packPropertyHeaders( MetaDataMapPtr iMetaDataMap,
+                              std::vector< Util::uint8_t > & oData );
+
     // The group corresponding to this property.
     Ogawa::OGroupPtr m_group;
 
@@ -99,6 +111,11 @@ private:
     PropertyHeaderPtrs m_propertyHeaders;
     MadeProperties m_madeProperties;
 
+    // for writeSnapshot, the groups of the scalar and array properties and
+    // the data of the compound ones, by index
+    std::vector< Util::weak_ptr< Ogawa::OGroup > > m_propertyGroups;
+    std::vector< Util::weak_ptr< CpwData > > m_propertyData;
+
     // child hashes
     std::vector< Util::uint64_t > m_hashes;
 };
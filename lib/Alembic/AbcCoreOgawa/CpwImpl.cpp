@@ -36,6 +36,7 @@
 
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
+#include <Alembic/AbcCoreOgawa/WriteUtil.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -89,11 +90,17 @@ CpwImpl::~CpwImpl()
     // as part of their "top" compound
     if ( m_parent )
     {
+        ChangeLock change( getObject()->getArchive() );
+
         MetaDataMapPtr mdMap = Alembic::Util::dynamic_pointer_cast<
             AwImpl, AbcA::ArchiveWriter >(
                 getObject()->getArchive() )->getMetaDataMap();
         m_data->writePropertyHeaders( mdMap );
 
+        // nothing else gets added, and a checkpoint mustn't find the group
+        // gone but not yet in its place in the parent, see ~ApwImpl
+        m_data->freeze();
+
         Util::SpookyHash hash;
         hash.Init( 0, 0 );
         m_data->computeHash( hash );
@@ -110,6 +110,7 @@ public:
                    Util::uint64_t iHash1 );
 
 private:
+    friend class CpwData;
 
     // The object we belong to.
     AbcA::ObjectWriterPtr m_object;
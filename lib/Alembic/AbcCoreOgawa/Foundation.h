@@ -72,8 +72,10 @@ using AbcA::chrono_t;
 typedef Alembic::Util::weak_ptr<AbcA::ObjectWriter> WeakOwPtr;
 typedef Alembic::Util::weak_ptr<AbcA::BasePropertyWriter> WeakBpwPtr;
 
-typedef Alembic::Util::weak_ptr<AbcA::ObjectReader> WeakOrPtr;
-typedef Alembic::Util::weak_ptr<AbcA::BasePropertyReader> WeakBprPtr;
+// the readers are looked up from many threads at once, so these can be
+// locked without taking a mutex
+typedef Alembic::Util::AtomicWeakPtr<AbcA::ObjectReader> WeakOrPtr;
+typedef Alembic::Util::AtomicWeakPtr<AbcA::BasePropertyReader> WeakBprPtr;
 
 //-*****************************************************************************
 struct PropertyHeaderAndFriends
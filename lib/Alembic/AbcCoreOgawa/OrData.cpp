@@ -63,15 +63,22 @@ OrData::OrData( Ogawa::IGroupPtr iGroup,
         ReadObjectHeaders( m_group, numChildren - 1, iThreadId,
                            iParentName, iIndexedMetaData, headers );
 
+        ArImpl * archive = dynamic_cast< ArImpl * >( &iArchive );
+        if ( archive )
+        {
+            archive->count( ArImpl::kObjectHeaders, headers.size() );
+        }
+
         if ( !headers.empty() )
         {
             m_children = Alembic::Util::unique_ptr< Child[] > (
                 new Child[ headers.size() ] );
         }
 
+        m_childIndex.reserve( headers.size() );
         for ( std::size_t i = 0; i < headers.size(); ++i )
         {
-            m_childrenMap[headers[i]->getName()] = i;
+            m_childIndex.set( headers[i]->getName(), i );
             m_children[i].header = headers[i];
         }
     }
@@ -93,15 +100,21 @@ OrData::~OrData()
 AbcA::CompoundPropertyReaderPtr
 OrData::getProperties( AbcA::ObjectReaderPtr iParent )
 {
-    Alembic::Util::scoped_lock l( m_cprlock );
     AbcA::CompoundPropertyReaderPtr ret = m_top.lock();
+    if ( ret )
+    {
+        return ret;
+    }
+
+    Alembic::Util::scoped_lock l( m_cprlock );
+    ret = m_top.lock();
 
     if ( ! ret )
     {
         // time to make a new one
         ret = Alembic::Util::shared_ptr<CprImpl>(
             new CprImpl( iParent, m_data ) );
-        m_top = ret;
+        m_top.store( ret );
     }
 
     return ret;
@@ -110,14 +123,14 @@ OrData::getProperties( AbcA::ObjectReaderPtr iParent )
 //-*****************************************************************************
 size_t OrData::getNumChildren()
 {
-    return m_childrenMap.size();
+    return m_childIndex.size();
 }
 
 //-*****************************************************************************
 const AbcA::ObjectHeader &
 OrData::getChildHeader( AbcA::ObjectReaderPtr iParent, size_t i )
 {
-    ABCA_ASSERT( i < m_childrenMap.size(),
+    ABCA_ASSERT( i < m_childIndex.size(),
         "Out of range index in OrData::getChildHeader: " << i );
 
     return *( m_children[i].header );
@@ -128,49 +141,82 @@ const AbcA::ObjectHeader *
 OrData::getChildHeader( AbcA::ObjectReaderPtr iParent,
                         const std::string &iName )
 {
-    ChildrenMap::iterator fiter = m_childrenMap.find( iName );
-    if ( fiter == m_childrenMap.end() )
+    std::size_t index = 0;
+    if ( !m_childIndex.find( iName, index ) )
     {
         return NULL;
     }
 
-    return & getChildHeader( iParent, fiter->second );
+    return & getChildHeader( iParent, index );
 }
 
 //-*****************************************************************************
 AbcA::ObjectReaderPtr
 OrData::getChild( AbcA::ObjectReaderPtr iParent, const std::string &iName )
 {
-    ChildrenMap::iterator fiter = m_childrenMap.find( iName );
-    if ( fiter == m_childrenMap.end() )
+    std::size_t index = 0;
+    if ( !m_childIndex.find( iName, index ) )
     {
         return AbcA::ObjectReaderPtr();
     }
 
-    return getChild( iParent, fiter->second );
+    return getChild( iParent, index );
 }
 
 //-*****************************************************************************
 AbcA::ObjectReaderPtr
 OrData::getChild( AbcA::ObjectReaderPtr iParent, size_t i )
 {
-    ABCA_ASSERT( i < m_childrenMap.size(),
+    ABCA_ASSERT( i < m_childIndex.size(),
         "Out of range index in OrData::getChild: " << i );
 
-    Alembic::Util::scoped_lock l( m_children[i].lock );
+    // usually it has already been made
     AbcA::ObjectReaderPtr optr = m_children[i].made.lock();
+    if ( optr )
+    {
+        return optr;
+    }
+
+    Alembic::Util::scoped_lock l( m_children[i].lock );
+    optr = m_children[i].made.lock();
 
-    if ( ! optr )
+    if ( ! optr && m_children[i].data )
+    {
+        optr = Alembic::Util::shared_ptr<OrImpl>(
+            new OrImpl( iParent, m_children[i].data, m_children[i].header ) );
+        m_children[i].made.store( optr );
+    }
+    else if ( ! optr )
     {
         // Make a new one.
         optr = Alembic::Util::shared_ptr<OrImpl>(
             new OrImpl( iParent, m_group, i + 1, m_children[i].header ) );
-        m_children[i].made = optr;
+        m_children[i].made.store( optr );
     }
 
     return optr;
 }
 
+//-*****************************************************************************
+OrDataPtr OrData::preloadChild( size_t i, AbcA::ArchiveReader & iArchive,
+                                size_t iThreadId )
+{
+    ABCA_ASSERT( i < m_childIndex.size(),
+        "Out of range index in OrData::preloadChild: " << i );
+
+    ArImpl * archive = dynamic_cast< ArImpl * >( &iArchive );
+    ABCA_ASSERT( archive, "Invalid archive in OrData::preloadChild" );
+
+    Ogawa::IGroupPtr group = m_group->getGroup( i + 1, false, iThreadId );
+    OrDataPtr data( new OrData( group, m_children[i].header->getFullName(),
+        iThreadId, iArchive, archive->getIndexedMetaData() ) );
+
+    Alembic::Util::scoped_lock l( m_children[i].lock );
+    m_children[i].data = data;
+    return data;
+}
+
+//-*****************************************************************************
 void OrData::getPropertiesHash( Util::Digest & oDigest, size_t iThreadId )
 {
     std::size_t numChildren = m_group->getNumChildren();
@@ -78,6 +78,17 @@ public:
 
     void getPropertiesHash( Util::Digest & oDigest, size_t iThreadId );
 
+    // Reads child i ahead of it being asked for, and hangs on to it for
+    // getChild, see ReadArchive::setPreloadHierarchy.  Throws if the child
+    // can't be read, leaving it to be read when it is asked for instead.
+    Alembic::Util::shared_ptr< OrData >
+    preloadChild( size_t i, AbcA::ArchiveReader & iArchive,
+                  size_t iThreadId );
+
+    // the data of our top compound property, which may be NULL
+    Alembic::Util::shared_ptr< CprData > getPropertiesData()
+    { return m_data; }
+
     void getChildrenHash( Util::Digest & oDigest, size_t iThreadId );
 
 private:
@@ -89,16 +100,17 @@ private:
         ObjectHeaderPtr header;
         WeakOrPtr made;
         Alembic::Util::mutex lock;
-    };
 
-    typedef std::map<std::string, size_t> ChildrenMap;
+        // set when the child was preloaded
+        Alembic::Util::shared_ptr< OrData > data;
+    };
 
-    // The children
+    // The children, and where to find them by name
     Alembic::Util::unique_ptr< Child[] > m_children;
-    ChildrenMap m_childrenMap;
+    Alembic::Util::NameIndex m_childIndex;
 
     // Our "top" property.
-    Alembic::Util::weak_ptr< AbcA::CompoundPropertyReader > m_top;
+    Alembic::Util::AtomicWeakPtr< AbcA::CompoundPropertyReader > m_top;
     Alembic::Util::shared_ptr < CprData > m_data;
     Alembic::Util::mutex m_cprlock;
 };
@@ -53,7 +53,8 @@ OrImpl::OrImpl( AbcA::ObjectReaderPtr iParent,
                 Ogawa::IGroupPtr iParentGroup,
                 std::size_t iGroupIndex,
                 ObjectHeaderPtr iHeader )
-    : m_header( iHeader )
+    : m_foundParent( false )
+    , m_header( iHeader )
 {
     m_parent = Alembic::Util::dynamic_pointer_cast< OrImpl,
         AbcA::ObjectReader > (iParent);
@@ -72,11 +73,33 @@ OrImpl::OrImpl( AbcA::ObjectReaderPtr iParent,
         *m_archive, m_archive->getIndexedMetaData() ) );
 }
 
+//-*****************************************************************************
+// Reading as a child of a parent, which already read our data.
+OrImpl::OrImpl( AbcA::ObjectReaderPtr iParent,
+                OrDataPtr iData,
+                ObjectHeaderPtr iHeader )
+    : m_foundParent( false )
+    , m_data( iData )
+    , m_header( iHeader )
+{
+    m_parent = Alembic::Util::dynamic_pointer_cast< OrImpl,
+        AbcA::ObjectReader > (iParent);
+
+    // Check validity of all inputs.
+    ABCA_ASSERT( m_parent, "Invalid parent in OrImpl(Object)" );
+    ABCA_ASSERT( m_data, "Invalid data in OrImpl(Object)" );
+    ABCA_ASSERT( m_header, "Invalid header in OrImpl(Object)" );
+
+    m_archive = m_parent->getArchiveImpl();
+    ABCA_ASSERT( m_archive, "Invalid archive in OrImpl(Object)" );
+}
+
 //-*****************************************************************************
 OrImpl::OrImpl( Alembic::Util::shared_ptr< ArImpl > iArchive,
                 OrDataPtr iData,
                 ObjectHeaderPtr iHeader )
-    : m_archive( iArchive )
+    : m_foundParent( false )
+    , m_archive( iArchive )
     , m_data( iData )
     , m_header( iHeader )
 {
@@ -107,7 +130,35 @@ AbcA::ArchiveReaderPtr OrImpl::getArchive()
 //-*****************************************************************************
 AbcA::ObjectReaderPtr OrImpl::getParent()
 {
-    return m_parent;
+    const std::string & fullName = m_header->getFullName();
+    if ( m_parent || fullName == "/" )
+    {
+        return m_parent;
+    }
+
+    // we were gotten to directly via ArImpl::getObjectByPath
+    if ( m_foundParent.load( std::memory_order_acquire ) )
+    {
+        return m_lookedUpParent;
+    }
+
+    Alembic::Util::scoped_lock l( m_parentLock );
+    if ( !m_foundParent.load( std::memory_order_relaxed ) )
+    {
+        std::size_t pos = fullName.rfind( '/' );
+        std::string parentName = "/";
+        if ( pos != std::string::npos && pos > 0 )
+        {
+            parentName = fullName.substr( 0, pos );
+        }
+
+        m_lookedUpParent = Alembic::Util::dynamic_pointer_cast< OrImpl,
+            AbcA::ObjectReader >( m_archive->getObjectByPath( parentName ) );
+        m_foundParent.store( m_lookedUpParent != NULL,
+                             std::memory_order_release );
+    }
+
+    return m_lookedUpParent;
 }
 
 //-*****************************************************************************
@@ -41,6 +41,8 @@
 #include <Alembic/AbcCoreOgawa/OrData.h>
 #include <Alembic/AbcCoreOgawa/ArImpl.h>
 
+#include <atomic>
+
 namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
@@ -53,6 +55,8 @@ class OrImpl
 
 public:
 
+    // for the top object, or any object the archive went straight to, in
+    // which case the parent is found when first asked for
     OrImpl( Alembic::Util::shared_ptr< ArImpl > iArchive,
             OrDataPtr iData,
             ObjectHeaderPtr iHeader );
@@ -62,6 +66,11 @@ public:
             std::size_t iIndex,
             ObjectHeaderPtr iHeader );
 
+    // for a child whose data was already read
+    OrImpl( AbcA::ObjectReaderPtr iParent,
+            OrDataPtr iData,
+            ObjectHeaderPtr iHeader );
+
     virtual ~OrImpl();
 
     //-*************************************************************************
@@ -96,9 +105,15 @@ private:
 
     Alembic::Util::shared_ptr< ArImpl > getArchiveImpl() const;
 
-    // The parent object
+    // The parent object, which never changes once constructed
     Alembic::Util::shared_ptr< OrImpl > m_parent;
 
+    // the parent of an object the archive went straight to, which is only
+    // looked at once m_foundParent is set
+    Alembic::Util::shared_ptr< OrImpl > m_lookedUpParent;
+    std::atomic< bool > m_foundParent;
+    Alembic::Util::mutex m_parentLock;
+
     Alembic::Util::shared_ptr< ArImpl > m_archive;
 
     OrDataPtr m_data;
@@ -159,12 +159,16 @@ AbcA::ObjectWriterPtr OwData::createChild( AbcA::ObjectWriterPtr iParent,
                                 parentName + iHeader.getName(),
                                 iHeader.getMetaData() ) );
 
-    Alembic::Util::shared_ptr<OwImpl> ret( new OwImpl( iParent,
-                                           m_group->addGroup(),
-                                           header, m_childHeaders.size() ) );
+    // declared first so it goes away after the lock if anything throws
+    Alembic::Util::shared_ptr<OwImpl> ret;
+    ChangeLock change( iParent->getArchive() );
+
+    ret.reset( new OwImpl( iParent, m_group->addGroup(), header,
+                           m_childHeaders.size() ) );
 
     m_childHeaders.push_back( header );
     m_madeChildren[iHeader.getName()] = WeakOwPtr( ret );
+    m_childData.push_back( ret->m_data );
 
     m_hashes.push_back(0);
     m_hashes.push_back(0);
@@ -172,16 +176,79 @@ AbcA::ObjectWriterPtr OwData::createChild( AbcA::ObjectWriterPtr iParent,
     return ret;
 }
 
+//-*****************************************************************************
+Ogawa::OGroupPtr OwData::getGroup()
+{
+    return m_group;
+}
+
 //-*****************************************************************************
 void OwData::writeHeaders( MetaDataMapPtr iMetaDataMap,
                            Util::SpookyHash & ioHash )
 {
     std::vector< Util::uint8_t > data;
+    packHeaders( iMetaDataMap, ioHash, data );
 
+    if ( !data.empty() )
+    {
+        m_group->addData( data.size(), &( data.front() ) );
+    }
+
+    m_data->writePropertyHeaders( iMetaDataMap );
+}
+
+//-*****************************************************************************
+void OwData::freeze()
+{
+    m_data->freeze();
+    m_group->freeze();
+}
+
+//-*****************************************************************************
+Ogawa::OGroupPtr OwData::writeSnapshot( MetaDataMapPtr iMetaDataMap,
+    std::vector< AbcA::index_t > & ioMaxSamples )
+{
+    // closed, everything within is already written
+    if ( m_group->isFrozen() )
+    {
+        return m_group;
+    }
+
+    Ogawa::OGroupPtr group = m_group->snapshot();
+    group->replaceGroup( 0, m_data->writeSnapshot( iMetaDataMap,
+                                                   ioMaxSamples ) );
+
+    // the children which are still being written, the rest are already
+    // frozen and in place, see CpwData::writeSnapshot
+    for ( size_t i = 0; i < m_childData.size(); ++i )
+    {
+        OwDataPtr child = m_childData[i].lock();
+        if ( child )
+        {
+            group->replaceGroup( i + 1, child->writeSnapshot(
+                iMetaDataMap, ioMaxSamples ) );
+        }
+    }
+
+    // the hashes of the children still being written aren't known yet
+    Util::SpookyHash hash;
+    std::vector< Util::uint8_t > data;
+    packHeaders( iMetaDataMap, hash, data );
+    group->addData( data.size(), &( data.front() ) );
+
+    group->freeze();
+    return group;
+}
+
+//-*****************************************************************************
+void OwData::packHeaders( MetaDataMapPtr iMetaDataMap,
+                          Util::SpookyHash & ioHash,
+                          std::vector< Util::uint8_t > & oData )
+{
     // pack all object header into data here
     for ( size_t i = 0; i < m_childHeaders.size(); ++i )
     {
-        WriteObjectHeader( data, *m_childHeaders[i], iMetaDataMap );
+        WriteObjectHeader( oData, *m_childHeaders[i], iMetaDataMap );
     }
 
     Util::SpookyHash dataHash;
@@ -208,19 +275,12 @@ void OwData::writeHeaders( MetaDataMapPtr iMetaDataMap,
     Util::uint8_t * hashData = ( Util::uint8_t * ) hashes;
     for ( size_t i = 0; i < 32; ++i )
     {
-        data.push_back( hashData[i] );
+        oData.push_back( hashData[i] );
     }
 
     // now update childHash with dataHash
     // SpookyHash has the nice property that Final doesn't invalidate the hash
     ioHash.Update( hashes, 16 );
-
-    if ( !data.empty() )
-    {
-        m_group->addData( data.size(), &( data.front() ) );
-    }
-
-    m_data->writePropertyHeaders( iMetaDataMap );
 }
 
 void OwData::fillHash( std::size_t iIndex, Util::uint64_t iHash0,
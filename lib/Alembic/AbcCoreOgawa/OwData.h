@@ -77,11 +77,26 @@ public:
 
     void writeHeaders( MetaDataMapPtr iMetaDataMap, Util::SpookyHash & ioHash );
 
+    // called once nothing else will be added
+    void freeze();
+
+    // writes a frozen copy of the group, with the headers of everything
+    // written so far, for AwImpl::checkpoint and raises ioMaxSamples to how
+    // many samples the properties within have so far
+    Ogawa::OGroupPtr writeSnapshot( MetaDataMapPtr iMetaDataMap,
+                                    std::vector< AbcA::index_t > &
+                                    ioMaxSamples );
+
     void fillHash( std::size_t iIndex, Util::uint64_t iHash0,
                    Util::uint64_t iHash1 );
 
 private:
 
+    // the child headers followed by the hashes, ioHash ends up with the
+    // hash of the object
+    void packHeaders( MetaDataMapPtr iMetaDataMap, Util::SpookyHash & ioHash,
+                      std::vector< Util::uint8_t > & oData );
+
     // The group corresponding to the object
     Ogawa::OGroupPtr m_group;
 
@@ -92,6 +107,9 @@ private:
     ChildHeaders m_childHeaders;
     MadeChildren m_madeChildren;
 
+    // for writeSnapshot, the data of the children by index
+    std::vector< Alembic::Util::weak_ptr< OwData > > m_childData;
+
     Alembic::Util::weak_ptr< AbcA::CompoundPropertyWriter > m_top;
 
     // Our "top" property
@@ -37,6 +37,7 @@
 #include <Alembic/AbcCoreOgawa/OwImpl.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
+#include <Alembic/AbcCoreOgawa/WriteUtil.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -79,13 +80,26 @@ OwImpl::~OwImpl()
     // The archive is responsible for writing the MetaData
     if ( m_parent )
     {
-        MetaDataMapPtr mdMap = Alembic::Util::dynamic_pointer_cast<
-            AwImpl, AbcA::ArchiveWriter >( m_archive )->getMetaDataMap();
+        ChangeLock change( m_archive );
+
+        Util::shared_ptr< AwImpl > archive =
+            Alembic::Util::dynamic_pointer_cast< AwImpl,
+                AbcA::ArchiveWriter >( m_archive );
+        MetaDataMapPtr mdMap = archive->getMetaDataMap();
 
         Util::SpookyHash hash;
         hash.Init(0, 0);
         m_data->writeHeaders( mdMap, hash );
 
+        // nothing else gets added to our group, so write it out now, which
+        // tells us where it went and keeps a checkpoint from finding it
+        // gone but not yet in its place in the parent, see ~ApwImpl
+        m_data->freeze();
+        if ( archive->usePathIndex() )
+        {
+            archive->addToPathIndex( m_header, m_data->getGroup()->getPos() );
+        }
+
         // writeHeaders bakes in the child hashes and the data hash
         // but we still need to bake in the name and MetaData
         std::string metaDataStr = m_header->getMetaData().serialize();
@@ -93,6 +93,8 @@ public:
                    Util::uint64_t iHash1 );
 
 private:
+    friend class OwData;
+
     // The parent object, NULL if it is the "top" object
     AbcA::ObjectWriterPtr m_parent;
 
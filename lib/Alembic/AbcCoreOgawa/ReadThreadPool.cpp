@@ -0,0 +1,120 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/ReadThreadPool.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+ReadThreadPool::ReadThreadPool( std::size_t iNumThreads )
+  : m_state( new State() )
+{
+    m_threads.reserve( iNumThreads );
+    for ( std::size_t i = 0; i < iNumThreads; ++i )
+    {
+        m_threads.push_back( std::thread( &ReadThreadPool::work, m_state ) );
+    }
+}
+
+//-*****************************************************************************
+ReadThreadPool::~ReadThreadPool()
+{
+    {
+        std::lock_guard< std::mutex > l( m_state->lock );
+        m_state->stop = true;
+    }
+    m_state->changed.notify_all();
+
+    std::thread::id self = std::this_thread::get_id();
+    for ( std::size_t i = 0; i < m_threads.size(); ++i )
+    {
+        // we can't wait on ourselves, this thread returns once the task
+        // which let go of the archive is done
+        if ( m_threads[i].get_id() == self )
+        {
+            m_threads[i].detach();
+        }
+        else
+        {
+            m_threads[i].join();
+        }
+    }
+}
+
+//-*****************************************************************************
+void ReadThreadPool::submit( TaskPtr iTask )
+{
+    {
+        std::lock_guard< std::mutex > l( m_state->lock );
+        m_state->tasks.push_back( iTask );
+    }
+    m_state->changed.notify_one();
+}
+
+//-*****************************************************************************
+void ReadThreadPool::work( StatePtr iState )
+{
+    for ( ;; )
+    {
+        TaskPtr task;
+        {
+            std::unique_lock< std::mutex > l( iState->lock );
+            while ( iState->tasks.empty() && !iState->stop )
+            {
+                iState->changed.wait( l );
+            }
+
+            if ( iState->tasks.empty() )
+            {
+                return;
+            }
+
+            task.swap( iState->tasks.front() );
+            iState->tasks.pop_front();
+        }
+
+        task->run();
+
+        // releasing the task may destroy the pool, so don't hold the lock
+        task.reset();
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
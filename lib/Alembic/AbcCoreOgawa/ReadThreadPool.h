@@ -0,0 +1,111 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreOgawa_ReadThreadPool_h
+#define Alembic_AbcCoreOgawa_ReadThreadPool_h
+
+#include <Alembic/AbcCoreOgawa/Foundation.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! A fixed number of threads which run the sample reads handed to
+//! getSampleAsync, so that many reads can wait on storage at the same time
+//! while the caller carries on.  They also read the hierarchy when it is
+//! preloaded, in which case the archive waits for them while it is opened.
+//! Tasks hold on to the property they read from, and with it the archive
+//! which owns the pool, so the pool may be destroyed from one of its own
+//! threads once the last task lets go of the archive.
+class ReadThreadPool : Alembic::Util::noncopyable
+{
+public:
+    class Task
+    {
+    public:
+        virtual ~Task() {}
+
+        // must not throw, any error belongs in whatever the task reports to
+        virtual void run() = 0;
+    };
+
+    typedef Alembic::Util::shared_ptr< Task > TaskPtr;
+
+    explicit ReadThreadPool( std::size_t iNumThreads );
+
+    // lets the threads finish the queued tasks, and waits for them to do so
+    // unless it is called from one of them
+    ~ReadThreadPool();
+
+    void submit( TaskPtr iTask );
+
+    std::size_t getNumThreads() const { return m_threads.size(); }
+
+private:
+    // shared with the threads, so that a thread which destroyed the pool
+    // can still finish safely
+    struct State
+    {
+        State() : stop( false ) {}
+
+        std::mutex lock;
+        std::condition_variable changed;
+        std::deque< TaskPtr > tasks;
+        bool stop;
+    };
+
+    typedef Alembic::Util::shared_ptr< State > StatePtr;
+
+    static void work( StatePtr iState );
+
+    StatePtr m_state;
+    std::vector< std::thread > m_threads;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
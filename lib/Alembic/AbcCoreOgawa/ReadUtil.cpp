@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/ReadUtil.h>
+#include <Alembic/AbcCoreOgawa/Compression.h>
 
 #if defined(_MSC_VER)
 #  if defined(max)
@@ -47,86 +48,238 @@
 
 #include <half.h>
 
+#include <algorithm>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+Util::uint64_t
+ReadDataSize( const Ogawa::IDataHandle & iData, size_t iThreadId )
+{
+    if ( !iData.isCompressed() )
+    {
+        return iData.getSize();
+    }
+
+    // the key, followed by the uncompressed size, then the compressed data
+    ABCA_ASSERT( iData.getSize() > 24,
+        "Read invalid: compressed data is too small." );
+
+    Util::uint64_t size = 0;
+    iData.read( 8, &size, 16, iThreadId );
+
+    // each compressed byte can't expand to more than 255 bytes
+    ABCA_ASSERT( size / 256 <= iData.getSize() - 24,
+        "Read invalid: compressed data size." );
+
+    return size + 16;
+}
+
+//-*****************************************************************************
+// reads iSize bytes of the sample data which follows the key into oBuf,
+// decompressing it if we need to
+static void
+ReadSampleData( const Ogawa::IDataHandle & iData,
+                size_t iThreadId,
+                std::size_t iSize,
+                void * oBuf )
+{
+    if ( !iData.isCompressed() )
+    {
+        iData.read( iSize, oBuf, 16, iThreadId );
+        return;
+    }
+
+    std::size_t bufSize = iData.getSize() - 24;
+    std::vector< char > buf( bufSize );
+    iData.read( bufSize, &buf.front(), 24, iThreadId );
+
+    ABCA_ASSERT( DecompressData( &buf.front(), bufSize, oBuf, iSize ),
+        "Read invalid: corrupt compressed data." );
+}
+
+//-*****************************************************************************
+// the stored dimensions are read this many ranks at a time, so that we don't
+// need to allocate anything to read them
+static const std::size_t DIMS_CHUNK = 16;
+
 //-*****************************************************************************
 void
-ReadDimensions( Ogawa::IDataPtr iDims,
-                Ogawa::IDataPtr iData,
+ReadDimensions( const Ogawa::IDataHandle & iDims,
+                const Ogawa::IDataHandle & iData,
                 size_t iThreadId,
                 const AbcA::DataType &iDataType,
                 Util::Dimensions & oDim )
 {
     // find it based on of the size of the data
-    if ( iDims->getSize() == 0 )
+    if ( iDims.getSize() == 0 )
     {
-        if ( iData->getSize() == 0 )
-        {
-            oDim = Util::Dimensions( 0 );
-        }
-        else
+        Util::uint64_t dataSize = ReadDataSize( iData, iThreadId );
+        Util::uint64_t numPoints = 0;
+        if ( dataSize != 0 )
         {
-            oDim = Util::Dimensions( ( iData->getSize() - 16 ) /
-                                     iDataType.getNumBytes() );
+            numPoints = ( dataSize - 16 ) / iDataType.getNumBytes();
         }
+
+        // setting the rank is free when oDim is already rank 1
+        oDim.setRank( 1 );
+        oDim[0] = numPoints;
     }
     // we need to read our dimensions
     else
     {
 
         // we write them as uint64_t so / 8
-        std::size_t numRanks = iDims->getSize() / 8;
+        std::size_t numRanks = iDims.getSize() / 8;
 
         oDim.setRank( numRanks );
 
-        std::vector< Util::uint64_t > dims( numRanks );
-        if ( dims.empty() )
+        Util::uint64_t dims[DIMS_CHUNK];
+        for ( std::size_t i = 0; i < numRanks; i += DIMS_CHUNK )
         {
-            return;
+            std::size_t num = std::min( DIMS_CHUNK, numRanks - i );
+            iDims.read( num * 8, dims, i * 8, iThreadId );
+            for ( std::size_t j = 0; j < num; ++j )
+            {
+                oDim[i + j] = dims[j];
+            }
         }
+    }
+}
 
-        iDims->read( numRanks * 8, &( dims.front() ), 0, iThreadId );
-        for ( std::size_t i = 0; i < numRanks; ++i )
+//-*****************************************************************************
+bool
+MatchDimensions( const Ogawa::IDataHandle & iDims,
+                 const Ogawa::IDataHandle & iData,
+                 size_t iThreadId,
+                 const AbcA::DataType &iDataType,
+                 const Util::Dimensions & iDim )
+{
+    if ( iDims.getSize() == 0 )
+    {
+        Util::uint64_t dataSize = ReadDataSize( iData, iThreadId );
+        Util::uint64_t numPoints = 0;
+        if ( dataSize != 0 )
         {
-            oDim[i] = dims[i];
+            numPoints = ( dataSize - 16 ) / iDataType.getNumBytes();
         }
+
+        return iDim.rank() == 1 && iDim[0] == numPoints;
     }
+
+    std::size_t numRanks = iDims.getSize() / 8;
+    if ( numRanks != iDim.rank() )
+    {
+        return false;
+    }
+
+    Util::uint64_t dims[DIMS_CHUNK];
+    for ( std::size_t i = 0; i < numRanks; i += DIMS_CHUNK )
+    {
+        std::size_t num = std::min( DIMS_CHUNK, numRanks - i );
+        iDims.read( num * 8, dims, i * 8, iThreadId );
+        for ( std::size_t j = 0; j < num; ++j )
+        {
+            if ( iDim[i + j] != dims[j] )
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
 }
 
 //-*****************************************************************************
-template < typename FROMPOD >
-void ConvertToBool( char * fromBuffer, void * toBuffer, std::size_t iSize )
+// The conversions below work a chunk of this many values at a time through
+// buffers on the stack, so that the loops doing the actual work never have
+// their input and output overlapping, which lets the compiler vectorize them
+// even when converting in place.
+static const std::size_t CONVERT_CHUNK = 256;
+
+//-*****************************************************************************
+// Converts iNum values from fromBuffer, which toBuffer may start at, into
+// toBuffer using iConvert on each chunk.  When TOPOD is at least as big as
+// FROMPOD we go backwards so that the values which haven't been converted
+// yet don't get clobbered.
+template < typename FROMPOD, typename TOPOD, typename CONVERTER >
+void ConvertInPlace( char * fromBuffer, void * toBuffer, std::size_t iNum,
+                     const CONVERTER & iConvert )
 {
-    std::size_t numConvert = iSize / sizeof( FROMPOD );
+    FROMPOD from[ CONVERT_CHUNK ];
+    TOPOD to[ CONVERT_CHUNK ];
 
-    FROMPOD * fromPodBuffer = ( FROMPOD * ) ( fromBuffer );
-    Util::bool_t * toPodBuffer = (Util::bool_t *) ( toBuffer );
+    char * toPodBuffer = static_cast< char * >( toBuffer );
 
-    for ( std::size_t i = 0; i < numConvert; ++i )
+    std::size_t end = iNum;
+    while ( end > 0 )
     {
-        Util::bool_t t = ( fromPodBuffer[i] != 0 );
-        toPodBuffer[i] = t;
-    }
+        std::size_t start = end > CONVERT_CHUNK ? end - CONVERT_CHUNK : 0;
+        std::size_t num = end - start;
+
+        memcpy( from, fromBuffer + start * sizeof( FROMPOD ),
+                num * sizeof( FROMPOD ) );
+        iConvert( from, to, num );
+        memcpy( toPodBuffer + start * sizeof( TOPOD ), to,
+                num * sizeof( TOPOD ) );
 
+        end = start;
+    }
 }
 
 //-*****************************************************************************
-template < typename TOPOD >
-void ConvertFromBool( char * fromBuffer, void * toBuffer, std::size_t iSize )
+template < typename FROMPOD >
+struct ToBoolConverter
 {
-    // bool_t is stored as 1 bytes so iSize really is the size of the array
+    void operator()( const FROMPOD * iFrom, Util::uint8_t * oTo,
+                     std::size_t iNum ) const
+    {
+        for ( std::size_t i = 0; i < iNum; ++i )
+        {
+            oTo[i] = ( iFrom[i] != 0 );
+        }
+    }
+};
 
-    TOPOD * toPodBuffer = ( TOPOD * ) ( toBuffer );
+//-*****************************************************************************
+template < typename FROMPOD >
+void ConvertToBool( char * fromBuffer, void * toBuffer, std::size_t iSize )
+{
+    std::size_t numConvert = iSize / sizeof( FROMPOD );
 
-    // do it backwards so we don't accidentally clobber over ourself
-    for ( std::size_t i = iSize; i > 0; --i )
+    // bool_t is stored as 1 byte, which is all we need to fill in
+    ConvertInPlace< FROMPOD, Util::uint8_t >( fromBuffer, toBuffer,
+        numConvert, ToBoolConverter< FROMPOD >() );
+}
+
+//-*****************************************************************************
+template < typename TOPOD >
+struct FromBoolConverter
+{
+    void operator()( const Util::uint8_t * iFrom, TOPOD * oTo,
+                     std::size_t iNum ) const
     {
-        TOPOD t = static_cast< TOPOD >( fromBuffer[i-1] != 0 );
-        toPodBuffer[i-1] = t;
+        for ( std::size_t i = 0; i < iNum; ++i )
+        {
+            oTo[i] = static_cast< TOPOD >( iFrom[i] != 0 );
+        }
     }
+};
 
+//-*****************************************************************************
+template < typename TOPOD >
+void ConvertFromBool( char * fromBuffer, void * toBuffer, std::size_t iSize )
+{
+    // bool_t is stored as 1 bytes so iSize really is the size of the array
+    ConvertInPlace< Util::uint8_t, TOPOD >( fromBuffer, toBuffer, iSize,
+        FromBoolConverter< TOPOD >() );
 }
 
 //-*****************************************************************************
@@ -165,14 +318,11 @@ void getMinAndMax<Util::float64_t>(
 }
 
 //-*****************************************************************************
+// The range of FROMPOD values which fit into a TOPOD, anything outside of it
+// gets clamped to it.
 template < typename FROMPOD, typename TOPOD >
-void ConvertData( char * fromBuffer, void * toBuffer, std::size_t iSize )
+void getClampRange( FROMPOD & oMin, FROMPOD & oMax )
 {
-    std::size_t numConvert = iSize / sizeof( FROMPOD );
-
-    FROMPOD * fromPodBuffer = ( FROMPOD * ) ( fromBuffer );
-    TOPOD * toPodBuffer = ( TOPOD * ) ( toBuffer );
-
     if ( sizeof( FROMPOD ) > sizeof( TOPOD ) )
     {
         // get the min and max of the smaller TOPOD type
@@ -181,28 +331,13 @@ void ConvertData( char * fromBuffer, void * toBuffer, std::size_t iSize )
         getMinAndMax< TOPOD >( toPodMin, toPodMax );
 
         // cast it back into the larger FROMPOD
-        FROMPOD podMin = static_cast< FROMPOD >( toPodMin );
-        FROMPOD podMax = static_cast< FROMPOD >( toPodMax );
+        oMin = static_cast< FROMPOD >( toPodMin );
+        oMax = static_cast< FROMPOD >( toPodMax );
 
         // handle from signed to unsigned wrap case
-        if ( podMin > podMax )
-        {
-            podMin = 0;
-        }
-
-        for ( std::size_t i = 0; i < numConvert; ++i )
+        if ( oMin > oMax )
         {
-            FROMPOD f = fromPodBuffer[i];
-            if ( f < podMin )
-            {
-                f = podMin;
-            }
-            else if ( f > podMax )
-            {
-                f = podMax;
-            }
-            TOPOD t = static_cast< TOPOD >( f );
-            toPodBuffer[i] = t;
+            oMin = 0;
         }
     }
     else
@@ -211,40 +346,302 @@ void ConvertData( char * fromBuffer, void * toBuffer, std::size_t iSize )
         TOPOD toPodMax = 0;
         getMinAndMax< TOPOD >( toPodMin, toPodMax);
 
-        FROMPOD podMin = 0;
-        FROMPOD podMax = 0;
-        getMinAndMax< FROMPOD >( podMin, podMax);
+        getMinAndMax< FROMPOD >( oMin, oMax );
 
-        if ( podMin != 0 && toPodMin == 0 )
+        if ( oMin != 0 && toPodMin == 0 )
         {
-            podMin = 0;
+            oMin = 0;
         }
         // adjust max when converting to signed from unsigned of the same
         // sized integral
-        else if ( podMin == 0 && toPodMin != 0 &&
+        else if ( oMin == 0 && toPodMin != 0 &&
                   sizeof( FROMPOD ) == sizeof( TOPOD ) )
         {
-            podMax = static_cast< FROMPOD >( toPodMax );
+            oMax = static_cast< FROMPOD >( toPodMax );
         }
+    }
+}
 
-        // do it backwards so we don't accidentally clobber over ourself
-        for ( std::size_t i = numConvert; i > 0; --i )
+//-*****************************************************************************
+template < typename FROMPOD, typename TOPOD >
+struct ClampConverter
+{
+    FROMPOD podMin;
+    FROMPOD podMax;
+
+    void operator()( const FROMPOD * iFrom, TOPOD * oTo,
+                     std::size_t iNum ) const
+    {
+        // no branches, so that this can be vectorized, NaNs are left alone
+        for ( std::size_t i = 0; i < iNum; ++i )
         {
-            FROMPOD f = fromPodBuffer[i-1];
-            if ( f < podMin )
-            {
-                f = podMin;
-            }
-            else if ( f > podMax )
+            FROMPOD f = iFrom[i];
+            f = ( f < podMin ) ? podMin : f;
+            f = ( f > podMax ) ? podMax : f;
+            oTo[i] = static_cast< TOPOD >( f );
+        }
+    }
+};
+
+//-*****************************************************************************
+template < typename FROMPOD, typename TOPOD >
+void ConvertData( char * fromBuffer, void * toBuffer, std::size_t iSize )
+{
+    std::size_t numConvert = iSize / sizeof( FROMPOD );
+
+    ClampConverter< FROMPOD, TOPOD > convert;
+    getClampRange< FROMPOD, TOPOD >( convert.podMin, convert.podMax );
+
+    if ( sizeof( FROMPOD ) > sizeof( TOPOD ) )
+    {
+        // fromBuffer is a separate buffer, so go straight across
+        convert( ( const FROMPOD * ) fromBuffer, ( TOPOD * ) toBuffer,
+                 numConvert );
+    }
+    else
+    {
+        ConvertInPlace< FROMPOD, TOPOD >( fromBuffer, toBuffer, numConvert,
+                                          convert );
+    }
+}
+
+//-*****************************************************************************
+// Converting between float16 and float32 is common enough, for normals and
+// such, that it is worth using the instructions for it on the CPUs which
+// have them.  Whether they can be used is worked out the first time.
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+
+//-*****************************************************************************
+static bool CheckF16C()
+{
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if ( !__get_cpuid( 1, &eax, &ebx, &ecx, &edx ) )
+    {
+        return false;
+    }
+
+    // F16C, AVX and OSXSAVE
+    const unsigned int needed = ( 1u << 29 ) | ( 1u << 28 ) | ( 1u << 27 );
+    if ( ( ecx & needed ) != needed )
+    {
+        return false;
+    }
+
+    // and the OS has to be saving the AVX registers for us
+    unsigned int xcr0 = 0;
+    __asm__ ( "xgetbv" : "=a" ( xcr0 ), "=d" ( edx ) : "c" ( 0 ) );
+    return ( xcr0 & 6 ) == 6;
+}
+
+//-*****************************************************************************
+static bool HasF16C()
+{
+    static const bool hasF16C = CheckF16C();
+    return hasF16C;
+}
+
+//-*****************************************************************************
+// converts as many values as it can 8 at a time, returning how many
+__attribute__(( target( "avx,f16c" ) ))
+static std::size_t HalfToFloatF16C( const Util::float16_t * iFrom,
+                                    Util::float32_t * oTo,
+                                    std::size_t iNum )
+{
+    const __m256 podMin = _mm256_set1_ps( -HALF_MAX );
+    const __m256 podMax = _mm256_set1_ps( HALF_MAX );
+
+    std::size_t i = 0;
+    for ( ; i + 8 <= iNum; i += 8 )
+    {
+        __m256 f = _mm256_cvtph_ps(
+            _mm_loadu_si128( ( const __m128i * ) ( iFrom + i ) ) );
+
+        // when one is a NaN these give back the second one, so NaNs are kept
+        f = _mm256_min_ps( podMax, _mm256_max_ps( podMin, f ) );
+        _mm256_storeu_ps( oTo + i, f );
+    }
+    return i;
+}
+
+//-*****************************************************************************
+__attribute__(( target( "avx,f16c" ) ))
+static std::size_t FloatToHalfF16C( const Util::float32_t * iFrom,
+                                    Util::float16_t * oTo,
+                                    std::size_t iNum )
+{
+    const __m256 podMin = _mm256_set1_ps( -HALF_MAX );
+    const __m256 podMax = _mm256_set1_ps( HALF_MAX );
+
+    std::size_t i = 0;
+    for ( ; i + 8 <= iNum; i += 8 )
+    {
+        __m256 f = _mm256_loadu_ps( iFrom + i );
+        f = _mm256_min_ps( podMax, _mm256_max_ps( podMin, f ) );
+        _mm_storeu_si128( ( __m128i * ) ( oTo + i ),
+            _mm256_cvtps_ph( f, _MM_FROUND_TO_NEAREST_INT ) );
+    }
+    return i;
+}
+
+#else
+
+//-*****************************************************************************
+static bool HasF16C()
+{
+    return false;
+}
+
+static std::size_t HalfToFloatF16C( const Util::float16_t *,
+                                    Util::float32_t *, std::size_t )
+{
+    return 0;
+}
+
+static std::size_t FloatToHalfF16C( const Util::float32_t *,
+                                    Util::float16_t *, std::size_t )
+{
+    return 0;
+}
+
+#endif
+
+//-*****************************************************************************
+// float16 to float32, clamped to +-HALF_MAX like any other conversion
+struct HalfToFloatConverter
+{
+    void operator()( const Util::float16_t * iFrom, Util::float32_t * oTo,
+                     std::size_t iNum ) const
+    {
+        std::size_t i = HasF16C() ? HalfToFloatF16C( iFrom, oTo, iNum ) : 0;
+        for ( ; i < iNum; ++i )
+        {
+            Util::float32_t f = iFrom[i];
+            f = ( f < -HALF_MAX ) ? -HALF_MAX : f;
+            f = ( f > HALF_MAX ) ? HALF_MAX : f;
+            oTo[i] = f;
+        }
+    }
+};
+
+//-*****************************************************************************
+struct FloatToHalfConverter
+{
+    void operator()( const Util::float32_t * iFrom, Util::float16_t * oTo,
+                     std::size_t iNum ) const
+    {
+        std::size_t i = HasF16C() ? FloatToHalfF16C( iFrom, oTo, iNum ) : 0;
+        for ( ; i < iNum; ++i )
+        {
+            Util::float32_t f = iFrom[i];
+            f = ( f < -HALF_MAX ) ? -HALF_MAX : f;
+            f = ( f > HALF_MAX ) ? HALF_MAX : f;
+            oTo[i] = f;
+        }
+    }
+};
+
+//-*****************************************************************************
+// float16 to float64 goes through float32, as it always has
+struct HalfToDoubleConverter
+{
+    void operator()( const Util::float16_t * iFrom, Util::float64_t * oTo,
+                     std::size_t iNum ) const
+    {
+        Util::float32_t f[ CONVERT_CHUNK ];
+        HalfToFloatConverter()( iFrom, f, iNum );
+        for ( std::size_t i = 0; i < iNum; ++i )
+        {
+            oTo[i] = f[i];
+        }
+    }
+};
+
+//-*****************************************************************************
+// clamped as a float64 before going through float32
+struct DoubleToHalfConverter
+{
+    void operator()( const Util::float64_t * iFrom, Util::float16_t * oTo,
+                     std::size_t iNum ) const
+    {
+        Util::float32_t f[ CONVERT_CHUNK ];
+        for ( std::size_t i = 0; i < iNum; ++i )
+        {
+            Util::float64_t d = iFrom[i];
+            d = ( d < -HALF_MAX ) ? -HALF_MAX : d;
+            d = ( d > HALF_MAX ) ? HALF_MAX : d;
+            f[i] = static_cast< Util::float32_t >( d );
+        }
+        FloatToHalfConverter()( f, oTo, iNum );
+    }
+};
+
+//-*****************************************************************************
+// float16 to anything else is clamped as a float32, rather than comparing
+// float16 values which each go through a float32 anyway
+template < typename TOPOD >
+struct ClampConverter< Util::float16_t, TOPOD >
+{
+    Util::float16_t podMin;
+    Util::float16_t podMax;
+
+    void operator()( const Util::float16_t * iFrom, TOPOD * oTo,
+                     std::size_t iNum ) const
+    {
+        Util::float32_t minVal = podMin;
+        Util::float32_t maxVal = podMax;
+        Util::float32_t f[ CONVERT_CHUNK ];
+        for ( std::size_t start = 0; start < iNum; start += CONVERT_CHUNK )
+        {
+            std::size_t num = std::min( iNum - start, CONVERT_CHUNK );
+            HalfToFloatConverter()( iFrom + start, f, num );
+            for ( std::size_t i = 0; i < num; ++i )
             {
-                f = podMax;
+                Util::float32_t v = f[i];
+                v = ( v < minVal ) ? minVal : v;
+                v = ( v > maxVal ) ? maxVal : v;
+                oTo[ start + i ] = static_cast< TOPOD >( v );
             }
-
-            TOPOD t = static_cast< TOPOD >( f );
-            toPodBuffer[i-1] = t;
         }
     }
+};
+
+//-*****************************************************************************
+template <>
+void ConvertData< Util::float16_t, Util::float32_t >(
+    char * fromBuffer, void * toBuffer, std::size_t iSize )
+{
+    ConvertInPlace< Util::float16_t, Util::float32_t >( fromBuffer, toBuffer,
+        iSize / sizeof( Util::float16_t ), HalfToFloatConverter() );
+}
+
+//-*****************************************************************************
+template <>
+void ConvertData< Util::float16_t, Util::float64_t >(
+    char * fromBuffer, void * toBuffer, std::size_t iSize )
+{
+    ConvertInPlace< Util::float16_t, Util::float64_t >( fromBuffer, toBuffer,
+        iSize / sizeof( Util::float16_t ), HalfToDoubleConverter() );
+}
 
+//-*****************************************************************************
+template <>
+void ConvertData< Util::float32_t, Util::float16_t >(
+    char * fromBuffer, void * toBuffer, std::size_t iSize )
+{
+    // fromBuffer is a separate buffer, so we don't need to go in chunks
+    FloatToHalfConverter()( ( const Util::float32_t * ) fromBuffer,
+                            ( Util::float16_t * ) toBuffer,
+                            iSize / sizeof( Util::float32_t ) );
+}
+
+//-*****************************************************************************
+template <>
+void ConvertData< Util::float64_t, Util::float16_t >(
+    char * fromBuffer, void * toBuffer, std::size_t iSize )
+{
+    // the chunks are for the float32 in between
+    ConvertInPlace< Util::float64_t, Util::float16_t >( fromBuffer, toBuffer,
+        iSize / sizeof( Util::float64_t ), DoubleToHalfConverter() );
 }
 
 //-*****************************************************************************
@@ -1307,10 +1704,38 @@ ConvertData( Alembic::Util::PlainOldDataType fromPod,
     }
 }
 
+//-*****************************************************************************
+void
+ReadStrings( const Ogawa::IDataHandle & iData,
+             size_t iThreadId,
+             Util::StringArena & oStrings )
+{
+    if ( !iData.isValid() )
+    {
+        ABCA_THROW("ReadStrings invalid: Null IDataPtr.");
+    }
+
+    std::size_t dataSize = ReadDataSize( iData, iThreadId );
+
+    if ( dataSize <= 16 )
+    {
+        ABCA_ASSERT( dataSize == 0 || dataSize == 16,
+            "Incorrect data, expected to be empty or to have a key and data");
+        oStrings.clear();
+        return;
+    }
+
+    // the strings are stored the same way the arena keeps them
+    std::size_t numChars = dataSize - 16;
+    ReadSampleData( iData, iThreadId, numChars,
+                    oStrings.resizeChars( numChars ) );
+    oStrings.indexChars();
+}
+
 //-*****************************************************************************
 void
 ReadData( void * iIntoLocation,
-          Ogawa::IDataPtr iData,
+          const Ogawa::IDataHandle & iData,
           size_t iThreadId,
           const AbcA::DataType &iDataType,
           Util::PlainOldDataType iAsPod )
@@ -1323,12 +1748,12 @@ ReadData( void * iIntoLocation,
         curPod != Alembic::Util::kWstringPOD ),
         "Cannot convert the data to or from a string, or wstring." );
 
-    if ( !iData )
+    if ( !iData.isValid() )
     {
         ABCA_THROW("ReadData invalid: Null IDataPtr.");
         return;
     }
-    std::size_t dataSize = iData->getSize();
+    std::size_t dataSize = ReadDataSize( iData, iThreadId );
 
     if ( dataSize < 16 )
     {
@@ -1349,7 +1774,7 @@ ReadData( void * iIntoLocation,
 
         std::size_t numChars = dataSize - 16;
         char * buf = new char[ numChars ];
-        iData->read( numChars, buf, 16, iThreadId );
+        ReadSampleData( iData, iThreadId, numChars, buf );
 
         std::size_t startStr = 0;
         std::size_t strPos = 0;
@@ -1378,7 +1803,7 @@ ReadData( void * iIntoLocation,
 
         std::size_t numChars = ( dataSize - 16 ) / 4;
         Util::uint32_t * buf = new Util::uint32_t[ numChars ];
-        iData->read( dataSize - 16, buf, 16, iThreadId );
+        ReadSampleData( iData, iThreadId, dataSize - 16, buf );
 
         std::size_t strPos = 0;
 
@@ -1402,13 +1827,13 @@ ReadData( void * iIntoLocation,
     else if ( iAsPod == curPod )
     {
         // don't read the key
-        iData->read( dataSize - 16, iIntoLocation, 16, iThreadId );
+        ReadSampleData( iData, iThreadId, dataSize - 16, iIntoLocation );
     }
     else if ( PODNumBytes( curPod ) <= PODNumBytes( iAsPod ) )
     {
         // - 16 to skip key
         std::size_t numBytes = dataSize - 16;
-        iData->read( numBytes, iIntoLocation, 16, iThreadId );
+        ReadSampleData( iData, iThreadId, numBytes, iIntoLocation );
 
         char * buf = static_cast< char * >( iIntoLocation );
         ConvertData( curPod, iAsPod, buf, iIntoLocation, numBytes );
@@ -1421,7 +1846,7 @@ ReadData( void * iIntoLocation,
 
         // read into a temporary buffer and cast them one at a time
         char * buf = new char[ numBytes ];
-        iData->read( numBytes, buf, 16, iThreadId );
+        ReadSampleData( iData, iThreadId, numBytes, buf );
 
         ConvertData( curPod, iAsPod, buf, iIntoLocation, numBytes );
 
@@ -1430,18 +1855,69 @@ ReadData( void * iIntoLocation,
 
 }
 
+//-*****************************************************************************
+namespace {
+
+// Deletes the ArraySample which points into the mapped file, and keeps the
+// mapping alive for as long as the sample is, even past a refresh.
+class MappedArraySampleDeleter
+{
+public:
+    MappedArraySampleDeleter( Ogawa::IStreams::MappingPtr iMapping )
+      : m_mapping( iMapping ) {}
+
+    void operator()( AbcA::ArraySample * iSample )
+    {
+        delete iSample;
+    }
+
+private:
+    Ogawa::IStreams::MappingPtr m_mapping;
+};
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 void
-ReadArraySample( Ogawa::IDataPtr iDims,
-                 Ogawa::IDataPtr iData,
+ReadArraySample( const Ogawa::IDataHandle & iDims,
+                 const Ogawa::IDataHandle & iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
-                 AbcA::ArraySamplePtr &oSample )
+                 AbcA::ArraySamplePtr &oSample,
+                 bool iZeroCopy )
 {
     // get our dimensions
     Util::Dimensions dims;
     ReadDimensions( iDims, iData, iThreadId, iDataType, dims );
 
+    Util::PlainOldDataType pod = iDataType.getPod();
+    if ( iZeroCopy && pod != Util::kStringPOD &&
+         pod != Util::kWstringPOD && !iData.isCompressed() )
+    {
+        // the stored data is exactly what we'd hand back, so if it is in
+        // memory and suitably aligned, point at it instead of copying it
+        std::size_t numBytes = dims.numPoints() * iDataType.getNumBytes();
+        std::size_t dataSize = iData.getSize();
+
+        // - 16 to skip key
+        const void * mapped = NULL;
+        Ogawa::IStreams::MappingPtr mapping;
+        if ( numBytes > 0 && dataSize == numBytes + 16 )
+        {
+            mapped = iData.getMappedData( numBytes, 16, &mapping );
+        }
+
+        if ( mapped != NULL &&
+             reinterpret_cast< std::size_t >( mapped ) %
+             PODNumBytes( pod ) == 0 )
+        {
+            oSample = AbcA::ArraySamplePtr(
+                new AbcA::ArraySample( mapped, iDataType, dims ),
+                MappedArraySampleDeleter( mapping ) );
+            return;
+        }
+    }
+
     oSample = AbcA::AllocateArraySample( iDataType, dims );
 
     ReadData( const_cast<void*>( oSample->getData() ), iData,
@@ -1607,6 +2083,112 @@ ReadObjectHeaders( Ogawa::IGroupPtr iGroup,
     }
 }
 
+//-*****************************************************************************
+bool
+FindInPathIndex( const std::vector< char > & iIndex,
+                 const std::string & iFullName,
+                 const std::vector< AbcA::MetaData > & iMetaDataVec,
+                 Util::uint64_t & oPos,
+                 ObjectHeaderPtr & oHeader )
+{
+    std::size_t bufSize = iIndex.size();
+    if ( bufSize < 8 )
+    {
+        ABCA_THROW("Read invalid: Path index size.");
+    }
+
+    Util::uint64_t numEntries = DerefUnaligned<Util::uint64_t>(&iIndex[0]);
+    if ( numEntries > ( bufSize - 8 ) / 8 )
+    {
+        ABCA_THROW("Read invalid: Path index number of entries.");
+    }
+
+    // the entries are sorted by full name
+    std::size_t pos = 0;
+    std::size_t first = 0;
+    std::size_t last = numEntries;
+    while ( first < last )
+    {
+        std::size_t mid = first + ( last - first ) / 2;
+        Util::uint64_t offset =
+            DerefUnaligned<Util::uint64_t>(&iIndex[8 + mid * 8]);
+        if ( bufSize < 12 || offset > bufSize - 12 )
+        {
+            ABCA_THROW("Read invalid: Path index entry.");
+        }
+
+        Util::uint32_t nameSize =
+            DerefUnaligned<Util::uint32_t>(&iIndex[offset + 8]);
+        std::size_t namePos = offset + 12;
+        if ( nameSize > bufSize - namePos )
+        {
+            ABCA_THROW("Read invalid: Path index name.");
+        }
+
+        int cmp = iFullName.compare( 0, std::string::npos,
+                                     &iIndex[namePos], nameSize );
+        if ( cmp < 0 )
+        {
+            last = mid;
+        }
+        else if ( cmp > 0 )
+        {
+            first = mid + 1;
+        }
+        else
+        {
+            oPos = DerefUnaligned<Util::uint64_t>(&iIndex[offset]);
+            pos = namePos + nameSize;
+            break;
+        }
+    }
+
+    if ( pos == 0 )
+    {
+        return false;
+    }
+
+    if ( pos + 1 > bufSize )
+    {
+        ABCA_THROW("Read invalid: Path index MetaData index.");
+    }
+
+    oHeader.reset( new AbcA::ObjectHeader() );
+    oHeader->setName( iFullName.substr( iFullName.rfind( '/' ) + 1 ) );
+    oHeader->setFullName( iFullName );
+
+    Util::uint8_t metaDataIndex = iIndex[pos++];
+    if ( metaDataIndex == 0xff )
+    {
+        if ( pos + 4 > bufSize )
+        {
+            ABCA_THROW("Read invalid: Path index MetaData size.");
+        }
+
+        Util::uint32_t metaDataSize =
+            DerefUnaligned<Util::uint32_t>(&iIndex[pos]);
+        pos += 4;
+
+        if ( metaDataSize > bufSize - pos )
+        {
+            ABCA_THROW("Read invalid: Path index MetaData string.");
+        }
+
+        std::string metaData( &iIndex[pos], metaDataSize );
+        oHeader->getMetaData().deserialize( metaData );
+    }
+    else if ( metaDataIndex < iMetaDataVec.size() )
+    {
+        oHeader->getMetaData() = iMetaDataVec[metaDataIndex];
+    }
+    else
+    {
+        ABCA_THROW("Read invalid: Path index MetaData index.");
+    }
+
+    return true;
+}
+
 //-*****************************************************************************
 Util::uint32_t GetUint32WithHint(const std::vector< char > & iBuf,
                            std::size_t iBufSize,
@@ -1909,6 +2491,147 @@ ReadIndexedMetaData( Ogawa::IDataPtr iData,
     }
 }
 
+//-*****************************************************************************
+void
+PrefetchSamples( Ogawa::IGroupPtr iGroup,
+                 PropertyHeaderPtr iHeader,
+                 std::size_t iNumPerSample,
+                 index_t iFirstSample,
+                 index_t iLastSample,
+                 size_t iThreadId )
+{
+    index_t numSamples = iHeader->nextSampleIndex;
+    if ( numSamples == 0 )
+    {
+        return;
+    }
+
+    index_t firstSample = std::max< index_t >( iFirstSample, 0 );
+    index_t lastSample = std::min< index_t >( iLastSample, numSamples - 1 );
+    if ( firstSample > lastSample )
+    {
+        return;
+    }
+
+    // repeated samples at either end aren't stored again
+    std::size_t first = iHeader->verifyIndex( firstSample ) * iNumPerSample;
+    std::size_t last = ( iHeader->verifyIndex( lastSample ) + 1 ) *
+        iNumPerSample;
+
+    std::vector< Ogawa::IDataPtr > datas;
+    iGroup->getData( first, last - first, iThreadId, datas );
+    for ( std::size_t i = 0; i < datas.size(); ++i )
+    {
+        if ( datas[i] )
+        {
+            datas[i]->prefetch();
+        }
+    }
+}
+
+//-*****************************************************************************
+void
+VerifySamples( Ogawa::IGroupPtr iGroup,
+               std::size_t iNumPerSample,
+               std::size_t iFirstStored,
+               std::size_t iNumStored,
+               Util::PlainOldDataType iPod,
+               size_t iThreadId,
+               std::vector< std::size_t > & oBadStored,
+               Util::uint64_t & oNumBytes )
+{
+    // strings are stored the same way they are hashed, as their characters
+    // each followed by a null, and wstrings as 32 bit characters
+    std::size_t podSize = 1;
+    if ( iPod == Util::kWstringPOD )
+    {
+        podSize = sizeof( Util::int32_t );
+    }
+    else if ( iPod != Util::kStringPOD )
+    {
+        podSize = Util::PODNumBytes( iPod );
+    }
+
+    // a size that can't be right makes getting the data throw, and then we
+    // can't tell which of them it was
+    std::vector< Ogawa::IDataHandle > datas( iNumStored );
+    try
+    {
+        iGroup->getData( iFirstStored * iNumPerSample, iNumStored,
+                         iNumPerSample, iThreadId, &datas.front() );
+    }
+    catch ( std::exception & )
+    {
+        for ( std::size_t i = 0; i < iNumStored; ++i )
+        {
+            oBadStored.push_back( iFirstStored + i );
+        }
+        return;
+    }
+
+    std::vector< char > buf;
+    for ( std::size_t i = 0; i < iNumStored; ++i )
+    {
+        const Ogawa::IDataHandle & data = datas[i];
+        bool good = false;
+
+        // anything we can't read is as bad as not matching
+        try
+        {
+            Util::uint64_t dataSize = data.isValid() ?
+                ReadDataSize( data, iThreadId ) : 1;
+
+            if ( dataSize == 0 )
+            {
+                // an empty sample, with nothing to check
+                good = true;
+            }
+            else if ( dataSize >= 16 )
+            {
+                Util::Digest digest;
+                data.read( 16, digest.d, 0, iThreadId );
+
+                std::size_t numBytes = dataSize - 16;
+                const void * bytes = NULL;
+                if ( !data.isCompressed() )
+                {
+                    bytes = data.getMappedData( numBytes, 16 );
+                }
+
+                if ( !bytes && numBytes != 0 )
+                {
+                    buf.resize( numBytes );
+                    ReadSampleData( data, iThreadId, numBytes, &buf.front() );
+                    bytes = &buf.front();
+                }
+
+                // the key of a wstring sample has always been taken over
+                // as many bytes as it has characters, so do the same
+                std::size_t numHashed = numBytes;
+                if ( iPod == Util::kWstringPOD )
+                {
+                    numHashed /= sizeof( Util::int32_t );
+                }
+
+                Util::Digest found;
+                Util::MurmurHash3_x64_128( bytes, numHashed, podSize,
+                                           found.words );
+                good = ( found == digest );
+                oNumBytes += numBytes;
+            }
+        }
+        catch ( std::exception & )
+        {
+            good = false;
+        }
+
+        if ( !good )
+        {
+            oBadStored.push_back( iFirstStored + i );
+        }
+    }
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
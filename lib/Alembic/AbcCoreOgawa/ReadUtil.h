@@ -49,28 +49,55 @@ namespace ALEMBIC_VERSION_NS {
 //-*****************************************************************************
 
 //-*****************************************************************************
+// The size of the sample data, key included, as it was before it may have
+// been compressed.
+Util::uint64_t
+ReadDataSize( const Ogawa::IDataHandle & iData, size_t iThreadId );
+
+//-*****************************************************************************
+// oDim is only reallocated if its rank changes
 void
-ReadDimensions( Ogawa::IDataPtr iDims,
-                Ogawa::IDataPtr iData,
+ReadDimensions( const Ogawa::IDataHandle & iDims,
+                const Ogawa::IDataHandle & iData,
                 size_t iThreadId,
                 const AbcA::DataType &iDataType,
                 Util::Dimensions & oDim );
 
+//-*****************************************************************************
+// whether ReadDimensions would give back iDim, without having to build the
+// dimensions to find out
+bool
+MatchDimensions( const Ogawa::IDataHandle & iDims,
+                 const Ogawa::IDataHandle & iData,
+                 size_t iThreadId,
+                 const AbcA::DataType &iDataType,
+                 const Util::Dimensions & iDim );
+
 //-*****************************************************************************
 void
 ReadData( void * iIntoLocation,
-          Ogawa::IDataPtr iData,
+          const Ogawa::IDataHandle & iData,
           size_t iThreadId,
           const AbcA::DataType &iDataType,
           Util::PlainOldDataType iAsPod );
 
 //-*****************************************************************************
+// reads string data straight into oStrings, without a std::string for each
+void
+ReadStrings( const Ogawa::IDataHandle & iData,
+             size_t iThreadId,
+             Util::StringArena & oStrings );
+
+//-*****************************************************************************
+// when iZeroCopy is true the sample may point straight into the memory
+// mapped file, holding onto the mapping to keep it around
 void
-ReadArraySample( Ogawa::IDataPtr iDims,
-                 Ogawa::IDataPtr iData,
+ReadArraySample( const Ogawa::IDataHandle & iDims,
+                 const Ogawa::IDataHandle & iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
-                 AbcA::ArraySamplePtr &oSample );
+                 AbcA::ArraySamplePtr &oSample,
+                 bool iZeroCopy );
 
 //-*****************************************************************************
 void
@@ -96,11 +123,48 @@ ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
                      const std::vector< AbcA::MetaData > & iMetaDataVec,
                      PropertyHeaderPtrs & oHeaders );
 
+//-*****************************************************************************
+// looks for iFullName in the table written by WritePathIndex, filling in
+// where the group of the object is and its header if it is there
+bool
+FindInPathIndex( const std::vector< char > & iIndex,
+                 const std::string & iFullName,
+                 const std::vector< AbcA::MetaData > & iMetaDataVec,
+                 Util::uint64_t & oPos,
+                 ObjectHeaderPtr & oHeader );
+
 //-*****************************************************************************
 void
 ReadIndexedMetaData( Ogawa::IDataPtr iData,
                      std::vector< AbcA::MetaData > & oMetaDataVec );
 
+//-*****************************************************************************
+// hints that samples iFirstSample through iLastSample of a property are about
+// to be read, each sample being iNumPerSample children of iGroup
+void
+PrefetchSamples( Ogawa::IGroupPtr iGroup,
+                 PropertyHeaderPtr iHeader,
+                 std::size_t iNumPerSample,
+                 index_t iFirstSample,
+                 index_t iLastSample,
+                 size_t iThreadId );
+
+//-*****************************************************************************
+// checks the data of iNumStored of the samples stored in iGroup, starting at
+// iFirstStored, against the key written with each of them.  Each sample is
+// iNumPerSample children of iGroup.  The ones which don't match, or can't be
+// read, are added to oBadStored and how many bytes were checked is added to
+// oNumBytes.
+void
+VerifySamples( Ogawa::IGroupPtr iGroup,
+               std::size_t iNumPerSample,
+               std::size_t iFirstStored,
+               std::size_t iNumStored,
+               Util::PlainOldDataType iPod,
+               size_t iThreadId,
+               std::vector< std::size_t > & oBadStored,
+               Util::uint64_t & oNumBytes );
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
@@ -38,6 +38,7 @@
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
 #include <Alembic/AbcCoreOgawa/ArImpl.h>
+#include <Alembic/AbcCoreOgawa/CacheImpl.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -45,6 +46,8 @@ namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 WriteArchive::WriteArchive()
+    : m_bufferSize( 0 ), m_asyncQueueSize( 0 ), m_pathIndex( false )
+    , m_maxDedupBytes( 0 ), m_checkpointInterval( 0 )
 {
 }
 
@@ -54,7 +57,9 @@ WriteArchive::operator()( const std::string &iFileName,
                           const AbcA::MetaData &iMetaData ) const
 {
     Alembic::Util::shared_ptr<AwImpl> archivePtr(
-        new AwImpl( iFileName, iMetaData ) );
+        new AwImpl( iFileName, iMetaData, m_bufferSize,
+                    m_asyncQueueSize, m_pathIndex, m_maxDedupBytes,
+                    m_checkpointInterval ) );
     return archivePtr;
 }
 
@@ -64,15 +69,36 @@ WriteArchive::operator()( std::ostream * iStream,
                           const AbcA::MetaData &iMetaData ) const
 {
     Alembic::Util::shared_ptr<AwImpl> archivePtr(
-        new AwImpl( iStream, iMetaData ) );
+        new AwImpl( iStream, iMetaData, m_bufferSize, m_asyncQueueSize,
+                    m_pathIndex, m_maxDedupBytes, m_checkpointInterval ) );
     return archivePtr;
 }
 
+//-*****************************************************************************
+AbcA::ReadArraySampleCachePtr
+CreateCache( std::size_t iMaxBytes )
+{
+    AbcA::ReadArraySampleCachePtr cachePtr( new CacheImpl( iMaxBytes ) );
+    return cachePtr;
+}
+
+//-*****************************************************************************
+bool RefreshArchive( AbcA::ArchiveReaderPtr iArchive )
+{
+    ArImpl * ptr = dynamic_cast< ArImpl * >( iArchive.get() );
+    return ptr && ptr->refresh();
+}
+
 //-*****************************************************************************
 ReadArchive::ReadArchive()
 {
     m_numStreams = 1;
     m_useMMap = true;
+    m_zeroCopy = false;
+    m_numReadThreads = 8;
+    m_collectStatistics = false;
+    m_preloadHierarchy = false;
+    m_shareFiles = false;
 }
 
 //-*****************************************************************************
@@ -80,11 +106,19 @@ ReadArchive::ReadArchive( size_t iNumStreams, bool iUseMMap )
 {
     m_numStreams = iNumStreams;
     m_useMMap = iUseMMap;
+    m_zeroCopy = false;
+    m_numReadThreads = 8;
+    m_collectStatistics = false;
+    m_preloadHierarchy = false;
+    m_shareFiles = false;
 }
 
 //-*****************************************************************************
 ReadArchive::ReadArchive( const std::vector< std::istream * > & iStreams )
-    : m_numStreams( 1 ), m_useMMap(true), m_streams( iStreams )
+    : m_numStreams( 1 ), m_useMMap(true), m_zeroCopy( false )
+    , m_numReadThreads( 8 ), m_collectStatistics( false )
+    , m_preloadHierarchy( false ), m_shareFiles( false )
+    , m_streams( iStreams )
 {
 }
 
@@ -97,18 +131,23 @@ ReadArchive::operator()( const std::string &iFileName ) const
     if ( m_streams.empty() )
     {
         archivePtr = Alembic::Util::shared_ptr<ArImpl>(
-            new ArImpl( iFileName, m_numStreams, m_useMMap ) );
+            new ArImpl( iFileName, m_numStreams, m_useMMap,
+                        m_zeroCopy, AbcA::ReadArraySampleCachePtr(),
+                        m_numReadThreads, m_collectStatistics,
+                        m_preloadHierarchy, m_shareFiles ) );
     }
     else
     {
         archivePtr = Alembic::Util::shared_ptr<ArImpl>(
-            new ArImpl( m_streams ) );
+            new ArImpl( m_streams, AbcA::ReadArraySampleCachePtr(),
+                        m_numReadThreads, m_collectStatistics,
+                        m_preloadHierarchy ) );
     }
     return archivePtr;
 }
 
 //-*****************************************************************************
-// The given cache is ignored.
+// This version takes a cache from outside.
 AbcA::ArchiveReaderPtr
 ReadArchive::operator()( const std::string &iFileName,
             AbcA::ReadArraySampleCachePtr iCache ) const
@@ -118,12 +157,16 @@ ReadArchive::operator()( const std::string &iFileName,
     if ( m_streams.empty() )
     {
         archivePtr = Alembic::Util::shared_ptr<ArImpl> (
-            new ArImpl( iFileName, m_numStreams, m_useMMap ) );
+            new ArImpl( iFileName, m_numStreams, m_useMMap,
+                        m_zeroCopy, iCache, m_numReadThreads,
+                        m_collectStatistics, m_preloadHierarchy,
+                        m_shareFiles ) );
     }
     else
     {
         archivePtr = Alembic::Util::shared_ptr<ArImpl> (
-            new ArImpl( m_streams ) );
+            new ArImpl( m_streams, iCache, m_numReadThreads,
+                        m_collectStatistics, m_preloadHierarchy ) );
     }
     return archivePtr;
 }
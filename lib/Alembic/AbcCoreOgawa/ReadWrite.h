@@ -46,6 +46,11 @@ namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 //! Will return a shared pointer to the archive writer
+//! Samples can be set on different properties, of the same object or of
+//! different ones, from different threads at once, as long as each property
+//! is only written to by one thread at a time.  Objects and properties can
+//! also be created and closed on different threads, but not two under the
+//! same parent at once.
 class ALEMBIC_EXPORT WriteArchive
 {
 public:
@@ -58,11 +63,98 @@ public:
     ::Alembic::AbcCoreAbstract::ArchiveWriterPtr
     operator()( std::ostream * iStream,
                 const ::Alembic::AbcCoreAbstract::MetaData &iMetaData ) const;
+
+    // Size in bytes of the write combining buffer used by the archive.
+    // The default of 0 hands every write to the stream and flushes it,
+    // otherwise writes are gathered into a buffer of this size and only
+    // written out when it fills up or the archive is closed, which is much
+    // cheaper for lots of small properties.  Something like 4 to 64 MB.
+    void setBufferSize( std::size_t iBufferSize )
+    { m_bufferSize = iBufferSize; }
+
+    std::size_t getBufferSize() const { return m_bufferSize; }
+
+    // When non-zero, the archive hands its full buffers to a background
+    // thread which writes them to the file, so setting samples doesn't wait
+    // on I/O until more than this many bytes are waiting to be written.
+    // If no buffer size was set, a suitable one is picked.
+    // The default of 0 writes on the calling thread.
+    void setAsyncQueueSize( std::size_t iAsyncQueueSize )
+    { m_asyncQueueSize = iAsyncQueueSize; }
+
+    std::size_t getAsyncQueueSize() const { return m_asyncQueueSize; }
+
+    // Whether closing the archive also writes a table of where every object
+    // is within the file, by full name, so that readers can go straight to
+    // an object with ArchiveReader::getObjectByPath instead of walking down
+    // to it.  Readers which don't know about it ignore it.
+    // The default is false.
+    void setPathIndex( bool iPathIndex ) { m_pathIndex = iPathIndex; }
+
+    bool getPathIndex() const { return m_pathIndex; }
+
+    // About how many bytes the archive may use to remember the array
+    // samples it has written, so that when the same sample is written again
+    // it is only referenced instead of being written out again.  Once it is
+    // full, the samples which were least recently written are forgotten, so
+    // memory use stays flat over long exports at the cost of some repeated
+    // samples being written more than once.  Each sample takes 48 bytes.
+    // The default of 0 remembers every sample.
+    void setMaxDedupBytes( std::size_t iMaxBytes )
+    { m_maxDedupBytes = iMaxBytes; }
+
+    std::size_t getMaxDedupBytes() const { return m_maxDedupBytes; }
+
+    // When non-zero, every time about this many bytes have been written
+    // since the last checkpoint, setting a sample also writes a provisional
+    // top of the archive with everything written so far and points the file
+    // at it.  If the process dies before the archive is closed, ReadArchive
+    // can still open the file, as of its last checkpoint.  The checkpoint is
+    // written on whichever thread set the sample first, while samples being
+    // set and objects and properties being made or closed on other threads
+    // wait for it to finish.  The default of 0 never writes a checkpoint.
+    void setCheckpointInterval( std::size_t iNumBytes )
+    { m_checkpointInterval = iNumBytes; }
+
+    std::size_t getCheckpointInterval() const { return m_checkpointInterval; }
+
+private:
+    std::size_t m_bufferSize;
+    std::size_t m_asyncQueueSize;
+    bool m_pathIndex;
+    std::size_t m_maxDedupBytes;
+    std::size_t m_checkpointInterval;
 };
 
+//-*****************************************************************************
+//! AbcCoreOgawa provides a thread safe cache implementation which holds on to
+//! at most iMaxBytes of array sample data, dropping the least recently used
+//! samples first.  Samples with the same contents, such as topology which
+//! doesn't change from frame to frame, are then only read once.
+//! Samples larger than iMaxBytes are never held on to.
+//! The same cache can be handed to several archives, for instance via
+//! AbcCoreFactory::IFactory::setSampleCache.
+ALEMBIC_EXPORT ::Alembic::AbcCoreAbstract::ReadArraySampleCachePtr
+CreateCache( std::size_t iMaxBytes );
+
+//-*****************************************************************************
+//! For an archive which was opened as of a checkpoint, while it was still
+//! being written (see WriteArchive::setCheckpointInterval), this picks up
+//! the latest checkpoint, or the whole archive once the writer has closed
+//! it, without opening it again.  Objects and properties which were gotten
+//! before keep seeing the archive as it was, those gotten from getTop
+//! afterwards see what has been written since, including how many samples
+//! each property now has.  It mustn't be called while the archive is being
+//! read on other threads, though other archives sharing the same file (see
+//! ReadArchive::setShareFiles) may be, since an archive which refreshes is
+//! moved onto a reader of its own.  Returns whether there was anything new,
+//! which is never the case for archives which were already closed when
+//! opened, or which weren't opened via ReadArchive.
+ALEMBIC_EXPORT bool
+RefreshArchive( ::Alembic::AbcCoreAbstract::ArchiveReaderPtr iArchive );
+
 //-*****************************************************************************
 //! Will return a shared pointer to the archive reader
-//! This version creates a cache associated with the archive.
 class ALEMBIC_EXPORT ReadArchive
 {
 public:
@@ -77,11 +169,57 @@ public:
     // delete them
     ReadArchive( const std::vector< std::istream * > & iStreams );
 
+    // When using memory mapped file I/O, array samples of non-string data
+    // which is suitably aligned in the file will point directly into the
+    // mapping instead of being copied.  The file stays mapped for as long as
+    // any such sample is held, even after the archive is closed.
+    // Ignored when reading via file streams or the provided streams.
+    void setZeroCopy( bool iZeroCopy ) { m_zeroCopy = iZeroCopy; }
+    bool getZeroCopy() const { return m_zeroCopy; }
+
+    // The number of threads the archive starts, the first time one of its
+    // properties is asked for a sample via getSampleAsync, to read those
+    // samples in the background.  Reading from more than one stream lets
+    // them read at the same time when using file streams.  A value of 0
+    // reads them on the calling thread instead.  The default is 8.
+    void setNumReadThreads( size_t iNumReadThreads )
+    { m_numReadThreads = iNumReadThreads; }
+
+    size_t getNumReadThreads() const { return m_numReadThreads; }
+
+    // Whether the archive counts what it reads, and how long the reads
+    // take, for ArchiveReader::getReadStatistics.  The default is false.
+    // The counters are cheap enough to leave on.
+    void setCollectStatistics( bool iCollectStatistics )
+    { m_collectStatistics = iCollectStatistics; }
+
+    bool getCollectStatistics() const { return m_collectStatistics; }
+
+    // Whether opening the archive reads the headers of every object and
+    // compound property right away, spread over the read threads (see
+    // setNumReadThreads), instead of as each one is first asked for.
+    // Opening takes longer and everything read is held onto for as long as
+    // the archive is open, but walking the whole hierarchy afterwards is
+    // quick.  Anything which can't be read is left to be read, and to
+    // report its error, when it is asked for.  The default is false.
+    void setPreloadHierarchy( bool iPreloadHierarchy )
+    { m_preloadHierarchy = iPreloadHierarchy; }
+
+    bool getPreloadHierarchy() const { return m_preloadHierarchy; }
+
+    // Whether the file is read through the same open file, or memory
+    // mapping, as every other archive opened with this on which reads the
+    // same file, even by another name.  See Ogawa::IStreams::setMaxOpenFiles
+    // to limit how many such files are kept open at once.  Ignored when
+    // reading from the provided streams.  The default is false.
+    void setShareFiles( bool iShareFiles ) { m_shareFiles = iShareFiles; }
+    bool getShareFiles() const { return m_shareFiles; }
+
     // open the file
     ::Alembic::AbcCoreAbstract::ArchiveReaderPtr
     operator()( const std::string &iFileName ) const;
 
-    // The given cache is ignored.
+    // Use the given cache for array samples, which may be NULL.
     ::Alembic::AbcCoreAbstract::ArchiveReaderPtr
     operator()( const std::string &iFileName,
                 ::Alembic::AbcCoreAbstract::ReadArraySampleCachePtr iCache
@@ -90,6 +228,11 @@ public:
 private:
     size_t m_numStreams;
     bool m_useMMap;
+    bool m_zeroCopy;
+    size_t m_numReadThreads;
+    bool m_collectStatistics;
+    bool m_preloadHierarchy;
+    bool m_shareFiles;
     std::vector< std::istream * > m_streams;
 };
 
@@ -43,6 +43,45 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+// reads one sample on a read thread, keeping the property alive until then
+class SampleTask : public ReadThreadPool::Task
+{
+public:
+    SampleTask( AbcA::ScalarPropertyReaderPtr iProperty, index_t iSampleIndex,
+                void * iIntoLocation )
+      : m_property( iProperty )
+      , m_sampleIndex( iSampleIndex )
+      , m_intoLocation( iIntoLocation )
+    {
+    }
+
+    virtual void run()
+    {
+        try
+        {
+            m_property->getSample( m_sampleIndex, m_intoLocation );
+            m_promise.set_value();
+        }
+        catch ( ... )
+        {
+            m_promise.set_exception( std::current_exception() );
+        }
+    }
+
+    std::future<void> getFuture() { return m_promise.get_future(); }
+
+private:
+    AbcA::ScalarPropertyReaderPtr m_property;
+    index_t m_sampleIndex;
+    void * m_intoLocation;
+    std::promise<void> m_promise;
+};
+
+}
+
 //-*****************************************************************************
 SprImpl::SprImpl( AbcA::CompoundPropertyReaderPtr iParent,
                   Ogawa::IGroupPtr iGroup,
@@ -50,12 +89,17 @@ SprImpl::SprImpl( AbcA::CompoundPropertyReaderPtr iParent,
   : m_parent( iParent )
   , m_group( iGroup )
   , m_header( iHeader )
+  , m_archive( NULL )
 {
     // Validate all inputs.
     ABCA_ASSERT( m_parent, "Invalid parent" );
     ABCA_ASSERT( m_group, "Invalid scalar property group" );
     ABCA_ASSERT( m_header, "Invalid header" );
 
+    m_archive = dynamic_cast< ArImpl * >(
+        m_parent->getObject()->getArchive().get() );
+    ABCA_ASSERT( m_archive, "Invalid archive" );
+
     if ( m_header->header.getPropertyType() != AbcA::kScalarProperty )
     {
         ABCA_THROW( "Attempted to create a ScalarPropertyReader from a "
@@ -104,24 +148,25 @@ void SprImpl::getSample( index_t iSampleIndex, void * iIntoLocation )
 {
     size_t index = m_header->verifyIndex( iSampleIndex );
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+    StreamLease stream( m_archive->getStreamManager() );
+    std::size_t id = stream.getID();
 
-    std::size_t id = streamId->getID();
-    Ogawa::IDataPtr data = m_group->getData( index, id );
-    AbcA::DataType dt = m_header->header.getDataType();
+    Ogawa::IDataHandle data;
+    m_group->getData( index, id, data );
+    const AbcA::DataType & dt = m_header->header.getDataType();
 
     // Check to make sure the Ogawa data size matches our expected scalar
     // property size, the + 16 is to account for the data key.
-    if ( dt.getPod() < Util::kStringPOD && data &&
-        data->getSize() != dt.getNumBytes() + 16 )
+    if ( dt.getPod() < Util::kStringPOD && data.isValid() &&
+        data.getSize() != dt.getNumBytes() + 16 )
     {
         ABCA_THROW( "ScalarPropertyReader::getSample size is not correct "
                     "expected: " << dt.getNumBytes() << " got: " <<
-                    data->getSize() - 16 );
+                    data.getSize() - 16 );
     }
 
     ReadData( iIntoLocation, data, id, dt, dt.getPod() );
+    m_archive->count( ArImpl::kScalarSamples );
 }
 
 //-*****************************************************************************
@@ -145,6 +190,34 @@ std::pair<index_t, chrono_t> SprImpl::getNearIndex( chrono_t iTime )
         m_header->nextSampleIndex );
 }
 
+//-*****************************************************************************
+void SprImpl::prefetch( index_t iFirstSample, index_t iLastSample )
+{
+    StreamLease stream( m_archive->getStreamManager() );
+
+    PrefetchSamples( m_group, m_header, 1, iFirstSample, iLastSample,
+                     stream.getID() );
+}
+
+//-*****************************************************************************
+std::future<void> SprImpl::getSampleAsync( index_t iSampleIndex,
+                                           void * iIntoLocation )
+{
+    ReadThreadPool * pool = m_archive->getReadThreadPool();
+
+    if ( ! pool )
+    {
+        return AbcA::ScalarPropertyReader::getSampleAsync( iSampleIndex,
+                                                           iIntoLocation );
+    }
+
+    Alembic::Util::shared_ptr< SampleTask > task(
+        new SampleTask( shared_from_this(), iSampleIndex, iIntoLocation ) );
+    std::future<void> future = task->getFuture();
+    pool->submit( task );
+    return future;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
@@ -38,6 +38,7 @@
 #define Alembic_AbcCoreOgawa_SprImpl_h
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -69,6 +70,14 @@ public:
     virtual std::pair<index_t, chrono_t> getFloorIndex( chrono_t iTime );
     virtual std::pair<index_t, chrono_t> getCeilIndex( chrono_t iTime );
     virtual std::pair<index_t, chrono_t> getNearIndex( chrono_t iTime );
+    virtual void prefetch( index_t iFirstSample, index_t iLastSample );
+    virtual std::future<void> getSampleAsync( index_t iSampleIndex,
+                                              void * iIntoLocation );
+
+    // where the samples are read from and which of them are stored, for
+    // VerifyArchive
+    Ogawa::IGroupPtr getGroup() const { return m_group; }
+    PropertyHeaderPtr getHeaderPtr() const { return m_header; }
 
 private:
 
@@ -81,6 +90,9 @@ private:
     // Stores the PropertyHeader and other info
     PropertyHeaderPtr m_header;
 
+    // The archive, found once up front so reading a sample doesn't have to
+    // walk back up to it, it outlives us since our parent holds onto it.
+    ArImpl * m_archive;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
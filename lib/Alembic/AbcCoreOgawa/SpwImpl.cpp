@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/SpwImpl.h>
+#include <Alembic/AbcCoreOgawa/AwImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 
@@ -65,10 +66,14 @@ SpwImpl::SpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
 //-*****************************************************************************
 SpwImpl::~SpwImpl()
 {
-    AbcA::ArchiveWriterPtr archive = m_parent->getObject()->getArchive();
+    ChangeLock change( m_parent->getObject()->getArchive() );
 
-    index_t maxSamples = archive->getMaxNumSamplesForTimeSamplingIndex(
-            m_header->timeSamplingIndex );
+    // see ~ApwImpl
+    m_group->freeze();
+
+    Util::shared_ptr< AwImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< AwImpl, AbcA::ArchiveWriter >(
+            m_parent->getObject()->getArchive() );
 
     Util::uint32_t numSamples = m_header->nextSampleIndex;
 
@@ -78,11 +83,8 @@ SpwImpl::~SpwImpl()
         numSamples = 1;
     }
 
-    if ( maxSamples < numSamples )
-    {
-        archive->setMaxNumSamplesForTimeSamplingIndex(
-            m_header->timeSamplingIndex, numSamples );
-    }
+    archive->updateMaxNumSamplesForTimeSamplingIndex(
+        m_header->timeSamplingIndex, numSamples );
 
     Util::SpookyHash hash;
     hash.Init(0, 0);
@@ -105,6 +107,7 @@ SpwImpl::~SpwImpl()
 //-*****************************************************************************
 void SpwImpl::setFromPreviousSample()
 {
+    ChangeLock change( this->getObject()->getArchive() );
 
     // Make sure we aren't writing more samples than we have times for
     // This applies to acyclic sampling only
@@ -127,6 +130,9 @@ void SpwImpl::setFromPreviousSample()
 //-*****************************************************************************
 void SpwImpl::setSample( const void *iSamp )
 {
+    AbcA::ArchiveWriterPtr awp = this->getObject()->getArchive();
+    ChangeLock change( awp );
+
     // Make sure we aren't writing more samples than we have times for
     // This applies to acyclic sampling only
     ABCA_ASSERT(
@@ -173,12 +179,12 @@ void SpwImpl::setSample( const void *iSamp )
 
         // Write this sample, which will update its internal
         // cache of what the previously written sample was.
-        AbcA::ArchiveWriterPtr awp = this->getObject()->getArchive();
 
         // Write the sample.
         // This distinguishes between string, wstring, and regular arrays.
+        // Scalar samples are too small to bother compressing.
         m_previousWrittenSampleID =
-            WriteData( GetWrittenSampleMap( awp ), m_group, samp, key );
+            WriteData( GetWrittenSampleMap( awp ), m_group, samp, key, -1 );
 
         if (m_header->firstChangedIndex == 0)
         {
@@ -200,6 +206,9 @@ void SpwImpl::setSample( const void *iSamp )
     }
 
     m_header->nextSampleIndex ++;
+
+    change.unlock();
+    CheckpointIfDue( awp );
 }
 
 //-*****************************************************************************
@@ -226,6 +235,7 @@ void SpwImpl::setTimeSamplingIndex( Util::uint32_t iIndex )
         "Already have written more samples than we have times for when using "
         "Acyclic sampling." );
 
+    ChangeLock change( m_parent->getObject()->getArchive() );
     m_header->header.setTimeSampling(ts);
     m_header->timeSamplingIndex = iIndex;
 }
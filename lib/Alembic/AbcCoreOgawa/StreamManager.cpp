@@ -127,10 +127,22 @@ StreamManager::~StreamManager()
 
 StreamIDPtr StreamManager::get()
 {
+    std::size_t streamID = 0;
+    if ( acquire( streamID ) )
+    {
+        return StreamIDPtr( new StreamID( this, streamID ) );
+    }
+
+    return m_default;
+}
+
+bool StreamManager::acquire( std::size_t & oStreamID )
+{
+    oStreamID = 0;
 
     if ( m_numStreams < 2 )
     {
-        return m_default;
+        return false;
     }
 
     // we've got too many streams so use the locking version
@@ -138,14 +150,14 @@ StreamIDPtr StreamManager::get()
     {
         Alembic::Util::scoped_lock l( m_lock );
 
-        // we've used up more than we have, just return the default
+        // we've used up more than we have, just use the default
         if ( m_curStream >= m_numStreams )
         {
-            return m_default;
+            return false;
         }
 
-        return StreamIDPtr( new StreamID( this,
-            m_streamIDs[ m_curStream ++ ] ) );
+        oStreamID = m_streamIDs[ m_curStream ++ ];
+        return true;
     }
 
     // CAS (compare and swap) non locking version
@@ -160,14 +172,15 @@ StreamIDPtr StreamManager::get()
 
         if ( val == 0 )
         {
-            return m_default;
+            return false;
         }
 
         newVal = oldVal & ~( Alembic::Util::int64_t( 1 ) << (val - 1) );
     }
     while ( ! COMPARE_EXCHANGE( m_streams, oldVal, newVal ) );
 
-    return StreamIDPtr( new StreamID( this, ( std::size_t ) val - 1 ) );
+    oStreamID = ( std::size_t ) val - 1;
+    return true;
 }
 
 void StreamManager::put( std::size_t iStreamID )
@@ -210,6 +223,23 @@ StreamID::~StreamID()
     }
 }
 
+StreamLease::StreamLease( StreamManager & iManager )
+    : m_manager( &iManager ), m_streamID( 0 )
+{
+    if ( ! iManager.acquire( m_streamID ) )
+    {
+        m_manager = NULL;
+    }
+}
+
+StreamLease::~StreamLease()
+{
+    if ( m_manager != NULL )
+    {
+        m_manager->put( m_streamID );
+    }
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
@@ -59,6 +59,11 @@ public:
     StreamIDPtr get();
 private:
     friend class StreamID;
+    friend class StreamLease;
+
+    // takes a free stream, returns false if there wasn't one and the
+    // default stream 0 should be shared instead, which needn't be put back
+    bool acquire( std::size_t & oStreamID );
     void put( std::size_t iStreamID );
 
     std::size_t m_numStreams;
@@ -91,6 +96,21 @@ private:
     std::size_t m_streamID;
 };
 
+//-*****************************************************************************
+//! Holds on to a stream for as long as it is in scope, the same as holding
+//! a StreamIDPtr from StreamManager::get, but without allocating anything.
+class StreamLease : Alembic::Util::noncopyable
+{
+public:
+    explicit StreamLease( StreamManager & iManager );
+    ~StreamLease();
+    std::size_t getID() const { return m_streamID; }
+private:
+    // NULL when we are sharing the default stream
+    StreamManager * m_manager;
+    std::size_t m_streamID;
+};
+
 
 } // End namespace ALEMBIC_VERSION_NS
 
@@ -40,9 +40,11 @@
 
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 //-*****************************************************************************
@@ -412,6 +414,737 @@ void testIssue253(bool iUseMMap)
     TESTING_ASSERT_THROW(r( "issue253.abc" ),  Alembic::Util::Exception);
 }
 
+void testReadStatistics(bool iUseMMap)
+{
+    std::string archiveName = "readStatistics.abc";
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::ObjectWriterPtr child = a->getTop()->createChild(
+            ABCA::ObjectHeader("child", ABCA::MetaData()));
+
+        ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+        ABCA::ArrayPropertyWriterPtr ap =
+            child->getProperties()->createArrayProperty("ap",
+                ABCA::MetaData(), i32d, 0);
+
+        std::vector< int32_t > vals(100, 3);
+        ap->setSample(ABCA::ArraySample(&(vals.front()), i32d,
+            Dimensions(vals.size())));
+
+        ABCA::ScalarPropertyWriterPtr sp =
+            child->getProperties()->createScalarProperty("sp",
+                ABCA::MetaData(),
+                ABCA::DataType(Alembic::Util::kFloat32POD, 1), 0);
+
+        float32_t f = 2.0f;
+        sp->setSample(&f);
+    }
+
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r(archiveName);
+        ABCA::ReadStatistics stats;
+        TESTING_ASSERT(!a->getReadStatistics(stats));
+        TESTING_ASSERT(stats.streams.empty());
+    }
+
+    AO::ReadArchive r(2, iUseMMap);
+    r.setCollectStatistics(true);
+    ABCA::ArchiveReaderPtr a = r(archiveName, AO::CreateCache(1000000));
+
+    ABCA::ReadStatistics stats;
+    TESTING_ASSERT(a->getReadStatistics(stats));
+    TESTING_ASSERT(stats.streams.size() == 2);
+    TESTING_ASSERT(stats.streams[0].numReads > 0);
+    TESTING_ASSERT(stats.numObjectHeaders == 1);
+    TESTING_ASSERT(stats.numPropertyHeaders == 0);
+
+    a->resetReadStatistics();
+    ABCA::CompoundPropertyReaderPtr props =
+        a->getTop()->getChild(0)->getProperties();
+    ABCA::ArrayPropertyReaderPtr ap = props->getArrayProperty("ap");
+
+    ABCA::ArraySamplePtr samp;
+    ap->getSample(0, samp);
+    ap->getSample(0, samp);
+
+    std::vector< float32_t > floats(100);
+    ap->getAs(0, &(floats.front()), Alembic::Util::kFloat32POD);
+    TESTING_ASSERT(floats[99] == 3.0f);
+
+    float32_t f = 0.0f;
+    props->getScalarProperty("sp")->getSample(0, &f);
+    TESTING_ASSERT(f == 2.0f);
+
+    TESTING_ASSERT(a->getReadStatistics(stats));
+    TESTING_ASSERT(stats.numObjectHeaders == 0);
+    TESTING_ASSERT(stats.numPropertyHeaders == 2);
+    TESTING_ASSERT(stats.numArraySamples == 2);
+    TESTING_ASSERT(stats.numScalarSamples == 1);
+    TESTING_ASSERT(stats.numPodConversions == 1);
+    TESTING_ASSERT(stats.numCacheHits == 1);
+    TESTING_ASSERT(stats.numCacheMisses == 1);
+
+    Alembic::Util::uint64_t numBytes = 0;
+    for (std::size_t i = 0; i < stats.streams.size(); ++i)
+    {
+        numBytes += stats.streams[i].numBytes;
+    }
+
+    // at the very least the samples themselves were read
+    TESTING_ASSERT(numBytes > 100 * sizeof(int32_t) + sizeof(float32_t));
+}
+
+//-*****************************************************************************
+void writeVerifyArchive(const std::string & iName,
+                        Alembic::Util::int8_t iCompression)
+{
+    AO::WriteArchive w;
+    ABCA::ArchiveWriterPtr a = w(iName, ABCA::MetaData());
+    a->setCompressionHint(iCompression);
+
+    ABCA::ObjectWriterPtr child = a->getTop()->createChild(
+        ABCA::ObjectHeader("child", ABCA::MetaData()));
+    ABCA::CompoundPropertyWriterPtr props = child->getProperties();
+
+    ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+    ABCA::ArrayPropertyWriterPtr ap =
+        props->createArrayProperty("ap", ABCA::MetaData(), i32d, 0);
+
+    // samples 0 and 1 are the same, as are 2 and 3
+    std::vector< int32_t > vals(100, 7);
+    ap->setSample(ABCA::ArraySample(&(vals.front()), i32d,
+        Dimensions(vals.size())));
+    ap->setSample(ABCA::ArraySample(&(vals.front()), i32d,
+        Dimensions(vals.size())));
+    for (std::size_t i = 0; i < vals.size(); ++i)
+    {
+        vals[i] = 0x5eed0000 + i;
+    }
+    ap->setSample(ABCA::ArraySample(&(vals.front()), i32d,
+        Dimensions(vals.size())));
+    ap->setSample(ABCA::ArraySample(&(vals.front()), i32d,
+        Dimensions(vals.size())));
+
+    ABCA::ScalarPropertyWriterPtr sp = props->createScalarProperty("sp",
+        ABCA::MetaData(), ABCA::DataType(Alembic::Util::kFloat32POD, 1), 0);
+    float32_t f = 2.0f;
+    sp->setSample(&f);
+    f = 3.0f;
+    sp->setSample(&f);
+
+    ABCA::CompoundPropertyWriterPtr cp =
+        props->createCompoundProperty("cp", ABCA::MetaData());
+
+    ABCA::DataType strd(Alembic::Util::kStringPOD, 1);
+    ABCA::ArrayPropertyWriterPtr strs =
+        cp->createArrayProperty("strs", ABCA::MetaData(), strd, 0);
+    std::vector< std::string > strVals;
+    strVals.push_back("alpha");
+    strVals.push_back("");
+    strVals.push_back("gamma");
+    strs->setSample(ABCA::ArraySample(&(strVals.front()), strd,
+        Dimensions(strVals.size())));
+
+    ABCA::DataType wstrd(Alembic::Util::kWstringPOD, 1);
+    ABCA::ScalarPropertyWriterPtr wstr =
+        cp->createScalarProperty("wstr", ABCA::MetaData(), wstrd, 0);
+    Alembic::Util::wstring wval(L"delta");
+    wstr->setSample(&wval);
+}
+
+//-*****************************************************************************
+void testVerify()
+{
+    std::string archiveName = "verify.abc";
+    std::string compressedName = "verifyCompressed.abc";
+    writeVerifyArchive(archiveName, -1);
+    writeVerifyArchive(compressedName, 1);
+
+    std::vector< AO::VerifyMismatch > mismatches;
+    TESTING_ASSERT(AO::VerifyArchive(archiveName, mismatches) >
+        200 * sizeof(int32_t));
+    TESTING_ASSERT(mismatches.empty());
+
+    TESTING_ASSERT(AO::VerifyArchive(compressedName, mismatches, 3) > 0);
+    TESTING_ASSERT(mismatches.empty());
+
+    // flip a byte of the data of sample 2 of ap
+    std::string contents;
+    {
+        std::ifstream in(archiveName.c_str(), std::ios::binary);
+        std::stringstream buf;
+        buf << in.rdbuf();
+        contents = buf.str();
+    }
+
+    int32_t val = 0x5eed0000 + 10;
+    std::size_t pos = contents.find(
+        std::string((const char *)&val, sizeof(val)));
+    TESTING_ASSERT(pos != std::string::npos);
+    contents[pos] ^= 0x40;
+
+    {
+        std::ofstream out(archiveName.c_str(), std::ios::binary);
+        out.write(contents.data(), contents.size());
+    }
+
+    AO::VerifyArchive(archiveName, mismatches, 2);
+    TESTING_ASSERT(mismatches.size() == 1);
+    TESTING_ASSERT(mismatches[0].objectName == "/child");
+    TESTING_ASSERT(mismatches[0].propertyName == "ap");
+    TESTING_ASSERT(mismatches[0].sampleIndex == 2);
+
+    // the rest of the archive still reads fine
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr a = r(archiveName);
+    ABCA::CompoundPropertyReaderPtr props =
+        a->getTop()->getChild(0)->getProperties();
+    float32_t f = 0.0f;
+    props->getScalarProperty("sp")->getSample(1, &f);
+    TESTING_ASSERT(f == 3.0f);
+}
+
+//-*****************************************************************************
+void testVerifyBadSize()
+{
+    std::string archiveName = "verifyBadSize.abc";
+
+    // enough properties for the threads to each have some
+    ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr props = a->getTop()->getProperties();
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            std::ostringstream name;
+            name << "ap" << i;
+            std::vector< int32_t > vals(100);
+            for (std::size_t j = 0; j < vals.size(); ++j)
+            {
+                vals[j] = 0x7a110000 + i * 1000 + j;
+            }
+
+            ABCA::ArrayPropertyWriterPtr ap = props->createArrayProperty(
+                name.str(), ABCA::MetaData(), i32d, 0);
+            ap->setSample(ABCA::ArraySample(&(vals.front()), i32d,
+                Dimensions(vals.size())));
+        }
+    }
+
+    std::string contents;
+    {
+        std::ifstream in(archiveName.c_str(), std::ios::binary);
+        std::stringstream buf;
+        buf << in.rdbuf();
+        contents = buf.str();
+    }
+
+    // the data of ap3 is its size, its key and then its values, make the
+    // size far bigger than the file
+    int32_t val = 0x7a110000 + 3000;
+    std::size_t pos = contents.find(
+        std::string((const char *)&val, sizeof(val)));
+    TESTING_ASSERT(pos != std::string::npos && pos >= 24);
+    Alembic::Util::uint64_t size = 0x7fffffffffffULL;
+    contents.replace(pos - 24, 8, (const char *)&size, 8);
+
+    {
+        std::ofstream out(archiveName.c_str(), std::ios::binary);
+        out.write(contents.data(), contents.size());
+    }
+
+    for (std::size_t numThreads = 1; numThreads <= 4; numThreads *= 4)
+    {
+        std::vector< AO::VerifyMismatch > mismatches;
+        TESTING_ASSERT(AO::VerifyArchive(archiveName, mismatches,
+            numThreads) >= 7 * 100 * sizeof(int32_t));
+        TESTING_ASSERT(mismatches.size() == 1);
+        TESTING_ASSERT(mismatches[0].objectName == "/");
+        TESTING_ASSERT(mismatches[0].propertyName == "ap3");
+        TESTING_ASSERT(mismatches[0].sampleIndex == 0);
+    }
+}
+
+//-*****************************************************************************
+// what is on disk so far, as if the writer died right now
+void copyFile(const std::string & iFrom, const std::string & iTo)
+{
+    std::ifstream in(iFrom.c_str(), std::ios::binary);
+    std::ofstream out(iTo.c_str(), std::ios::binary | std::ios::trunc);
+    out << in.rdbuf();
+}
+
+//-*****************************************************************************
+// the values of sample iSample of object iObject, every other sample is the
+// same for all of the objects so that they share it
+void concurrentSample(std::size_t iObject, std::size_t iSample,
+                      std::vector< int32_t > & oVals)
+{
+    // some of them are too big for the write buffer
+    oVals.resize(iSample % 3 == 0 ? 3000 : 500);
+    for (std::size_t i = 0; i < oVals.size(); ++i)
+    {
+        oVals[i] = iSample * 10000 + i;
+        if (iSample % 2 == 1)
+        {
+            oVals[i] += iObject * 1000000;
+        }
+    }
+}
+
+//-*****************************************************************************
+struct ConcurrentWriter
+{
+    std::size_t object;
+    std::size_t numSamples;
+    ABCA::ObjectWriterPtr obj;
+    ABCA::CompoundPropertyWriterPtr props;
+    ABCA::ArrayPropertyWriterPtr ap;
+    ABCA::ScalarPropertyWriterPtr sp;
+
+    void operator()()
+    {
+        ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+
+        // made on this thread, while the others are writing
+        ABCA::CompoundPropertyWriterPtr cp =
+            props->createCompoundProperty("cp", ABCA::MetaData());
+        ABCA::ArrayPropertyWriterPtr late =
+            cp->createArrayProperty("late", ABCA::MetaData(), i32d, 0);
+
+        std::vector< int32_t > vals;
+        for (std::size_t i = 0; i < numSamples; ++i)
+        {
+            concurrentSample(object, i, vals);
+            ap->setSample(ABCA::ArraySample(&(vals.front()), i32d,
+                Dimensions(vals.size())));
+            late->setSample(ABCA::ArraySample(&(vals.front()), i32d,
+                Dimensions(vals.size())));
+
+            float32_t f = object * 100 + i;
+            sp->setSample(&f);
+
+            // made and closed while the others are writing
+            std::ostringstream name;
+            name << "c" << i;
+            ABCA::ObjectWriterPtr child = obj->createChild(
+                ABCA::ObjectHeader(name.str(), ABCA::MetaData()));
+            int32_t n = i;
+            child->getProperties()->createScalarProperty("n",
+                ABCA::MetaData(), i32d, 0)->setSample(&n);
+        }
+    }
+};
+
+//-*****************************************************************************
+// a checkpoint written while the ConcurrentWriters were going has some
+// prefix of what each of them wrote
+void readConcurrentCheckpoint(const std::string & iName,
+                              std::size_t iNumObjects, std::size_t iNumSamples)
+{
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr a = r(iName);
+    TESTING_ASSERT(a->getTop()->getNumChildren() == iNumObjects);
+
+    std::vector< int32_t > vals;
+    for (std::size_t i = 0; i < iNumObjects; ++i)
+    {
+        ABCA::ObjectReaderPtr obj = a->getTop()->getChild(i);
+        ABCA::ArrayPropertyReaderPtr ap =
+            obj->getProperties()->getArrayProperty("ap");
+        TESTING_ASSERT(ap->getNumSamples() <= iNumSamples);
+        for (std::size_t j = 0; j < ap->getNumSamples(); ++j)
+        {
+            concurrentSample(i, j, vals);
+
+            ABCA::ArraySamplePtr samp;
+            ap->getSample(j, samp);
+            TESTING_ASSERT(samp->size() == vals.size());
+            TESTING_ASSERT(std::equal(vals.begin(), vals.end(),
+                (const int32_t *)samp->getData()));
+        }
+
+        TESTING_ASSERT(obj->getNumChildren() <= iNumSamples);
+        for (std::size_t j = 0; j < obj->getNumChildren(); ++j)
+        {
+            ABCA::ObjectReaderPtr child = obj->getChild(j);
+            std::ostringstream name;
+            name << "c" << j;
+            TESTING_ASSERT(child->getName() == name.str());
+
+            ABCA::ScalarPropertyReaderPtr n =
+                child->getProperties()->getScalarProperty("n");
+            TESTING_ASSERT(n->getNumSamples() <= 1);
+            if (n->getNumSamples() == 1)
+            {
+                int32_t val = -1;
+                n->getSample(0, &val);
+                TESTING_ASSERT(val == (int32_t)j);
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void testConcurrentWrites(std::size_t iBufferSize, std::size_t iQueueSize,
+                          std::size_t iCheckpointInterval)
+{
+    std::string archiveName = "concurrentWrites.abc";
+    const std::size_t numObjects = 4;
+    const std::size_t numSamples = 30;
+
+    {
+        AO::WriteArchive w;
+        w.setBufferSize(iBufferSize);
+        w.setAsyncQueueSize(iQueueSize);
+        w.setCheckpointInterval(iCheckpointInterval);
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+
+        std::vector< ABCA::ObjectWriterPtr > objects;
+        std::vector< ConcurrentWriter > writers(numObjects);
+        for (std::size_t i = 0; i < numObjects; ++i)
+        {
+            std::ostringstream name;
+            name << "obj" << i;
+            objects.push_back(a->getTop()->createChild(
+                ABCA::ObjectHeader(name.str(), ABCA::MetaData())));
+
+            ABCA::CompoundPropertyWriterPtr props =
+                objects.back()->getProperties();
+            writers[i].object = i;
+            writers[i].numSamples = numSamples;
+            writers[i].obj = objects.back();
+            writers[i].props = props;
+            writers[i].ap = props->createArrayProperty("ap", ABCA::MetaData(),
+                ABCA::DataType(Alembic::Util::kInt32POD, 1), 0);
+            writers[i].sp = props->createScalarProperty("sp", ABCA::MetaData(),
+                ABCA::DataType(Alembic::Util::kFloat32POD, 1), 0);
+        }
+
+        std::vector< std::thread > threads;
+        for (std::size_t i = 0; i < numObjects; ++i)
+        {
+            threads.push_back(std::thread(writers[i]));
+        }
+
+        for (std::size_t i = 0; i < numObjects; ++i)
+        {
+            threads[i].join();
+        }
+
+        if (iCheckpointInterval != 0)
+        {
+            copyFile(archiveName, "concurrentCheckpoint.abc");
+            readConcurrentCheckpoint("concurrentCheckpoint.abc", numObjects,
+                                     numSamples);
+        }
+    }
+
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr a = r(archiveName);
+    TESTING_ASSERT(a->getTop()->getNumChildren() == numObjects);
+    TESTING_ASSERT(a->getMaxNumSamplesForTimeSamplingIndex(0) == numSamples);
+
+    std::vector< int32_t > vals;
+    for (std::size_t i = 0; i < numObjects; ++i)
+    {
+        std::ostringstream name;
+        name << "obj" << i;
+        ABCA::ObjectReaderPtr obj = a->getTop()->getChild(name.str());
+        TESTING_ASSERT(obj);
+
+        ABCA::CompoundPropertyReaderPtr props = obj->getProperties();
+        ABCA::ArrayPropertyReaderPtr ap = props->getArrayProperty("ap");
+        ABCA::ArrayPropertyReaderPtr late =
+            props->getCompoundProperty("cp")->getArrayProperty("late");
+        ABCA::ScalarPropertyReaderPtr sp = props->getScalarProperty("sp");
+        TESTING_ASSERT(ap->getNumSamples() == numSamples);
+        TESTING_ASSERT(late->getNumSamples() == numSamples);
+        TESTING_ASSERT(sp->getNumSamples() == numSamples);
+        TESTING_ASSERT(obj->getNumChildren() == numSamples);
+
+        for (std::size_t j = 0; j < numSamples; ++j)
+        {
+            concurrentSample(i, j, vals);
+
+            ABCA::ArraySamplePtr samp;
+            ap->getSample(j, samp);
+            TESTING_ASSERT(samp->size() == vals.size());
+            TESTING_ASSERT(std::equal(vals.begin(), vals.end(),
+                (const int32_t *)samp->getData()));
+
+            late->getSample(j, samp);
+            TESTING_ASSERT(samp->size() == vals.size());
+            TESTING_ASSERT(std::equal(vals.begin(), vals.end(),
+                (const int32_t *)samp->getData()));
+
+            float32_t f = 0.0f;
+            sp->getSample(j, &f);
+            TESTING_ASSERT(f == i * 100 + j);
+        }
+    }
+
+    std::vector< AO::VerifyMismatch > mismatches;
+    AO::VerifyArchive(archiveName, mismatches);
+    TESTING_ASSERT(mismatches.empty());
+}
+
+//-*****************************************************************************
+// writes the same numSamples samples to two properties, returning how big
+// the archive ended up
+std::size_t writeRepeatedSamples(const std::string & iName,
+                                 std::size_t iMaxDedupBytes)
+{
+    const std::size_t numSamples = 500;
+    ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+    {
+        AO::WriteArchive w;
+        w.setMaxDedupBytes(iMaxDedupBytes);
+        TESTING_ASSERT(w.getMaxDedupBytes() == iMaxDedupBytes);
+        ABCA::ArchiveWriterPtr a = w(iName, ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr props = a->getTop()->createChild(
+            ABCA::ObjectHeader("child", ABCA::MetaData()))->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr first =
+            props->createArrayProperty("first", ABCA::MetaData(), i32d, 0);
+        ABCA::ArrayPropertyWriterPtr second =
+            props->createArrayProperty("second", ABCA::MetaData(), i32d, 0);
+
+        std::vector< int32_t > vals(100);
+        for (std::size_t i = 0; i < numSamples * 2; ++i)
+        {
+            std::size_t sample = i % numSamples;
+            for (std::size_t j = 0; j < vals.size(); ++j)
+            {
+                vals[j] = sample * vals.size() + j;
+            }
+
+            ABCA::ArraySample samp(&(vals.front()), i32d,
+                                   Dimensions(vals.size()));
+            if (i < numSamples)
+            {
+                first->setSample(samp);
+            }
+            else
+            {
+                second->setSample(samp);
+            }
+        }
+    }
+
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr a = r(iName);
+    ABCA::CompoundPropertyReaderPtr props =
+        a->getTop()->getChild(0)->getProperties();
+    ABCA::ArrayPropertyReaderPtr second = props->getArrayProperty("second");
+    TESTING_ASSERT(second->getNumSamples() == numSamples);
+    for (std::size_t i = 0; i < numSamples; ++i)
+    {
+        ABCA::ArraySamplePtr samp;
+        second->getSample(i, samp);
+        TESTING_ASSERT(samp->size() == 100);
+        TESTING_ASSERT(((const int32_t *)samp->getData())[7] ==
+                       (int32_t)(i * 100 + 7));
+    }
+
+    std::ifstream in(iName.c_str(), std::ios::binary | std::ios::ate);
+    return in.tellg();
+}
+
+//-*****************************************************************************
+void testMaxDedupBytes()
+{
+    // everything is remembered so none of the second samples are written
+    std::size_t unlimited = writeRepeatedSamples("dedupUnlimited.abc", 0);
+
+    // only room for a few hundred samples, forgetting the oldest
+    std::size_t limited = writeRepeatedSamples("dedupLimited.abc", 8192);
+
+    TESTING_ASSERT(unlimited < 500 * 100 * sizeof(int32_t) * 3 / 2);
+    TESTING_ASSERT(limited > unlimited + 200 * 100 * sizeof(int32_t));
+}
+
+void readCheckpoint(const std::string & iName, std::size_t iMinSamples)
+{
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr a = r(iName);
+    TESTING_ASSERT(a->getTop()->getNumChildren() == 1);
+
+    ABCA::ObjectReaderPtr child = a->getTop()->getChild(0);
+    TESTING_ASSERT(child->getName() == "child");
+    TESTING_ASSERT(child->getNumChildren() == 1);
+    TESTING_ASSERT(child->getChild(0)->getName() == "grandchild");
+
+    ABCA::ArrayPropertyReaderPtr vals =
+        child->getProperties()->getArrayProperty("vals");
+    TESTING_ASSERT(vals->getNumSamples() >= iMinSamples);
+    TESTING_ASSERT(a->getMaxNumSamplesForTimeSamplingIndex(0) >=
+                   (ABCA::index_t) vals->getNumSamples());
+    for (std::size_t i = 0; i < vals->getNumSamples(); ++i)
+    {
+        ABCA::ArraySamplePtr samp;
+        vals->getSample(i, samp);
+        TESTING_ASSERT(samp->size() == 100);
+        TESTING_ASSERT(((const int32_t *)samp->getData())[3] ==
+                       (int32_t)(i * 100 + 3));
+    }
+
+    ABCA::ScalarPropertyReaderPtr frame =
+        child->getProperties()->getCompoundProperty("nested")->
+        getScalarProperty("frame");
+    TESTING_ASSERT(frame->getNumSamples() + 1 >= vals->getNumSamples());
+    for (std::size_t i = 0; i < frame->getNumSamples(); ++i)
+    {
+        int32_t val = 0;
+        frame->getSample(i, &val);
+        TESTING_ASSERT(val == (int32_t)i);
+    }
+}
+
+void testCheckpoints()
+{
+    const std::size_t numSamples = 20;
+    ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+    {
+        AO::WriteArchive w;
+        w.setCheckpointInterval(1024);
+        TESTING_ASSERT(w.getCheckpointInterval() == 1024);
+        ABCA::ArchiveWriterPtr a = w("checkpoint.abc", ABCA::MetaData());
+        ABCA::ObjectWriterPtr child = a->getTop()->createChild(
+            ABCA::ObjectHeader("child", ABCA::MetaData()));
+        child->createChild(ABCA::ObjectHeader("grandchild", ABCA::MetaData()));
+
+        ABCA::ArrayPropertyWriterPtr vals =
+            child->getProperties()->createArrayProperty("vals",
+                ABCA::MetaData(), i32d, 0);
+        ABCA::ScalarPropertyWriterPtr frame =
+            child->getProperties()->createCompoundProperty("nested",
+                ABCA::MetaData())->createScalarProperty("frame",
+                ABCA::MetaData(), i32d, 0);
+
+        // nothing has been checkpointed yet
+        copyFile("checkpoint.abc", "checkpointNone.abc");
+
+        std::vector< int32_t > data(100);
+        for (std::size_t i = 0; i < numSamples; ++i)
+        {
+            for (std::size_t j = 0; j < data.size(); ++j)
+            {
+                data[j] = i * data.size() + j;
+            }
+
+            vals->setSample(ABCA::ArraySample(&(data.front()), i32d,
+                                              Dimensions(data.size())));
+            int32_t val = i;
+            frame->setSample(&val);
+
+            if (i == numSamples / 2)
+            {
+                copyFile("checkpoint.abc", "checkpointHalf.abc");
+            }
+        }
+    }
+
+    AO::ReadArchive r;
+    TESTING_ASSERT_THROW(r("checkpointNone.abc"), Alembic::Util::Exception);
+
+    readCheckpoint("checkpointHalf.abc", 2);
+
+    // closing it normally still gives the whole thing
+    readCheckpoint("checkpoint.abc", numSamples);
+    ABCA::ArchiveReaderPtr a = r("checkpoint.abc");
+    TESTING_ASSERT(a->getTop()->getChild(0)->getProperties()->
+                   getArrayProperty("vals")->getNumSamples() == numSamples);
+}
+
+//-*****************************************************************************
+ABCA::ArrayPropertyReaderPtr getLiveVals(ABCA::ArchiveReaderPtr iArchive)
+{
+    return iArchive->getTop()->getChild(0)->getProperties()->
+        getArrayProperty("vals");
+}
+
+void testLiveRead(bool iUseMMap, bool iShareFiles)
+{
+    const std::size_t numSamples = 30;
+    ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+
+    AO::ReadArchive r(1, iUseMMap);
+    r.setShareFiles(iShareFiles);
+    ABCA::ArchiveReaderPtr reader;
+    ABCA::ArrayPropertyReaderPtr first;
+    std::size_t numFirst = 0;
+
+    {
+        AO::WriteArchive w;
+        w.setCheckpointInterval(1024);
+        ABCA::ArchiveWriterPtr a = w("live.abc", ABCA::MetaData());
+        ABCA::ArrayPropertyWriterPtr vals = a->getTop()->createChild(
+            ABCA::ObjectHeader("child", ABCA::MetaData()))->getProperties()->
+            createArrayProperty("vals", ABCA::MetaData(), i32d, 0);
+
+        std::vector< int32_t > data(100);
+        for (std::size_t i = 0; i < numSamples; ++i)
+        {
+            for (std::size_t j = 0; j < data.size(); ++j)
+            {
+                data[j] = i * data.size() + j;
+            }
+
+            vals->setSample(ABCA::ArraySample(&(data.front()), i32d,
+                                              Dimensions(data.size())));
+
+            if (i == numSamples / 3)
+            {
+                // start reading while it is still being written
+                reader = r("live.abc");
+                first = getLiveVals(reader);
+                numFirst = first->getNumSamples();
+                TESTING_ASSERT(numFirst >= 2 && numFirst <= i + 1);
+            }
+            else if (i == numSamples * 2 / 3)
+            {
+                TESTING_ASSERT(AO::RefreshArchive(reader));
+                ABCA::ArrayPropertyReaderPtr second = getLiveVals(reader);
+                TESTING_ASSERT(second->getNumSamples() > numFirst);
+                TESTING_ASSERT(second->getNumSamples() <= i + 1);
+
+                ABCA::ArraySamplePtr samp;
+                second->getSample(second->getNumSamples() - 1, samp);
+                TESTING_ASSERT(((const int32_t *)samp->getData())[5] ==
+                    (int32_t)((second->getNumSamples() - 1) * 100 + 5));
+
+                // what was gotten before is unchanged
+                TESTING_ASSERT(first->getNumSamples() == numFirst);
+            }
+        }
+    }
+
+    // now that it is closed, all of it
+    TESTING_ASSERT(AO::RefreshArchive(reader));
+    ABCA::ArrayPropertyReaderPtr vals = getLiveVals(reader);
+    TESTING_ASSERT(vals->getNumSamples() == numSamples);
+    for (std::size_t i = 0; i < numSamples; ++i)
+    {
+        ABCA::ArraySamplePtr samp;
+        vals->getSample(i, samp);
+        TESTING_ASSERT(((const int32_t *)samp->getData())[99] ==
+                       (int32_t)(i * 100 + 99));
+    }
+
+    ABCA::ArraySamplePtr samp;
+    first->getSample(numFirst - 1, samp);
+    TESTING_ASSERT(((const int32_t *)samp->getData())[0] ==
+                   (int32_t)((numFirst - 1) * 100));
+
+    // nothing changes after that
+    TESTING_ASSERT(!AO::RefreshArchive(reader));
+}
+
 void runTests(bool iUseMMap)
 {
     testReadWriteEmptyArchive(iUseMMap);
@@ -422,6 +1155,8 @@ void runTests(bool iUseMMap)
     testGarbageArchive(iUseMMap);
 
     testIssue253(iUseMMap);
+
+    testReadStatistics(iUseMMap);
 }
 
 int main ( int argc, char *argv[] )
@@ -442,5 +1177,22 @@ int main ( int argc, char *argv[] )
     readVeryEmptyArchive("testEmpty.abc", true);
     readVeryEmptyArchive("testEmpty.abc", false);
 
+    testVerify();
+    testVerifyBadSize();
+
+    testConcurrentWrites(0, 0, 0);
+    testConcurrentWrites(4096, 0, 0);
+    testConcurrentWrites(4096, 65536, 0);
+    testConcurrentWrites(0, 0, 1024);
+    testConcurrentWrites(4096, 65536, 1024);
+
+    testMaxDedupBytes();
+
+    testCheckpoints();
+
+    testLiveRead(true, false);
+    testLiveRead(false, false);
+    testLiveRead(false, true);
+
     return 0;
 }
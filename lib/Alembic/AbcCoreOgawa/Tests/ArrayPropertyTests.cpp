@@ -40,7 +40,10 @@
 
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <fstream>
+#include <future>
 #include <iostream>
+#include <sstream>
 #include <vector>
 
 
@@ -2017,6 +2020,1041 @@ void testBigData(bool iUseMMap)
     }
 }
 
+void testZeroCopyArray(bool iUseMMap)
+{
+    std::string archiveName = "zeroCopyArray.abc";
+
+    std::vector < Alembic::Util::int8_t > vals(100);
+    for (std::size_t i = 0; i < vals.size(); ++i)
+    {
+        vals[i] = (Alembic::Util::int8_t)(i);
+    }
+
+    ABCA::DataType dtype(Alembic::Util::kInt8POD, 1);
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::ObjectWriterPtr archive = a->getTop();
+
+        ABCA::CompoundPropertyWriterPtr parent = archive->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr awp =
+            parent->createArrayProperty("a", ABCA::MetaData(), dtype, 0);
+
+        awp->setSample(ABCA::ArraySample(&(vals.front()), dtype,
+            Alembic::Util::Dimensions(vals.size())));
+    }
+
+    ABCA::ArraySamplePtr samp;
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        r.setZeroCopy(true);
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        ABCA::ArrayPropertyReaderPtr ap =
+            a->getTop()->getProperties()->getArrayProperty("a");
+
+        ABCA::ArraySamplePtr samp2;
+        ap->getSample(0, samp);
+        ap->getSample(0, samp2);
+
+        // with mmap both samples refer to the same spot in the file
+        TESTING_ASSERT((samp->getData() == samp2->getData()) == iUseMMap);
+        TESTING_ASSERT(samp2->getDimensions().numPoints() == vals.size());
+    }
+
+    // the sample should still be valid after the archive has gone away
+    TESTING_ASSERT(samp->getDimensions().numPoints() == vals.size());
+    const Alembic::Util::int8_t * data =
+        (const Alembic::Util::int8_t *)(samp->getData());
+    for (std::size_t i = 0; i < vals.size(); ++i)
+    {
+        TESTING_ASSERT(data[i] == vals[i]);
+    }
+
+    {
+        // zero copy is off by default
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        ABCA::ArrayPropertyReaderPtr ap =
+            a->getTop()->getProperties()->getArrayProperty("a");
+
+        ABCA::ArraySamplePtr samp2;
+        ABCA::ArraySamplePtr samp3;
+        ap->getSample(0, samp2);
+        ap->getSample(0, samp3);
+        TESTING_ASSERT(samp2->getData() != samp3->getData());
+    }
+}
+
+template < typename T >
+void testZeroCopyAlignment(bool iUseMMap, Alembic::Util::PlainOldDataType iPod)
+{
+    std::string archiveName = "zeroCopyAlignment.abc";
+
+    ABCA::DataType dtype(iPod, 1);
+    ABCA::DataType padType(Alembic::Util::kInt8POD, 1);
+    std::size_t numSamples = 16;
+    std::size_t numVals = 10;
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr awp =
+            parent->createArrayProperty("a", ABCA::MetaData(), dtype, 0);
+        ABCA::ArrayPropertyWriterPtr pad =
+            parent->createArrayProperty("pad", ABCA::MetaData(), padType, 0);
+
+        // the odd sized padding moves where each sample lands in the file,
+        // so some of them are aligned for T and some aren't
+        std::vector < Alembic::Util::int8_t > padVals(numSamples, 1);
+        for (std::size_t s = 0; s < numSamples; ++s)
+        {
+            padVals[0] = (Alembic::Util::int8_t) s;
+            pad->setSample(ABCA::ArraySample(&(padVals.front()), padType,
+                Alembic::Util::Dimensions(s % 8 + 1)));
+
+            std::vector < T > vals(numVals);
+            for (std::size_t i = 0; i < numVals; ++i)
+            {
+                vals[i] = (T)(s * numVals + i) + (T) 0.5;
+            }
+            awp->setSample(ABCA::ArraySample(&(vals.front()), dtype,
+                Alembic::Util::Dimensions(numVals)));
+        }
+    }
+
+    AO::ReadArchive r(1, iUseMMap);
+    r.setZeroCopy(true);
+    ABCA::ArchiveReaderPtr a = r( archiveName );
+    ABCA::ArrayPropertyReaderPtr ap =
+        a->getTop()->getProperties()->getArrayProperty("a");
+
+    std::size_t numShared = 0;
+    std::size_t numCopied = 0;
+    for (std::size_t s = 0; s < numSamples; ++s)
+    {
+        ABCA::ArraySamplePtr samp;
+        ABCA::ArraySamplePtr samp2;
+        ap->getSample(s, samp);
+        ap->getSample(s, samp2);
+
+        // whether it points into the file or not, it has to be aligned
+        TESTING_ASSERT(reinterpret_cast< std::size_t >(samp->getData()) %
+                       sizeof(T) == 0);
+
+        if (samp->getData() == samp2->getData())
+        {
+            numShared++;
+        }
+        else
+        {
+            numCopied++;
+        }
+
+        TESTING_ASSERT(samp->getDimensions().numPoints() == numVals);
+        const T * data = (const T *)(samp->getData());
+        for (std::size_t i = 0; i < numVals; ++i)
+        {
+            TESTING_ASSERT(data[i] == (T)(s * numVals + i) + (T) 0.5);
+        }
+    }
+
+    // only mmap can share, and then only the aligned ones
+    TESTING_ASSERT(numCopied > 0);
+    TESTING_ASSERT((numShared > 0) == iUseMMap);
+}
+
+void testCompressedArrays(bool iUseMMap)
+{
+    std::string archiveName = "compressedArrays.abc";
+    std::string rawArchiveName = "uncompressedArrays.abc";
+
+    // a wavy grid, like the positions of a cloth sim
+    std::vector < Alembic::Util::float32_t > points;
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        for (std::size_t j = 0; j < 100; ++j)
+        {
+            points.push_back(i * 0.1f);
+            points.push_back((i + j) % 7 * 0.01f);
+            points.push_back(j * 0.1f);
+        }
+    }
+
+    std::vector < Alembic::Util::int32_t > indices(30000);
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+        indices[i] = i / 4;
+    }
+
+    std::vector < Alembic::Util::string > strs(500, "compress me please");
+    std::vector < Alembic::Util::wstring > wstrs(500, L"me too");
+
+    ABCA::DataType f3d(Alembic::Util::kFloat32POD, 3);
+    ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+    ABCA::DataType strd(Alembic::Util::kStringPOD, 1);
+    ABCA::DataType wstrd(Alembic::Util::kWstringPOD, 1);
+
+    for (int hint = -1; hint < 2; hint += 2)
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(hint < 0 ? rawArchiveName : archiveName,
+                                     ABCA::MetaData());
+        a->setCompressionHint(hint);
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr pwp =
+            parent->createArrayProperty("P", ABCA::MetaData(), f3d, 0);
+        pwp->setSample(ABCA::ArraySample(&(points.front()), f3d,
+            Alembic::Util::Dimensions(points.size() / 3)));
+
+        // the same sample again should be shared
+        pwp->setSample(ABCA::ArraySample(&(points.front()), f3d,
+            Alembic::Util::Dimensions(points.size() / 3)));
+
+        ABCA::ArrayPropertyWriterPtr iwp =
+            parent->createArrayProperty("i", ABCA::MetaData(), i32d, 0);
+        iwp->setSample(ABCA::ArraySample(&(indices.front()), i32d,
+            Alembic::Util::Dimensions(indices.size())));
+
+        ABCA::ArrayPropertyWriterPtr swp =
+            parent->createArrayProperty("s", ABCA::MetaData(), strd, 0);
+        swp->setSample(ABCA::ArraySample(&(strs.front()), strd,
+            Alembic::Util::Dimensions(strs.size())));
+
+        ABCA::ArrayPropertyWriterPtr wwp =
+            parent->createArrayProperty("w", ABCA::MetaData(), wstrd, 0);
+        wwp->setSample(ABCA::ArraySample(&(wstrs.front()), wstrd,
+            Alembic::Util::Dimensions(wstrs.size())));
+    }
+
+    {
+        std::ifstream compressedFile(archiveName.c_str(),
+                                     std::ios::binary | std::ios::ate);
+        std::ifstream rawFile(rawArchiveName.c_str(),
+                              std::ios::binary | std::ios::ate);
+        TESTING_ASSERT(compressedFile.tellg() * 2 < rawFile.tellg());
+    }
+
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        r.setZeroCopy(true);
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+
+        ABCA::ArrayPropertyReaderPtr prp = parent->getArrayProperty("P");
+        TESTING_ASSERT(prp->getNumSamples() == 2);
+        for (std::size_t s = 0; s < 2; ++s)
+        {
+            ABCA::ArraySamplePtr samp;
+            prp->getSample(s, samp);
+            TESTING_ASSERT(samp->getDimensions().numPoints() * 3 ==
+                           points.size());
+            const Alembic::Util::float32_t * data =
+                (const Alembic::Util::float32_t *)(samp->getData());
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+                TESTING_ASSERT(data[i] == points[i]);
+            }
+
+            ABCA::ArraySampleKey key;
+            TESTING_ASSERT(prp->getKey(s, key));
+            TESTING_ASSERT(key.numBytes == points.size() * 4);
+            TESTING_ASSERT(key == samp->getKey());
+        }
+
+        // read it as doubles
+        std::vector < Alembic::Util::float64_t > dpoints(points.size());
+        prp->getAs(0, &dpoints.front(), Alembic::Util::kFloat64POD);
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            TESTING_ASSERT(dpoints[i] == points[i]);
+        }
+
+        ABCA::ArraySamplePtr samp;
+        parent->getArrayProperty("i")->getSample(0, samp);
+        TESTING_ASSERT(samp->getDimensions().numPoints() == indices.size());
+        const Alembic::Util::int32_t * idata =
+            (const Alembic::Util::int32_t *)(samp->getData());
+        for (std::size_t i = 0; i < indices.size(); ++i)
+        {
+            TESTING_ASSERT(idata[i] == indices[i]);
+        }
+
+        parent->getArrayProperty("s")->getSample(0, samp);
+        TESTING_ASSERT(samp->getDimensions().numPoints() == strs.size());
+        const Alembic::Util::string * sdata =
+            (const Alembic::Util::string *)(samp->getData());
+        for (std::size_t i = 0; i < strs.size(); ++i)
+        {
+            TESTING_ASSERT(sdata[i] == strs[i]);
+        }
+
+        parent->getArrayProperty("w")->getSample(0, samp);
+        TESTING_ASSERT(samp->getDimensions().numPoints() == wstrs.size());
+        const Alembic::Util::wstring * wdata =
+            (const Alembic::Util::wstring *)(samp->getData());
+        for (std::size_t i = 0; i < wstrs.size(); ++i)
+        {
+            TESTING_ASSERT(wdata[i] == wstrs[i]);
+        }
+    }
+}
+
+void testSmallCompressedArrays(bool iUseMMap)
+{
+    std::string archiveName = "smallCompressedArrays.abc";
+    ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+
+    // many small samples at the highest level, with the sizes going up and
+    // down so the match table is sized for each of them in turn
+    std::size_t numSamples = 2000;
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        a->setCompressionHint(9);
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+        ABCA::ArrayPropertyWriterPtr awp =
+            parent->createArrayProperty("small", ABCA::MetaData(), i32d, 0);
+
+        for (std::size_t s = 0; s < numSamples; ++s)
+        {
+            std::vector< Alembic::Util::int32_t > vals(8 + s * 37 % 500);
+            for (std::size_t i = 0; i < vals.size(); ++i)
+            {
+                vals[i] = (s + i) / 8;
+            }
+            awp->setSample(ABCA::ArraySample(&(vals.front()), i32d,
+                Alembic::Util::Dimensions(vals.size())));
+        }
+    }
+
+    AO::ReadArchive r(1, iUseMMap);
+    ABCA::ArchiveReaderPtr a = r(archiveName);
+    ABCA::ArrayPropertyReaderPtr arp =
+        a->getTop()->getProperties()->getArrayProperty("small");
+    TESTING_ASSERT(arp->getNumSamples() == numSamples);
+    for (std::size_t s = 0; s < numSamples; ++s)
+    {
+        ABCA::ArraySamplePtr samp;
+        arp->getSample(s, samp);
+        TESTING_ASSERT(samp->size() == 8 + s * 37 % 500);
+        const Alembic::Util::int32_t * data =
+            (const Alembic::Util::int32_t *)(samp->getData());
+        for (std::size_t i = 0; i < samp->size(); ++i)
+        {
+            TESTING_ASSERT(data[i] == (Alembic::Util::int32_t)((s + i) / 8));
+        }
+    }
+}
+
+void testSampleCache(bool iUseMMap)
+{
+    std::string archiveName = "sampleCache.abc";
+
+    std::vector < Alembic::Util::int32_t > faceCounts(1000, 4);
+    std::vector < Alembic::Util::int32_t > points(1000, 7);
+
+    ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+    ABCA::DataType i32d2(Alembic::Util::kInt32POD, 2);
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr counts =
+            parent->createArrayProperty("counts", ABCA::MetaData(), i32d, 0);
+
+        ABCA::ArrayPropertyWriterPtr pairs =
+            parent->createArrayProperty("pairs", ABCA::MetaData(), i32d2, 0);
+
+        // the same topology every frame, and the same bytes again as pairs
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            faceCounts[0] = i < 3 ? 3 : 4;
+            counts->setSample(ABCA::ArraySample(&(faceCounts.front()), i32d,
+                Alembic::Util::Dimensions(faceCounts.size())));
+        }
+
+        pairs->setSample(ABCA::ArraySample(&(faceCounts.front()), i32d2,
+            Alembic::Util::Dimensions(faceCounts.size() / 2)));
+
+        // one which is too big for the cache
+        std::vector < Alembic::Util::int32_t > big(200000, 2);
+        ABCA::ArrayPropertyWriterPtr bigp =
+            parent->createArrayProperty("big", ABCA::MetaData(), i32d, 0);
+        bigp->setSample(ABCA::ArraySample(&(big.front()), i32d,
+            Alembic::Util::Dimensions(big.size())));
+        bigp->setSample(ABCA::ArraySample(&(big.front()), i32d,
+            Alembic::Util::Dimensions(big.size())));
+    }
+
+    {
+        ABCA::ReadArraySampleCachePtr cache = AO::CreateCache(16 * 40000);
+
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r(archiveName, cache);
+        TESTING_ASSERT(a->getReadArraySampleCachePtr() == cache);
+
+        ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+        ABCA::ArrayPropertyReaderPtr counts =
+            parent->getArrayProperty("counts");
+        TESTING_ASSERT(counts->getNumSamples() == 5);
+
+        ABCA::ArraySamplePtr samps[5];
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            counts->getSample(i, samps[i]);
+            TESTING_ASSERT(samps[i]->getDimensions().numPoints() == 1000);
+            const Alembic::Util::int32_t * data =
+                (const Alembic::Util::int32_t *)(samps[i]->getData());
+            TESTING_ASSERT(data[0] == (i < 3 ? 3 : 4));
+            TESTING_ASSERT(data[999] == 4);
+        }
+
+        // read once, and then shared
+        TESTING_ASSERT(samps[0] == samps[1] && samps[0] == samps[2]);
+        TESTING_ASSERT(samps[3] == samps[4] && samps[0] != samps[3]);
+
+        // same bytes but a different shape
+        ABCA::ArraySamplePtr pairSamp;
+        parent->getArrayProperty("pairs")->getSample(0, pairSamp);
+        TESTING_ASSERT(pairSamp != samps[4]);
+        TESTING_ASSERT(pairSamp->getDataType() == i32d2);
+        TESTING_ASSERT(pairSamp->getDimensions().numPoints() == 500);
+
+        // too big, so each read makes its own copy
+        ABCA::ArraySamplePtr big0, big1;
+        ABCA::ArrayPropertyReaderPtr bigp = parent->getArrayProperty("big");
+        bigp->getSample(0, big0);
+        bigp->getSample(1, big1);
+        TESTING_ASSERT(big0 != big1);
+        TESTING_ASSERT(big0->getDimensions().numPoints() == 200000);
+    }
+
+    {
+        // the least recently used samples get dropped when it fills up
+        ABCA::ReadArraySampleCachePtr cache = AO::CreateCache(16 * 2500);
+        ABCA::DataType u8d(Alembic::Util::kUint8POD, 1);
+        std::vector < Alembic::Util::uint8_t > buf(1000);
+
+        std::vector < ABCA::ArraySampleKey > keys;
+        for (std::size_t i = 0; i < 200; ++i)
+        {
+            ABCA::ArraySamplePtr samp =
+                ABCA::AllocateArraySample(u8d, Alembic::Util::Dimensions(1000));
+            keys.push_back(samp->getKey());
+            keys.back().digest.words[0] = i;
+            cache->store(keys.back(), samp);
+
+            // keep the first one in use
+            TESTING_ASSERT(cache->find(keys[0]));
+        }
+
+        std::size_t numFound = 0;
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            if (cache->find(keys[i]))
+            {
+                numFound ++;
+            }
+        }
+
+        TESTING_ASSERT(numFound > 0 && numFound <= 40);
+        TESTING_ASSERT(cache->find(keys[0]));
+        TESTING_ASSERT(cache->find(keys.back()));
+        TESTING_ASSERT(!cache->find(keys[1]));
+
+        // a sample bigger than any one shard's share still gets cached, and
+        // the rest make room for it
+        ABCA::ArraySamplePtr samp =
+            ABCA::AllocateArraySample(u8d, Alembic::Util::Dimensions(30000));
+        ABCA::ArraySampleKey bigKey = samp->getKey();
+        bigKey.digest.words[0] = keys.size();
+        cache->store(bigKey, samp);
+
+        ABCA::ReadArraySampleID found = cache->find(bigKey);
+        TESTING_ASSERT(found && found.getSample() == samp);
+
+        numFound = 0;
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            if (cache->find(keys[i]))
+            {
+                numFound ++;
+            }
+        }
+        TESTING_ASSERT(numFound <= 10);
+        TESTING_ASSERT(cache->find(bigKey));
+
+        // and the whole budget can go to a single sample
+        samp = ABCA::AllocateArraySample(u8d, Alembic::Util::Dimensions(40000));
+        ABCA::ArraySampleKey wholeKey = samp->getKey();
+        wholeKey.digest.words[0] = keys.size() + 1;
+        cache->store(wholeKey, samp);
+        TESTING_ASSERT(cache->find(wholeKey));
+        TESTING_ASSERT(!cache->find(bigKey));
+    }
+}
+
+Alembic::Util::uint64_t getNumReads(ABCA::ArchiveReaderPtr iArchive)
+{
+    ABCA::ReadStatistics stats;
+    TESTING_ASSERT(iArchive->getReadStatistics(stats));
+
+    Alembic::Util::uint64_t numReads = 0;
+    for (std::size_t i = 0; i < stats.streams.size(); ++i)
+    {
+        numReads += stats.streams[i].numReads;
+    }
+    return numReads;
+}
+
+void testPrefetch(bool iUseMMap)
+{
+    std::string archiveName = "prefetch.abc";
+
+    ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr ap =
+            parent->createArrayProperty("a", ABCA::MetaData(), i32d, 0);
+        ABCA::ScalarPropertyWriterPtr sp =
+            parent->createScalarProperty("s", ABCA::MetaData(), i32d, 0);
+        for (Alembic::Util::int32_t i = 0; i < 5; ++i)
+        {
+            std::vector< Alembic::Util::int32_t > vals(100, i);
+            ap->setSample(ABCA::ArraySample(&vals.front(), i32d,
+                Dimensions(vals.size())));
+            sp->setSample(&i);
+        }
+
+        parent->createArrayProperty("empty", ABCA::MetaData(), i32d, 0);
+    }
+
+    AO::ReadArchive r(1, iUseMMap);
+    r.setCollectStatistics(true);
+    ABCA::ArchiveReaderPtr a = r(archiveName);
+    ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+    ABCA::ArrayPropertyReaderPtr ap = parent->getArrayProperty("a");
+    ABCA::ScalarPropertyReaderPtr sp = parent->getScalarProperty("s");
+    ABCA::ArrayPropertyReaderPtr emptyp = parent->getArrayProperty("empty");
+
+    // nothing to prefetch, so nothing gets read
+    a->resetReadStatistics();
+    ap->prefetch(3, 1);
+    ap->prefetch(5, 100);
+    ap->prefetch(-10, -1);
+    emptyp->prefetch(0, 100);
+    TESTING_ASSERT(getNumReads(a) == 0);
+
+    // out of range is clamped to the samples there are, and where they are
+    // stored is looked up
+    ap->prefetch(-5, 100);
+    TESTING_ASSERT(getNumReads(a) > 0);
+
+    a->resetReadStatistics();
+    sp->prefetch(2, 2);
+    TESTING_ASSERT(getNumReads(a) > 0);
+
+    // and reading them afterwards is no different
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        ABCA::ArraySamplePtr samp;
+        ap->getSample(i, samp);
+        TESTING_ASSERT(samp->getDimensions().numPoints() == 100);
+        TESTING_ASSERT(((const Alembic::Util::int32_t *)
+                        samp->getData())[99] == (Alembic::Util::int32_t) i);
+
+        Alembic::Util::int32_t val = -1;
+        sp->getSample(i, &val);
+        TESTING_ASSERT(val == (Alembic::Util::int32_t) i);
+    }
+}
+
+void testAsyncSamples(bool iUseMMap)
+{
+    std::string archiveName = "asyncSamples.abc";
+
+    ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr ap =
+            parent->createArrayProperty("ap", ABCA::MetaData(), i32d, 0);
+
+        std::vector < Alembic::Util::int32_t > vals;
+        for (Alembic::Util::int32_t i = 0; i < 200; ++i)
+        {
+            vals.assign(i + 1, i);
+            ap->setSample(ABCA::ArraySample(&(vals.front()), i32d,
+                Alembic::Util::Dimensions(vals.size())));
+        }
+    }
+
+    for (std::size_t numThreads = 0; numThreads < 8; numThreads += 4)
+    {
+        std::vector< std::future< ABCA::ArraySamplePtr > > futures;
+        std::future< ABCA::ArraySamplePtr > badFuture;
+
+        {
+            AO::ReadArchive r(2, iUseMMap);
+            r.setNumReadThreads(numThreads);
+            TESTING_ASSERT(r.getNumReadThreads() == numThreads);
+
+            ABCA::ArchiveReaderPtr a = r(archiveName);
+            ABCA::ArrayPropertyReaderPtr ap =
+                a->getTop()->getProperties()->getArrayProperty("ap");
+            TESTING_ASSERT(ap->getNumSamples() == 200);
+
+            // keep them all in flight, newest first
+            for (std::size_t i = 200; i > 0; --i)
+            {
+                futures.push_back(ap->getSampleAsync(i - 1));
+            }
+
+            badFuture = ap->getSampleAsync(200);
+        }
+
+        // the archive goes away once the reads it is waiting on are done
+        TESTING_ASSERT_THROW(badFuture.get(), Alembic::Util::Exception);
+
+        for (std::size_t i = 0; i < futures.size(); ++i)
+        {
+            ABCA::ArraySamplePtr samp = futures[i].get();
+            std::size_t numPoints = 200 - i;
+            Alembic::Util::int32_t val = numPoints - 1;
+            TESTING_ASSERT(samp->getDimensions().numPoints() == numPoints);
+
+            const Alembic::Util::int32_t * data =
+                (const Alembic::Util::int32_t *)(samp->getData());
+            TESTING_ASSERT(data[0] == val && data[val] == val);
+        }
+    }
+}
+
+void checkStrings(const StringArena & iStrings,
+                  const std::vector< std::string > & iExpected)
+{
+    TESTING_ASSERT(iStrings.size() == iExpected.size());
+    for (std::size_t i = 0; i < iExpected.size(); ++i)
+    {
+        TESTING_ASSERT(iStrings[i] == iExpected[i]);
+        TESTING_ASSERT(iStrings[i].data()[iExpected[i].size()] == 0);
+    }
+}
+
+void testStringArena(bool iUseMMap)
+{
+    std::string archiveName = "stringArena.abc";
+
+    std::vector< std::string > strs;
+    strs.push_back("a");
+    strs.push_back("");
+    strs.push_back("hello world");
+    strs.push_back("");
+
+    std::vector< std::string > lots;
+    for (std::size_t i = 0; i < 10000; ++i)
+    {
+        std::ostringstream strm;
+        strm << "/root/geo/instance" << i;
+        lots.push_back(strm.str());
+    }
+
+    ABCA::DataType strd(kStringPOD, 1);
+    ABCA::DataType str2d(kStringPOD, 2);
+
+    for (int hint = -1; hint < 2; hint += 2)
+    {
+        {
+            AO::WriteArchive w;
+            ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+            a->setCompressionHint(hint);
+            ABCA::CompoundPropertyWriterPtr parent =
+                a->getTop()->getProperties();
+
+            ABCA::ArrayPropertyWriterPtr ap =
+                parent->createArrayProperty("strs", ABCA::MetaData(), strd,
+                                            0);
+
+            StringArena arena;
+            for (std::size_t i = 0; i < strs.size(); ++i)
+            {
+                arena.push_back(strs[i]);
+            }
+            checkStrings(arena, strs);
+
+            std::string bad("bad\0string", 10);
+            TESTING_ASSERT_THROW(arena.push_back(bad),
+                                 Alembic::Util::Exception);
+            checkStrings(arena, strs);
+
+            // the same strings either way are the same sample
+            ap->setStrings(arena);
+            ap->setSample(ABCA::ArraySample(&strs.front(), strd,
+                Dimensions(strs.size())));
+
+            arena.clear();
+            TESTING_ASSERT(arena.empty());
+            ap->setStrings(arena);
+
+            for (std::size_t i = 0; i < lots.size(); ++i)
+            {
+                arena.push_back(lots[i]);
+            }
+            ap->setStrings(arena);
+            ap->setSample(ABCA::ArraySample(&lots.front(), strd,
+                Dimensions(lots.size())));
+
+            ABCA::ArrayPropertyWriterPtr ap2 =
+                parent->createArrayProperty("strs2", ABCA::MetaData(), str2d,
+                                            0);
+
+            arena.clear();
+            arena.push_back(strs[0]);
+            TESTING_ASSERT_THROW(ap2->setStrings(arena),
+                                 Alembic::Util::Exception);
+            TESTING_ASSERT(ap2->getNumSamples() == 0);
+
+            for (std::size_t i = 1; i < strs.size(); ++i)
+            {
+                arena.push_back(strs[i]);
+            }
+            ap2->setStrings(arena);
+
+            ABCA::ArrayPropertyWriterPtr ints =
+                parent->createArrayProperty("ints", ABCA::MetaData(),
+                    ABCA::DataType(kInt32POD, 1), 0);
+            TESTING_ASSERT_THROW(ints->setStrings(arena),
+                                 Alembic::Util::Exception);
+        }
+
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r(archiveName);
+        ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+
+        ABCA::ArrayPropertyReaderPtr ap = parent->getArrayProperty("strs");
+        TESTING_ASSERT(ap->getNumSamples() == 5);
+
+        ABCA::ArraySampleKey key0;
+        ABCA::ArraySampleKey key1;
+        TESTING_ASSERT(ap->getKey(0, key0) && ap->getKey(1, key1));
+        TESTING_ASSERT(key0 == key1);
+        TESTING_ASSERT(ap->getKey(3, key0) && ap->getKey(4, key1));
+        TESTING_ASSERT(key0 == key1);
+
+        // one arena over and over, the way it is meant to be used
+        StringArena arena;
+        for (std::size_t j = 0; j < 2; ++j)
+        {
+            ap->getStrings(0, arena);
+            checkStrings(arena, strs);
+
+            ap->getStrings(1, arena);
+            checkStrings(arena, strs);
+
+            ap->getStrings(2, arena);
+            TESTING_ASSERT(arena.empty());
+            TESTING_ASSERT(arena.numChars() == 0);
+
+            ap->getStrings(4, arena);
+            checkStrings(arena, lots);
+
+            ABCA::ArraySamplePtr samp;
+            ap->getSample(3, samp);
+            TESTING_ASSERT(samp->getDimensions().numPoints() == lots.size());
+            const std::string * data =
+                static_cast< const std::string * >(samp->getData());
+            for (std::size_t i = 0; i < lots.size(); ++i)
+            {
+                TESTING_ASSERT(arena[i] == data[i]);
+            }
+        }
+
+        TESTING_ASSERT_THROW(ap->getStrings(5, arena),
+                             Alembic::Util::Exception);
+
+        ABCA::ArrayPropertyReaderPtr ap2 = parent->getArrayProperty("strs2");
+        TESTING_ASSERT(ap2->getNumSamples() == 1);
+        ap2->getStrings(0, arena);
+        checkStrings(arena, strs);
+
+        Dimensions dims;
+        ap2->getDimensions(0, dims);
+        TESTING_ASSERT(dims.numPoints() == 2);
+
+        ABCA::ArrayPropertyReaderPtr ints = parent->getArrayProperty("ints");
+        TESTING_ASSERT_THROW(ints->getStrings(0, arena),
+                             Alembic::Util::Exception);
+    }
+}
+
+void checkKeyRuns(ABCA::ArrayPropertyReaderPtr iProp,
+                  const std::vector< ABCA::index_t > & iFirsts)
+{
+    ABCA::ArraySampleKeyRuns runs;
+    iProp->getKeyRuns(runs);
+    TESTING_ASSERT(runs.size() == iFirsts.size());
+
+    // the same as going through the keys one at a time
+    ABCA::index_t numSamples = iProp->getNumSamples();
+    ABCA::ArraySampleKeyRuns expected;
+    iProp->ABCA::ArrayPropertyReader::getKeyRuns(expected);
+    TESTING_ASSERT(runs.size() == expected.size());
+
+    for (std::size_t i = 0; i < runs.size(); ++i)
+    {
+        TESTING_ASSERT(runs[i].first == iFirsts[i]);
+        TESTING_ASSERT(runs[i].first == expected[i].first);
+        TESTING_ASSERT(runs[i].last == expected[i].last);
+        TESTING_ASSERT(runs[i].key == expected[i].key);
+
+        ABCA::index_t last = (i + 1 < runs.size()) ?
+            runs[i + 1].first - 1 : numSamples - 1;
+        TESTING_ASSERT(runs[i].last == last);
+    }
+}
+
+void testKeyRuns(bool iUseMMap)
+{
+    std::string archiveName = "keyRuns.abc";
+
+    ABCA::DataType i32d(kInt32POD, 1);
+
+    // repeats at the start and the end aren't stored the same way as the
+    // ones in between, and 0 comes back after it changes
+    Alembic::Util::int32_t changes[] = { 0, 0, 0, 1, 1, 2, 0, 0, 3, 3, 3 };
+    std::size_t numChanges = sizeof(changes) / sizeof(changes[0]);
+
+    // enough for the keys to be read in more than one go
+    std::size_t numMany = 40000;
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr ap =
+            parent->createArrayProperty("changes", ABCA::MetaData(), i32d, 0);
+        std::vector< Alembic::Util::int32_t > vals;
+        for (std::size_t i = 0; i < numChanges; ++i)
+        {
+            vals.assign(1000, changes[i]);
+            ap->setSample(ABCA::ArraySample(&vals.front(), i32d,
+                Dimensions(vals.size())));
+        }
+
+        ap = parent->createArrayProperty("constant", ABCA::MetaData(), i32d,
+                                         0);
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            ap->setSample(ABCA::ArraySample(&vals.front(), i32d,
+                Dimensions(vals.size())));
+        }
+
+        parent->createArrayProperty("empty", ABCA::MetaData(), i32d, 0);
+
+        ap = parent->createArrayProperty("many", ABCA::MetaData(), i32d, 0);
+        for (std::size_t i = 0; i < numMany; ++i)
+        {
+            Alembic::Util::int32_t val = i / 2;
+            ap->setSample(ABCA::ArraySample(&val, i32d, Dimensions(1)));
+        }
+    }
+
+    AO::ReadArchive r(1, iUseMMap);
+    r.setCollectStatistics(true);
+    ABCA::ArchiveReaderPtr a = r(archiveName);
+    ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+
+    ABCA::ArrayPropertyReaderPtr ap = parent->getArrayProperty("changes");
+
+    // none of the sample data gets read
+    a->resetReadStatistics();
+    ABCA::ArraySampleKeyRuns runs;
+    ap->getKeyRuns(runs);
+
+    ABCA::ReadStatistics stats;
+    TESTING_ASSERT(a->getReadStatistics(stats));
+    Alembic::Util::uint64_t numBytes = 0;
+    for (std::size_t i = 0; i < stats.streams.size(); ++i)
+    {
+        numBytes += stats.streams[i].numBytes;
+    }
+    TESTING_ASSERT(numBytes < 1000 * sizeof(Alembic::Util::int32_t));
+
+    std::vector< ABCA::index_t > firsts;
+    firsts.push_back(0);
+    firsts.push_back(3);
+    firsts.push_back(5);
+    firsts.push_back(6);
+    firsts.push_back(8);
+    checkKeyRuns(ap, firsts);
+    TESTING_ASSERT(runs[0].key == runs[3].key);
+    TESTING_ASSERT(runs[0].key != runs[1].key);
+    TESTING_ASSERT(runs[0].key.numBytes ==
+                   1000 * sizeof(Alembic::Util::int32_t));
+
+    firsts.resize(1);
+    checkKeyRuns(parent->getArrayProperty("constant"), firsts);
+
+    firsts.clear();
+    checkKeyRuns(parent->getArrayProperty("empty"), firsts);
+
+    for (std::size_t i = 0; i < numMany; i += 2)
+    {
+        firsts.push_back(i);
+    }
+    checkKeyRuns(parent->getArrayProperty("many"), firsts);
+}
+
+void testCopySamples(bool iUseMMap)
+{
+    std::string archiveName = "copySamplesFrom.abc";
+    std::string copyName = "copySamplesTo.abc";
+
+    std::vector < Alembic::Util::float32_t > points;
+    for (std::size_t i = 0; i < 30000; ++i)
+    {
+        points.push_back((i % 100) * 0.1f);
+    }
+
+    std::vector < Alembic::Util::string > strs;
+    strs.push_back("copy");
+    strs.push_back("");
+    strs.push_back("me");
+
+    ABCA::DataType f3d(Alembic::Util::kFloat32POD, 3);
+    ABCA::DataType strd(Alembic::Util::kStringPOD, 1);
+    Alembic::Util::Dimensions dims(points.size() / 3);
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        a->setCompressionHint(1);
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr pwp =
+            parent->createArrayProperty("P", ABCA::MetaData(), f3d, 0);
+        pwp->setSample(ABCA::ArraySample(&(points.front()), f3d, dims));
+        pwp->setSample(ABCA::ArraySample(NULL, f3d, Dimensions(0)));
+        pwp->setSample(ABCA::ArraySample(&(points.front()), f3d, dims));
+
+        ABCA::ArrayPropertyWriterPtr swp =
+            parent->createArrayProperty("s", ABCA::MetaData(), strd, 0);
+        swp->setSample(ABCA::ArraySample(&(strs.front()), strd,
+            Alembic::Util::Dimensions(strs.size())));
+        swp->setSample(ABCA::ArraySample(NULL, strd, Dimensions(0)));
+    }
+
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr ar = r(archiveName);
+        ABCA::CompoundPropertyReaderPtr iparent =
+            ar->getTop()->getProperties();
+
+        // without compression, so that a sample which wasn't shared with
+        // the copied ones would be hard to miss
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(copyName, ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        const char * names[] = { "P", "s" };
+        for (std::size_t i = 0; i < 2; ++i)
+        {
+            ABCA::ArrayPropertyReaderPtr rp =
+                iparent->getArrayProperty(names[i]);
+            ABCA::ArrayPropertyWriterPtr wp = parent->createArrayProperty(
+                names[i], ABCA::MetaData(), rp->getDataType(), 0);
+            for (std::size_t j = 0; j < rp->getNumSamples(); ++j)
+            {
+                wp->setSampleFromReader(rp, j);
+            }
+        }
+
+        ABCA::ArrayPropertyWriterPtr wp =
+            parent->createArrayProperty("again", ABCA::MetaData(), f3d, 0);
+        wp->setSample(ABCA::ArraySample(&(points.front()), f3d, dims));
+
+        // the DataType has to match
+        wp = parent->createArrayProperty("wrong", ABCA::MetaData(), strd, 0);
+        TESTING_ASSERT_THROW(wp->setSampleFromReader(
+            iparent->getArrayProperty("P"), 0), Alembic::Util::Exception);
+    }
+
+    {
+        std::ifstream copyFile(copyName.c_str(),
+                               std::ios::binary | std::ios::ate);
+        TESTING_ASSERT(copyFile.tellg() <
+                       (std::streamoff)(points.size() * 2));
+    }
+
+    AO::ReadArchive r(1, iUseMMap);
+    ABCA::ArchiveReaderPtr a = r(copyName);
+    ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+
+    ABCA::ArrayPropertyReaderPtr prp = parent->getArrayProperty("P");
+    TESTING_ASSERT(prp->getNumSamples() == 3);
+    for (std::size_t s = 0; s < 3; ++s)
+    {
+        ABCA::ArraySamplePtr samp;
+        prp->getSample(s, samp);
+
+        ABCA::ArraySampleKey key;
+        TESTING_ASSERT(prp->getKey(s, key));
+        TESTING_ASSERT(key == samp->getKey());
+
+        if (s == 1)
+        {
+            TESTING_ASSERT(samp->getDimensions().numPoints() == 0);
+            continue;
+        }
+
+        TESTING_ASSERT(samp->getDimensions().numPoints() * 3 ==
+                       points.size());
+        const Alembic::Util::float32_t * data =
+            (const Alembic::Util::float32_t *)(samp->getData());
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            TESTING_ASSERT(data[i] == points[i]);
+        }
+    }
+
+    ABCA::ArraySampleKey key;
+    ABCA::ArraySampleKey againKey;
+    TESTING_ASSERT(prp->getKey(0, key));
+    TESTING_ASSERT(parent->getArrayProperty("again")->getKey(0, againKey));
+    TESTING_ASSERT(key == againKey);
+
+    ABCA::ArrayPropertyReaderPtr srp = parent->getArrayProperty("s");
+    TESTING_ASSERT(srp->getNumSamples() == 2);
+
+    ABCA::ArraySamplePtr samp;
+    srp->getSample(0, samp);
+    TESTING_ASSERT(samp->getDimensions().numPoints() == strs.size());
+    const Alembic::Util::string * sdata =
+        (const Alembic::Util::string *)(samp->getData());
+    for (std::size_t i = 0; i < strs.size(); ++i)
+    {
+        TESTING_ASSERT(sdata[i] == strs[i]);
+    }
+
+    srp->getSample(1, samp);
+    TESTING_ASSERT(samp->getDimensions().numPoints() == 0);
+}
+
 void runTests(bool iUseMMap)
 {
     testEmptyArray(iUseMMap);
@@ -2025,6 +3063,17 @@ void runTests(bool iUseMMap)
     testExtentArrayStrings(iUseMMap);
     testArrayStringsRepeats(iUseMMap);
     testArraySamples(iUseMMap);
+    testZeroCopyArray(iUseMMap);
+    testZeroCopyAlignment< Alembic::Util::float32_t >(iUseMMap, kFloat32POD);
+    testZeroCopyAlignment< Alembic::Util::float64_t >(iUseMMap, kFloat64POD);
+    testCompressedArrays(iUseMMap);
+    testSmallCompressedArrays(iUseMMap);
+    testSampleCache(iUseMMap);
+    testPrefetch(iUseMMap);
+    testAsyncSamples(iUseMMap);
+    testStringArena(iUseMMap);
+    testKeyRuns(iUseMMap);
+    testCopySamples(iUseMMap);
 
     if (!iUseMMap)
     {
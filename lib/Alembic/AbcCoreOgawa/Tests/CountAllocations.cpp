@@ -0,0 +1,86 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include "CountAllocations.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+//-*****************************************************************************
+static std::atomic< std::size_t > g_numAllocations( 0 );
+
+std::size_t GetNumAllocations()
+{
+    return g_numAllocations;
+}
+
+//-*****************************************************************************
+void * operator new( std::size_t iSize )
+{
+    ++g_numAllocations;
+    void * p = std::malloc( iSize > 0 ? iSize : 1 );
+    if ( !p )
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void * operator new[]( std::size_t iSize )
+{
+    return operator new( iSize );
+}
+
+void operator delete( void * iPtr ) noexcept
+{
+    std::free( iPtr );
+}
+
+void operator delete[]( void * iPtr ) noexcept
+{
+    std::free( iPtr );
+}
+
+void operator delete( void * iPtr, std::size_t ) noexcept
+{
+    std::free( iPtr );
+}
+
+void operator delete[]( void * iPtr, std::size_t ) noexcept
+{
+    std::free( iPtr );
+}
@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <sstream>
+#include <vector>
 #include <Alembic/AbcCoreAbstract/All.h>
 #include <Alembic/AbcCoreOgawa/All.h>
 #include <Alembic/Util/All.h>
@@ -301,11 +302,241 @@ void testMetaData(bool iUseMMap)
     }
 }
 
+// walks everything under iObj, checking the values written by
+// testPreloadHierarchy, and returns how many objects there were
+std::size_t walkPreloadHierarchy(AbcA::ObjectReaderPtr iObj)
+{
+    std::size_t numObjects = 0;
+    for (std::size_t i = 0; i < iObj->getNumChildren(); ++i)
+    {
+        AbcA::ObjectReaderPtr child = iObj->getChild(i);
+        TESTING_ASSERT(child == iObj->getChild(child->getName()));
+
+        AbcA::CompoundPropertyReaderPtr geom =
+            child->getProperties()->getCompoundProperty("geom");
+        AbcA::CompoundPropertyReaderPtr arb =
+            geom->getCompoundProperty("arb");
+        TESTING_ASSERT(arb->getMetaData().get("name") == child->getName());
+
+        Alembic::Util::int32_t val = 0;
+        arb->getScalarProperty("v")->getSample(0, &val);
+        TESTING_ASSERT(val == (Alembic::Util::int32_t) child->getNumChildren());
+
+        numObjects += 1 + walkPreloadHierarchy(child);
+    }
+    return numObjects;
+}
+
+void testPreloadHierarchy(bool iUseMMap)
+{
+    std::string archiveName = "objectPreloadTest.abc";
+    {
+        AO::WriteArchive w;
+        AbcA::ArchiveWriterPtr a = w(archiveName, AbcA::MetaData());
+        AbcA::ObjectWriterPtr archive = a->getTop();
+
+        // each object has some nested compound properties, the numbers of
+        // children are known up front so they are written as we go
+        std::vector< AbcA::ObjectWriterPtr > parents(1, archive);
+        for (std::size_t depth = 0; depth < 3; ++depth)
+        {
+            Alembic::Util::int32_t numChildren = (depth < 2) ? 12 : 0;
+
+            std::vector< AbcA::ObjectWriterPtr > children;
+            for (std::size_t i = 0; i < parents.size(); ++i)
+            {
+                for (std::size_t j = 0; j < 12; ++j)
+                {
+                    std::stringstream strm;
+                    strm << "obj" << j;
+                    AbcA::ObjectWriterPtr child = parents[i]->createChild(
+                        AbcA::ObjectHeader(strm.str(), AbcA::MetaData()));
+                    children.push_back(child);
+
+                    AbcA::CompoundPropertyWriterPtr geom =
+                        child->getProperties()->createCompoundProperty(
+                            "geom", AbcA::MetaData());
+                    AbcA::MetaData md;
+                    md.set("name", strm.str());
+                    AbcA::CompoundPropertyWriterPtr arb =
+                        geom->createCompoundProperty("arb", md);
+
+                    arb->createScalarProperty("v", AbcA::MetaData(),
+                        AbcA::DataType(Alembic::Util::kInt32POD, 1), 0)->
+                            setSample(&numChildren);
+                }
+            }
+            parents.swap(children);
+        }
+    }
+
+    // what reading everything lazily reads
+    AbcA::ReadStatistics lazyStats;
+    {
+        AO::ReadArchive r(2, iUseMMap);
+        r.setCollectStatistics(true);
+        AbcA::ArchiveReaderPtr a = r( archiveName );
+        TESTING_ASSERT(walkPreloadHierarchy(a->getTop()) == 12 + 144 + 1728);
+        TESTING_ASSERT(a->getReadStatistics(lazyStats));
+    }
+
+    // with and without threads to preload with
+    for (std::size_t numThreads = 0; numThreads < 8; numThreads += 4)
+    {
+        AO::ReadArchive r(2, iUseMMap);
+        r.setCollectStatistics(true);
+        r.setNumReadThreads(numThreads);
+        r.setPreloadHierarchy(true);
+        TESTING_ASSERT(r.getPreloadHierarchy());
+
+        AbcA::ArchiveReaderPtr a = r( archiveName );
+
+        // every header was read as the archive was opened
+        AbcA::ReadStatistics stats;
+        TESTING_ASSERT(a->getReadStatistics(stats));
+        TESTING_ASSERT(stats.numObjectHeaders == lazyStats.numObjectHeaders);
+        TESTING_ASSERT(stats.numPropertyHeaders ==
+                       lazyStats.numPropertyHeaders);
+
+        // and none of them are read again
+        TESTING_ASSERT(walkPreloadHierarchy(a->getTop()) == 12 + 144 + 1728);
+        TESTING_ASSERT(a->getReadStatistics(stats));
+        TESTING_ASSERT(stats.numObjectHeaders == lazyStats.numObjectHeaders);
+        TESTING_ASSERT(stats.numPropertyHeaders ==
+                       lazyStats.numPropertyHeaders);
+    }
+}
+
+//-*****************************************************************************
+void testPathIndex(bool iUseMMap)
+{
+    // with and without the index, looking objects up should give the same
+    // results either way
+    for (int pathIndex = 0; pathIndex < 2; ++pathIndex)
+    {
+        std::string archiveName = "objectPathIndexTest.abc";
+        {
+            AO::WriteArchive w;
+            w.setPathIndex(pathIndex == 1);
+            TESTING_ASSERT(w.getPathIndex() == (pathIndex == 1));
+            AbcA::ArchiveWriterPtr a = w(archiveName, AbcA::MetaData());
+
+            // 3 levels of 4 children each, the first of which has meta data
+            // too big to be shared
+            std::vector< AbcA::ObjectWriterPtr > parents(1, a->getTop());
+            for (std::size_t depth = 0; depth < 3; ++depth)
+            {
+                std::vector< AbcA::ObjectWriterPtr > children;
+                for (std::size_t i = 0; i < parents.size(); ++i)
+                {
+                    for (std::size_t j = 0; j < 4; ++j)
+                    {
+                        std::stringstream strm;
+                        strm << "obj" << j;
+                        AbcA::MetaData md;
+                        md.set("name", strm.str());
+                        if (j == 0)
+                        {
+                            md.set("big", std::string(300, 'x'));
+                        }
+
+                        AbcA::ObjectWriterPtr child = parents[i]->createChild(
+                            AbcA::ObjectHeader(strm.str(), md));
+                        children.push_back(child);
+
+                        Alembic::Util::int32_t val = (Alembic::Util::int32_t)
+                            ( depth * 4 + j );
+                        child->getProperties()->createScalarProperty("v",
+                            AbcA::MetaData(),
+                            AbcA::DataType(Alembic::Util::kInt32POD, 1), 0)->
+                                setSample(&val);
+                    }
+                }
+                parents.swap(children);
+            }
+        }
+
+        AO::ReadArchive r(2, iUseMMap);
+        r.setCollectStatistics(true);
+        AbcA::ArchiveReaderPtr a = r( archiveName );
+
+        a->resetReadStatistics();
+        AbcA::ObjectReaderPtr obj = a->getObjectByPath("/obj3/obj0/obj2");
+        TESTING_ASSERT(obj);
+        TESTING_ASSERT(obj->getName() == "obj2");
+        TESTING_ASSERT(obj->getFullName() == "/obj3/obj0/obj2");
+        TESTING_ASSERT(obj->getMetaData().get("name") == "obj2");
+        TESTING_ASSERT(obj->getNumChildren() == 0);
+
+        // the index lets it skip reading the headers of the objects above it
+        AbcA::ReadStatistics stats;
+        TESTING_ASSERT(a->getReadStatistics(stats));
+        TESTING_ASSERT(stats.numObjectHeaders == (pathIndex == 1 ? 0 : 8));
+
+        Alembic::Util::int32_t val = 0;
+        obj->getProperties()->getScalarProperty("v")->getSample(0, &val);
+        TESTING_ASSERT(val == 10);
+
+        // the parents are still there to be walked back up
+        AbcA::ObjectReaderPtr parent = obj->getParent();
+        TESTING_ASSERT(parent);
+        TESTING_ASSERT(obj->getParent() == parent);
+        TESTING_ASSERT(parent->getFullName() == "/obj3/obj0");
+        TESTING_ASSERT(parent->getMetaData().get("big") ==
+                       std::string(300, 'x'));
+        TESTING_ASSERT(parent->getChild("obj2")->getFullName() ==
+                       obj->getFullName());
+        TESTING_ASSERT(parent->getParent()->getFullName() == "/obj3");
+        TESTING_ASSERT(parent->getParent()->getParent()->getFullName() == "/");
+        TESTING_ASSERT(!parent->getParent()->getParent()->getParent());
+
+        obj = a->getObjectByPath("/obj0");
+        TESTING_ASSERT(obj && obj->getNumChildren() == 4);
+        TESTING_ASSERT(obj->getMetaData().get("big") == std::string(300, 'x'));
+        TESTING_ASSERT(obj->getParent()->getFullName() == "/");
+
+        // every object can be found
+        std::vector< AbcA::ObjectReaderPtr > objects(1, a->getTop());
+        for (std::size_t i = 0; i < objects.size(); ++i)
+        {
+            for (std::size_t j = 0; j < objects[i]->getNumChildren(); ++j)
+            {
+                AbcA::ObjectReaderPtr child = objects[i]->getChild(j);
+                obj = a->getObjectByPath(child->getFullName());
+                TESTING_ASSERT(obj);
+                TESTING_ASSERT(obj->getHeader().getFullName() ==
+                               child->getFullName());
+                TESTING_ASSERT(obj->getMetaData().serialize() ==
+                               child->getMetaData().serialize());
+                TESTING_ASSERT(obj->getNumChildren() ==
+                               child->getNumChildren());
+                objects.push_back(child);
+            }
+        }
+        TESTING_ASSERT(objects.size() == 1 + 4 + 16 + 64);
+
+        // other spellings get walked down to
+        TESTING_ASSERT(a->getObjectByPath("/")->getFullName() == "/");
+        TESTING_ASSERT(a->getObjectByPath("")->getFullName() == "/");
+        TESTING_ASSERT(a->getObjectByPath("obj1/obj2")->getFullName() ==
+                       "/obj1/obj2");
+        TESTING_ASSERT(a->getObjectByPath("/obj1//obj2/")->getFullName() ==
+                       "/obj1/obj2");
+
+        TESTING_ASSERT(!a->getObjectByPath("/obj4"));
+        TESTING_ASSERT(!a->getObjectByPath("/obj1/obj2/obj3/obj0"));
+        TESTING_ASSERT(!a->getObjectByPath("/obj"));
+        TESTING_ASSERT(!a->getObjectByPath("/obj1/obj20"));
+    }
+}
+
 void runTests(bool iUseMMap)
 {
     testObjects(iUseMMap);
     testChildObjects(iUseMMap);
     testMetaData(iUseMMap);
+    testPreloadHierarchy(iUseMMap);
+    testPathIndex(iUseMMap);
 }
 
 int main ( int argc, char *argv[] )
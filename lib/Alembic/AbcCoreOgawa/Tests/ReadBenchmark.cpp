@@ -0,0 +1,462 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include "CountAllocations.h"
+#include "ReferenceConvert.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace AbcA = Alembic::AbcCoreAbstract;
+
+//-*****************************************************************************
+static const std::size_t NUM_SAMPLES = 8;
+static const std::size_t NUM_REPEATS = 100000;
+
+//-*****************************************************************************
+void writeArchive( const std::string & iArchiveName )
+{
+    AO::WriteArchive w;
+    AbcA::ArchiveWriterPtr a = w( iArchiveName, AbcA::MetaData() );
+    AbcA::ObjectWriterPtr top = a->getTop();
+    AbcA::CompoundPropertyWriterPtr props = top->getProperties();
+
+    AbcA::ScalarPropertyWriterPtr visible = props->createScalarProperty(
+        "visible", AbcA::MetaData(),
+        AbcA::DataType( Alembic::Util::kInt8POD, 1 ), 0 );
+
+    AbcA::DataType floatType( Alembic::Util::kFloat32POD, 3 );
+    AbcA::ArrayPropertyWriterPtr points = props->createArrayProperty(
+        "P", AbcA::MetaData(), floatType, 0 );
+
+    std::vector< Alembic::Util::float32_t > pts( 300 );
+    for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+    {
+        Alembic::Util::int8_t vis = i % 2;
+        visible->setSample( &vis );
+
+        for ( std::size_t j = 0; j < pts.size(); ++j )
+        {
+            pts[j] = ( Alembic::Util::float32_t )( i + j );
+        }
+        points->setSample( AbcA::ArraySample( &pts.front(), floatType,
+            Alembic::Util::Dimensions( pts.size() / 3 ) ) );
+    }
+}
+
+//-*****************************************************************************
+// Times NUM_REPEATS passes over the samples, stop reports how long a read
+// took and how many allocations there were, which ReadTests makes sure is
+// none.
+class Timer
+{
+public:
+    Timer( const std::string & iName )
+      : m_name( iName )
+      , m_numAllocations( GetNumAllocations() )
+      , m_start( std::chrono::steady_clock::now() )
+    {
+    }
+
+    void stop()
+    {
+        std::chrono::steady_clock::duration elapsed =
+            std::chrono::steady_clock::now() - m_start;
+        std::size_t numAllocations = GetNumAllocations() - m_numAllocations;
+
+        double ns = std::chrono::duration< double, std::nano >(
+            elapsed ).count() / ( NUM_REPEATS * NUM_SAMPLES );
+
+        std::cout << "    " << m_name << ": " << ns << " ns per read, "
+                  << numAllocations << " allocations" << std::endl;
+    }
+
+private:
+    std::string m_name;
+    std::size_t m_numAllocations;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+//-*****************************************************************************
+void readArchive( const std::string & iArchiveName, bool iUseMMap )
+{
+    std::cout << ( iUseMMap ? "mmap" : "streams" ) << std::endl;
+
+    // more than one stream, so that reads lease them from the manager
+    AO::ReadArchive r( 4, iUseMMap );
+    AbcA::ArchiveReaderPtr a = r( iArchiveName, AO::CreateCache( 1 << 20 ) );
+    AbcA::CompoundPropertyReaderPtr props = a->getTop()->getProperties();
+
+    AbcA::ScalarPropertyReaderPtr visible =
+        props->getScalarProperty( "visible" );
+    AbcA::ArrayPropertyReaderPtr points = props->getArrayProperty( "P" );
+    TESTING_ASSERT( visible && points );
+    TESTING_ASSERT( visible->getNumSamples() == NUM_SAMPLES );
+    TESTING_ASSERT( points->getNumSamples() == NUM_SAMPLES );
+
+    Alembic::Util::int8_t vis = 0;
+    AbcA::ArraySamplePtr samp;
+    AbcA::ArraySampleKey key;
+    Alembic::Util::Dimensions dims;
+    std::vector< Alembic::Util::float32_t > pts( 300 );
+
+    // the first time around the samples end up in the cache, and dims gets
+    // its rank
+    for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+    {
+        visible->getSample( i, &vis );
+        TESTING_ASSERT( vis == ( Alembic::Util::int8_t )( i % 2 ) );
+
+        points->getSample( i, samp );
+        TESTING_ASSERT( samp->getDimensions().numPoints() == 100 );
+        points->getDimensions( i, dims );
+        TESTING_ASSERT( dims.numPoints() == 100 );
+    }
+    samp.reset();
+
+    {
+        Timer t( "ScalarPropertyReader::getSample" );
+        for ( std::size_t j = 0; j < NUM_REPEATS; ++j )
+        {
+            for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+            {
+                visible->getSample( i, &vis );
+            }
+        }
+        t.stop();
+    }
+
+    {
+        Timer t( "ArrayPropertyReader::getSample, cached" );
+        for ( std::size_t j = 0; j < NUM_REPEATS; ++j )
+        {
+            for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+            {
+                points->getSample( i, samp );
+            }
+        }
+        t.stop();
+    }
+    samp.reset();
+
+    {
+        Timer t( "ArrayPropertyReader::getKey" );
+        for ( std::size_t j = 0; j < NUM_REPEATS; ++j )
+        {
+            for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+            {
+                points->getKey( i, key );
+            }
+        }
+        t.stop();
+    }
+
+    {
+        Timer t( "ArrayPropertyReader::getDimensions" );
+        for ( std::size_t j = 0; j < NUM_REPEATS; ++j )
+        {
+            for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+            {
+                points->getDimensions( i, dims );
+            }
+        }
+        t.stop();
+    }
+
+    {
+        Timer t( "ArrayPropertyReader::getAs" );
+        for ( std::size_t j = 0; j < NUM_REPEATS; ++j )
+        {
+            for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+            {
+                points->getAs( i, &pts.front(), Alembic::Util::kFloat32POD );
+            }
+        }
+        t.stop();
+    }
+    TESTING_ASSERT( pts[0] ==
+                    ( Alembic::Util::float32_t )( NUM_SAMPLES - 1 ) );
+}
+
+//-*****************************************************************************
+static const std::size_t NUM_CONVERT_REPEATS = 20;
+
+//-*****************************************************************************
+// Reads every POD as every other POD with getAs, checking the results against
+// the reference conversion and comparing how long each takes.
+void convertBenchmark()
+{
+    std::cout << "getAs conversions, ns per value, new vs reference"
+              << std::endl;
+
+    std::string archiveName = "convertBenchmark.abc";
+    writeConvertArchive( archiveName );
+
+    AO::ReadArchive r;
+    AbcA::ArchiveReaderPtr a = r( archiveName );
+    AbcA::CompoundPropertyReaderPtr props = a->getTop()->getProperties();
+
+    std::vector< char > from( NUM_CONVERT * 8 );
+    std::vector< char > to( NUM_CONVERT * 8 );
+    std::vector< char > reference( NUM_CONVERT * 8 );
+    for ( std::size_t i = 0; i < NUM_CONVERT_PODS; ++i )
+    {
+        for ( std::size_t j = 0; j < NUM_CONVERT_PODS; ++j )
+        {
+            if ( i == j )
+            {
+                continue;
+            }
+
+            AbcA::ArrayPropertyReaderPtr prop =
+                props->getArrayProperty( convertName( i, j ) );
+            ConvertFunc convert =
+                referenceFunc( CONVERT_PODS[i], CONVERT_PODS[j] );
+
+            std::chrono::steady_clock::time_point start =
+                std::chrono::steady_clock::now();
+            for ( std::size_t k = 0; k < NUM_CONVERT_REPEATS; ++k )
+            {
+                prop->getAs( 0, &to.front(), CONVERT_PODS[j] );
+            }
+            double newNs = std::chrono::duration< double, std::nano >(
+                std::chrono::steady_clock::now() - start ).count() /
+                ( NUM_CONVERT_REPEATS * NUM_CONVERT );
+
+            start = std::chrono::steady_clock::now();
+            for ( std::size_t k = 0; k < NUM_CONVERT_REPEATS; ++k )
+            {
+                prop->getAs( 0, &from.front(), CONVERT_PODS[i] );
+                convert( &from.front(), &reference.front(), NUM_CONVERT );
+            }
+            double referenceNs = std::chrono::duration< double, std::nano >(
+                std::chrono::steady_clock::now() - start ).count() /
+                ( NUM_CONVERT_REPEATS * NUM_CONVERT );
+
+            std::cout << "    " << Alembic::Util::PODName( CONVERT_PODS[i] )
+                      << " -> " << Alembic::Util::PODName( CONVERT_PODS[j] )
+                      << ": " << newNs << " vs " << referenceNs << std::endl;
+
+            TESTING_ASSERT( sameValues( CONVERT_PODS[j], &to.front(),
+                                        &reference.front(), NUM_CONVERT ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+static const std::size_t NUM_TRAVERSAL_CHILDREN = 16;
+static const std::size_t NUM_TRAVERSAL_PASSES = 200;
+
+//-*****************************************************************************
+void writeTraversalArchive( const std::string & iArchiveName )
+{
+    AO::WriteArchive w;
+    AbcA::ArchiveWriterPtr a = w( iArchiveName, AbcA::MetaData() );
+    AbcA::ObjectWriterPtr top = a->getTop();
+
+    AbcA::DataType floatType( Alembic::Util::kFloat32POD, 3 );
+    AbcA::DataType intType( Alembic::Util::kInt32POD, 1 );
+    std::vector< Alembic::Util::float32_t > pts( 30, 1.0f );
+    Alembic::Util::int32_t val = 3;
+
+    for ( std::size_t i = 0; i < NUM_TRAVERSAL_CHILDREN; ++i )
+    {
+        std::ostringstream name;
+        name << "group" << i;
+        AbcA::ObjectWriterPtr group = top->createChild(
+            AbcA::ObjectHeader( name.str(), AbcA::MetaData() ) );
+
+        for ( std::size_t j = 0; j < NUM_TRAVERSAL_CHILDREN; ++j )
+        {
+            std::ostringstream leafName;
+            leafName << "leaf" << j;
+            AbcA::ObjectWriterPtr leaf = group->createChild(
+                AbcA::ObjectHeader( leafName.str(), AbcA::MetaData() ) );
+
+            AbcA::CompoundPropertyWriterPtr props = leaf->getProperties();
+            props->createArrayProperty( "P", AbcA::MetaData(), floatType, 0
+                )->setSample( AbcA::ArraySample( &pts.front(), floatType,
+                    Alembic::Util::Dimensions( pts.size() / 3 ) ) );
+            props->createCompoundProperty( "arbGeomParams", AbcA::MetaData()
+                )->createScalarProperty( "id", AbcA::MetaData(), intType, 0
+                )->setSample( &val );
+        }
+    }
+}
+
+//-*****************************************************************************
+// Walks down to every property of the archive, over and over, the way many
+// render threads looking up what they need from the same archive would.
+struct TraversalWorker
+{
+    AbcA::ObjectReaderPtr top;
+    std::size_t * numLookups;
+
+    void operator()() const
+    {
+        std::size_t lookups = 0;
+        for ( std::size_t pass = 0; pass < NUM_TRAVERSAL_PASSES; ++pass )
+        {
+            for ( std::size_t i = 0; i < top->getNumChildren(); ++i )
+            {
+                AbcA::ObjectReaderPtr group = top->getChild( i );
+                for ( std::size_t j = 0; j < group->getNumChildren(); ++j )
+                {
+                    AbcA::CompoundPropertyReaderPtr props =
+                        group->getChild( j )->getProperties();
+                    AbcA::ArrayPropertyReaderPtr points =
+                        props->getArrayProperty( "P" );
+                    AbcA::ScalarPropertyReaderPtr id =
+                        props->getCompoundProperty( "arbGeomParams"
+                            )->getScalarProperty( "id" );
+                    TESTING_ASSERT( points && id );
+                    lookups += 5;
+                }
+                ++lookups;
+            }
+        }
+
+        *numLookups = lookups;
+    }
+};
+
+//-*****************************************************************************
+// How looking up readers which have already been made scales with the
+// number of threads doing it.
+void traversalBenchmark()
+{
+    std::string archiveName = "traversalBenchmark.abc";
+    writeTraversalArchive( archiveName );
+
+    AO::ReadArchive r;
+    AbcA::ArchiveReaderPtr archive = r( archiveName );
+
+    TraversalWorker worker;
+    worker.top = archive->getTop();
+
+    // hold onto everything, so the threads only ever find what is made
+    std::vector< AbcA::BasePropertyReaderPtr > held;
+    std::vector< AbcA::ObjectReaderPtr > heldObjects;
+    for ( std::size_t i = 0; i < NUM_TRAVERSAL_CHILDREN; ++i )
+    {
+        AbcA::ObjectReaderPtr group = worker.top->getChild( i );
+        heldObjects.push_back( group );
+        for ( std::size_t j = 0; j < NUM_TRAVERSAL_CHILDREN; ++j )
+        {
+            AbcA::ObjectReaderPtr leaf = group->getChild( j );
+            AbcA::CompoundPropertyReaderPtr props = leaf->getProperties();
+            AbcA::CompoundPropertyReaderPtr arb =
+                props->getCompoundProperty( "arbGeomParams" );
+            heldObjects.push_back( leaf );
+            held.push_back( props );
+            held.push_back( props->getArrayProperty( "P" ) );
+            held.push_back( arb );
+            held.push_back( arb->getScalarProperty( "id" ) );
+        }
+    }
+
+    std::size_t maxThreads = std::max( std::thread::hardware_concurrency(),
+                                       2u );
+
+    std::cout << "traversal of made readers" << std::endl;
+    double singleRate = 0.0;
+    for ( std::size_t numThreads = 1; numThreads <= maxThreads;
+          numThreads *= 2 )
+    {
+        std::vector< std::size_t > numLookups( numThreads, 0 );
+        std::vector< std::thread > threads;
+
+        std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+        for ( std::size_t i = 0; i < numThreads; ++i )
+        {
+            worker.numLookups = &numLookups[i];
+            threads.push_back( std::thread( worker ) );
+        }
+
+        std::size_t total = 0;
+        for ( std::size_t i = 0; i < numThreads; ++i )
+        {
+            threads[i].join();
+            total += numLookups[i];
+        }
+
+        double seconds = std::chrono::duration< double >(
+            std::chrono::steady_clock::now() - start ).count();
+
+        TESTING_ASSERT( total == numThreads * NUM_TRAVERSAL_PASSES *
+            NUM_TRAVERSAL_CHILDREN * ( NUM_TRAVERSAL_CHILDREN * 5 + 1 ) );
+
+        double rate = total / seconds / 1e6;
+        if ( numThreads == 1 )
+        {
+            singleRate = rate;
+        }
+
+        std::cout << "    " << numThreads << " threads: " << rate
+                  << " million lookups per second, " << rate / singleRate
+                  << "x one thread" << std::endl;
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    std::string archiveName = "readBenchmark.abc";
+    writeArchive( archiveName );
+
+    readArchive( archiveName, true );     // Use mmap
+    readArchive( archiveName, false );    // Use streams
+
+    convertBenchmark();
+
+    traversalBenchmark();
+
+    return 0;
+}
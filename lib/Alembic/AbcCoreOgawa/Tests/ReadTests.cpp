@@ -0,0 +1,223 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include "CountAllocations.h"
+#include "ReferenceConvert.h"
+
+#include <vector>
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace AbcA = Alembic::AbcCoreAbstract;
+
+//-*****************************************************************************
+static const std::size_t NUM_SAMPLES = 8;
+static const std::size_t NUM_REPEATS = 10;
+
+//-*****************************************************************************
+void writeArchive( const std::string & iArchiveName )
+{
+    AO::WriteArchive w;
+    AbcA::ArchiveWriterPtr a = w( iArchiveName, AbcA::MetaData() );
+    AbcA::CompoundPropertyWriterPtr props = a->getTop()->getProperties();
+
+    AbcA::ScalarPropertyWriterPtr visible = props->createScalarProperty(
+        "visible", AbcA::MetaData(),
+        AbcA::DataType( Alembic::Util::kInt8POD, 1 ), 0 );
+
+    AbcA::DataType floatType( Alembic::Util::kFloat32POD, 3 );
+    AbcA::ArrayPropertyWriterPtr points = props->createArrayProperty(
+        "P", AbcA::MetaData(), floatType, 0 );
+
+    std::vector< Alembic::Util::float32_t > pts( 300 );
+    for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+    {
+        Alembic::Util::int8_t vis = i % 2;
+        visible->setSample( &vis );
+
+        for ( std::size_t j = 0; j < pts.size(); ++j )
+        {
+            pts[j] = ( Alembic::Util::float32_t )( i + j );
+        }
+        points->setSample( AbcA::ArraySample( &pts.front(), floatType,
+            Alembic::Util::Dimensions( pts.size() / 3 ) ) );
+    }
+}
+
+//-*****************************************************************************
+// Reading samples which have been read before shouldn't allocate anything.
+void testNoAllocations( const std::string & iArchiveName, bool iUseMMap )
+{
+    // more than one stream, so that reads lease them from the manager
+    AO::ReadArchive r( 4, iUseMMap );
+    AbcA::ArchiveReaderPtr a = r( iArchiveName, AO::CreateCache( 1 << 20 ) );
+    AbcA::CompoundPropertyReaderPtr props = a->getTop()->getProperties();
+
+    AbcA::ScalarPropertyReaderPtr visible =
+        props->getScalarProperty( "visible" );
+    AbcA::ArrayPropertyReaderPtr points = props->getArrayProperty( "P" );
+    TESTING_ASSERT( visible && points );
+    TESTING_ASSERT( visible->getNumSamples() == NUM_SAMPLES );
+    TESTING_ASSERT( points->getNumSamples() == NUM_SAMPLES );
+
+    Alembic::Util::int8_t vis = 0;
+    AbcA::ArraySamplePtr samp;
+    AbcA::ArraySampleKey key;
+    Alembic::Util::Dimensions dims;
+    std::vector< Alembic::Util::float32_t > pts( 300 );
+
+    // the first time around the samples end up in the cache, and dims gets
+    // its rank
+    for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+    {
+        visible->getSample( i, &vis );
+        TESTING_ASSERT( vis == ( Alembic::Util::int8_t )( i % 2 ) );
+
+        points->getSample( i, samp );
+        TESTING_ASSERT( samp->getDimensions().numPoints() == 100 );
+        points->getDimensions( i, dims );
+        TESTING_ASSERT( dims.numPoints() == 100 );
+    }
+    samp.reset();
+
+    std::size_t numAllocations = GetNumAllocations();
+    for ( std::size_t j = 0; j < NUM_REPEATS; ++j )
+    {
+        for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+        {
+            visible->getSample( i, &vis );
+        }
+    }
+    TESTING_ASSERT( GetNumAllocations() == numAllocations );
+
+    for ( std::size_t j = 0; j < NUM_REPEATS; ++j )
+    {
+        for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+        {
+            points->getSample( i, samp );
+        }
+    }
+    samp.reset();
+    TESTING_ASSERT( GetNumAllocations() == numAllocations );
+
+    for ( std::size_t j = 0; j < NUM_REPEATS; ++j )
+    {
+        for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+        {
+            points->getKey( i, key );
+        }
+    }
+    TESTING_ASSERT( GetNumAllocations() == numAllocations );
+
+    for ( std::size_t j = 0; j < NUM_REPEATS; ++j )
+    {
+        for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+        {
+            points->getDimensions( i, dims );
+        }
+    }
+    TESTING_ASSERT( GetNumAllocations() == numAllocations );
+
+    for ( std::size_t j = 0; j < NUM_REPEATS; ++j )
+    {
+        for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+        {
+            points->getAs( i, &pts.front(), Alembic::Util::kFloat32POD );
+        }
+    }
+    TESTING_ASSERT( GetNumAllocations() == numAllocations );
+    TESTING_ASSERT( pts[0] ==
+                    ( Alembic::Util::float32_t )( NUM_SAMPLES - 1 ) );
+}
+
+//-*****************************************************************************
+// Reads every POD as every other POD with getAs, and checks the results
+// against the reference conversion.
+void testConversions()
+{
+    std::string archiveName = "readConversions.abc";
+    writeConvertArchive( archiveName );
+
+    AO::ReadArchive r;
+    AbcA::ArchiveReaderPtr a = r( archiveName );
+    AbcA::CompoundPropertyReaderPtr props = a->getTop()->getProperties();
+
+    std::vector< char > from( NUM_CONVERT * 8 );
+    std::vector< char > to( NUM_CONVERT * 8 );
+    std::vector< char > reference( NUM_CONVERT * 8 );
+    for ( std::size_t i = 0; i < NUM_CONVERT_PODS; ++i )
+    {
+        for ( std::size_t j = 0; j < NUM_CONVERT_PODS; ++j )
+        {
+            if ( i == j )
+            {
+                continue;
+            }
+
+            AbcA::ArrayPropertyReaderPtr prop =
+                props->getArrayProperty( convertName( i, j ) );
+            prop->getAs( 0, &to.front(), CONVERT_PODS[j] );
+
+            prop->getAs( 0, &from.front(), CONVERT_PODS[i] );
+            referenceFunc( CONVERT_PODS[i], CONVERT_PODS[j] )(
+                &from.front(), &reference.front(), NUM_CONVERT );
+
+            TESTING_ASSERT( sameValues( CONVERT_PODS[j], &to.front(),
+                                        &reference.front(), NUM_CONVERT ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    std::string archiveName = "readTests.abc";
+    writeArchive( archiveName );
+
+    testNoAllocations( archiveName, true );     // Use mmap
+    testNoAllocations( archiveName, false );    // Use streams
+
+    testConversions();
+
+    return 0;
+}
@@ -0,0 +1,416 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreOgawa_Tests_ReferenceConvert_h
+#define Alembic_AbcCoreOgawa_Tests_ReferenceConvert_h
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//-*****************************************************************************
+// How getAs converted one POD to another before it was vectorized, kept
+// here so that the results and the speed can be compared against it.
+template < typename TOPOD >
+void referenceMinAndMax( TOPOD & oMin, TOPOD & oMax )
+{
+    oMin = std::numeric_limits< TOPOD >::min();
+    oMax = std::numeric_limits< TOPOD >::max();
+}
+
+template <>
+inline void referenceMinAndMax< Alembic::Util::float16_t >(
+    Alembic::Util::float16_t & oMin, Alembic::Util::float16_t & oMax )
+{
+    oMax = HALF_MAX;
+    oMin = -oMax;
+}
+
+template <>
+inline void referenceMinAndMax< Alembic::Util::float32_t >(
+    Alembic::Util::float32_t & oMin, Alembic::Util::float32_t & oMax )
+{
+    oMax = std::numeric_limits< Alembic::Util::float32_t >::max();
+    oMin = -oMax;
+}
+
+template <>
+inline void referenceMinAndMax< Alembic::Util::float64_t >(
+    Alembic::Util::float64_t & oMin, Alembic::Util::float64_t & oMax )
+{
+    oMax = std::numeric_limits< Alembic::Util::float64_t >::max();
+    oMin = -oMax;
+}
+
+template < typename FROMPOD, typename TOPOD >
+void referenceConvert( const void * iFrom, void * oTo, std::size_t iNum )
+{
+    const FROMPOD * from = ( const FROMPOD * ) iFrom;
+    TOPOD * to = ( TOPOD * ) oTo;
+
+    TOPOD toPodMin = 0;
+    TOPOD toPodMax = 0;
+    referenceMinAndMax< TOPOD >( toPodMin, toPodMax );
+
+    FROMPOD podMin = 0;
+    FROMPOD podMax = 0;
+    if ( sizeof( FROMPOD ) > sizeof( TOPOD ) )
+    {
+        podMin = static_cast< FROMPOD >( toPodMin );
+        podMax = static_cast< FROMPOD >( toPodMax );
+        if ( podMin > podMax )
+        {
+            podMin = 0;
+        }
+    }
+    else
+    {
+        referenceMinAndMax< FROMPOD >( podMin, podMax );
+        if ( podMin != 0 && toPodMin == 0 )
+        {
+            podMin = 0;
+        }
+        else if ( podMin == 0 && toPodMin != 0 &&
+                  sizeof( FROMPOD ) == sizeof( TOPOD ) )
+        {
+            podMax = static_cast< FROMPOD >( toPodMax );
+        }
+    }
+
+    for ( std::size_t i = 0; i < iNum; ++i )
+    {
+        FROMPOD f = from[i];
+        if ( f < podMin )
+        {
+            f = podMin;
+        }
+        else if ( f > podMax )
+        {
+            f = podMax;
+        }
+        to[i] = static_cast< TOPOD >( f );
+    }
+}
+
+template < typename FROMPOD >
+void referenceToBool( const void * iFrom, void * oTo, std::size_t iNum )
+{
+    const FROMPOD * from = ( const FROMPOD * ) iFrom;
+    Alembic::Util::bool_t * to = ( Alembic::Util::bool_t * ) oTo;
+    for ( std::size_t i = 0; i < iNum; ++i )
+    {
+        to[i] = ( from[i] != 0 );
+    }
+}
+
+template < typename TOPOD >
+void referenceFromBool( const void * iFrom, void * oTo, std::size_t iNum )
+{
+    const char * from = ( const char * ) iFrom;
+    TOPOD * to = ( TOPOD * ) oTo;
+    for ( std::size_t i = 0; i < iNum; ++i )
+    {
+        to[i] = static_cast< TOPOD >( from[i] != 0 );
+    }
+}
+
+//-*****************************************************************************
+typedef void ( *ConvertFunc )( const void *, void *, std::size_t );
+
+template < typename FROMPOD >
+ConvertFunc referenceFunc( Alembic::Util::PlainOldDataType iTo )
+{
+    switch ( iTo )
+    {
+        case Alembic::Util::kBooleanPOD:
+            return referenceToBool< FROMPOD >;
+        case Alembic::Util::kUint8POD:
+            return referenceConvert< FROMPOD, Alembic::Util::uint8_t >;
+        case Alembic::Util::kInt8POD:
+            return referenceConvert< FROMPOD, Alembic::Util::int8_t >;
+        case Alembic::Util::kUint16POD:
+            return referenceConvert< FROMPOD, Alembic::Util::uint16_t >;
+        case Alembic::Util::kInt16POD:
+            return referenceConvert< FROMPOD, Alembic::Util::int16_t >;
+        case Alembic::Util::kUint32POD:
+            return referenceConvert< FROMPOD, Alembic::Util::uint32_t >;
+        case Alembic::Util::kInt32POD:
+            return referenceConvert< FROMPOD, Alembic::Util::int32_t >;
+        case Alembic::Util::kUint64POD:
+            return referenceConvert< FROMPOD, Alembic::Util::uint64_t >;
+        case Alembic::Util::kInt64POD:
+            return referenceConvert< FROMPOD, Alembic::Util::int64_t >;
+        case Alembic::Util::kFloat16POD:
+            return referenceConvert< FROMPOD, Alembic::Util::float16_t >;
+        case Alembic::Util::kFloat32POD:
+            return referenceConvert< FROMPOD, Alembic::Util::float32_t >;
+        case Alembic::Util::kFloat64POD:
+            return referenceConvert< FROMPOD, Alembic::Util::float64_t >;
+        default:
+            return NULL;
+    }
+}
+
+inline ConvertFunc referenceFunc( Alembic::Util::PlainOldDataType iFrom,
+                           Alembic::Util::PlainOldDataType iTo )
+{
+    switch ( iFrom )
+    {
+        case Alembic::Util::kBooleanPOD:
+        {
+            switch ( iTo )
+            {
+                case Alembic::Util::kUint8POD:
+                    return referenceFromBool< Alembic::Util::uint8_t >;
+                case Alembic::Util::kInt8POD:
+                    return referenceFromBool< Alembic::Util::int8_t >;
+                case Alembic::Util::kUint16POD:
+                    return referenceFromBool< Alembic::Util::uint16_t >;
+                case Alembic::Util::kInt16POD:
+                    return referenceFromBool< Alembic::Util::int16_t >;
+                case Alembic::Util::kUint32POD:
+                    return referenceFromBool< Alembic::Util::uint32_t >;
+                case Alembic::Util::kInt32POD:
+                    return referenceFromBool< Alembic::Util::int32_t >;
+                case Alembic::Util::kUint64POD:
+                    return referenceFromBool< Alembic::Util::uint64_t >;
+                case Alembic::Util::kInt64POD:
+                    return referenceFromBool< Alembic::Util::int64_t >;
+                case Alembic::Util::kFloat16POD:
+                    return referenceFromBool< Alembic::Util::float16_t >;
+                case Alembic::Util::kFloat32POD:
+                    return referenceFromBool< Alembic::Util::float32_t >;
+                case Alembic::Util::kFloat64POD:
+                    return referenceFromBool< Alembic::Util::float64_t >;
+                default:
+                    return NULL;
+            }
+        }
+        case Alembic::Util::kUint8POD:
+            return referenceFunc< Alembic::Util::uint8_t >( iTo );
+        case Alembic::Util::kInt8POD:
+            return referenceFunc< Alembic::Util::int8_t >( iTo );
+        case Alembic::Util::kUint16POD:
+            return referenceFunc< Alembic::Util::uint16_t >( iTo );
+        case Alembic::Util::kInt16POD:
+            return referenceFunc< Alembic::Util::int16_t >( iTo );
+        case Alembic::Util::kUint32POD:
+            return referenceFunc< Alembic::Util::uint32_t >( iTo );
+        case Alembic::Util::kInt32POD:
+            return referenceFunc< Alembic::Util::int32_t >( iTo );
+        case Alembic::Util::kUint64POD:
+            return referenceFunc< Alembic::Util::uint64_t >( iTo );
+        case Alembic::Util::kInt64POD:
+            return referenceFunc< Alembic::Util::int64_t >( iTo );
+        case Alembic::Util::kFloat16POD:
+            return referenceFunc< Alembic::Util::float16_t >( iTo );
+        case Alembic::Util::kFloat32POD:
+            return referenceFunc< Alembic::Util::float32_t >( iTo );
+        case Alembic::Util::kFloat64POD:
+            return referenceFunc< Alembic::Util::float64_t >( iTo );
+        default:
+            return NULL;
+    }
+}
+
+//-*****************************************************************************
+static const std::size_t NUM_CONVERT = 1 << 16;
+
+inline bool isFloatPod( Alembic::Util::PlainOldDataType iPod )
+{
+    return iPod == Alembic::Util::kFloat16POD ||
+           iPod == Alembic::Util::kFloat32POD ||
+           iPod == Alembic::Util::kFloat64POD;
+}
+
+// The values to convert.  Floating point values which are too big for an
+// integer end up as one which is out of range, which is undefined, so those
+// only get small values.
+inline std::vector< Alembic::Util::float64_t >
+convertValues( Alembic::Util::PlainOldDataType iFrom,
+               Alembic::Util::PlainOldDataType iTo )
+{
+    const Alembic::Util::float64_t small[] = { 0.0, 1.0, -1.0, 1.5, -2.5,
+        0.25, 7.0, -99.75, 100.0, 1e-5, 6e-8, 1e-9, -3.0, 42.0 };
+
+    const Alembic::Util::float64_t big[] = { 127.0, 128.0, 255.0, 256.0,
+        -128.0, -129.0, 32767.0, 32768.0, -32768.0, -32769.0, 65504.0,
+        65519.0, 65520.0, 70000.0, -70000.0, 2147483647.0, 2147483648.0,
+        -2147483648.0, 4294967295.0, 4294967296.0, 1e10, -1e10 };
+
+    const Alembic::Util::float64_t special[] = {
+        std::numeric_limits< Alembic::Util::float64_t >::infinity(),
+        -std::numeric_limits< Alembic::Util::float64_t >::infinity(),
+        std::numeric_limits< Alembic::Util::float64_t >::quiet_NaN(),
+        1e300, -1e300, 3.5e38, -3.5e38 };
+
+    std::vector< Alembic::Util::float64_t > values( small,
+        small + sizeof( small ) / sizeof( small[0] ) );
+
+    if ( !isFloatPod( iFrom ) || isFloatPod( iTo ) )
+    {
+        values.insert( values.end(), big,
+                       big + sizeof( big ) / sizeof( big[0] ) );
+    }
+
+    if ( isFloatPod( iFrom ) && isFloatPod( iTo ) )
+    {
+        values.insert( values.end(), special,
+                       special + sizeof( special ) / sizeof( special[0] ) );
+    }
+
+    // and then lots of them so that we can time it
+    std::vector< Alembic::Util::float64_t > ret( NUM_CONVERT );
+    for ( std::size_t i = 0; i < ret.size(); ++i )
+    {
+        ret[i] = values[ i % values.size() ];
+        if ( i >= values.size() )
+        {
+            ret[i] *= 1.0 + ( Alembic::Util::float64_t )( i % 97 ) / 64.0;
+        }
+    }
+    return ret;
+}
+
+//-*****************************************************************************
+// whether the iNum values of iPod are the same, NaNs being equal
+inline bool sameValues( Alembic::Util::PlainOldDataType iPod, const char * iA,
+                 const char * iB, std::size_t iNum )
+{
+    if ( !isFloatPod( iPod ) )
+    {
+        return memcmp( iA, iB, iNum * Alembic::Util::PODNumBytes( iPod ) ) == 0;
+    }
+
+    for ( std::size_t i = 0; i < iNum; ++i )
+    {
+        Alembic::Util::float64_t a = 0.0;
+        Alembic::Util::float64_t b = 0.0;
+        if ( iPod == Alembic::Util::kFloat16POD )
+        {
+            a = ( ( const Alembic::Util::float16_t * ) iA )[i];
+            b = ( ( const Alembic::Util::float16_t * ) iB )[i];
+        }
+        else if ( iPod == Alembic::Util::kFloat32POD )
+        {
+            a = ( ( const Alembic::Util::float32_t * ) iA )[i];
+            b = ( ( const Alembic::Util::float32_t * ) iB )[i];
+        }
+        else
+        {
+            a = ( ( const Alembic::Util::float64_t * ) iA )[i];
+            b = ( ( const Alembic::Util::float64_t * ) iB )[i];
+        }
+
+        if ( a != b && !( a != a && b != b ) )
+        {
+            std::cout << "    mismatch at " << i << ": " << a << " vs " << b
+                      << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+//-*****************************************************************************
+// Every POD that getAs converts between
+static const Alembic::Util::PlainOldDataType CONVERT_PODS[] = {
+    Alembic::Util::kBooleanPOD, Alembic::Util::kUint8POD,
+    Alembic::Util::kInt8POD, Alembic::Util::kUint16POD,
+    Alembic::Util::kInt16POD, Alembic::Util::kUint32POD,
+    Alembic::Util::kInt32POD, Alembic::Util::kUint64POD,
+    Alembic::Util::kInt64POD, Alembic::Util::kFloat16POD,
+    Alembic::Util::kFloat32POD, Alembic::Util::kFloat64POD };
+static const std::size_t NUM_CONVERT_PODS =
+    sizeof( CONVERT_PODS ) / sizeof( CONVERT_PODS[0] );
+
+// the name of the property holding the values to convert from POD i to j
+inline std::string convertName( std::size_t i, std::size_t j )
+{
+    std::stringstream strm;
+    strm << i << "_" << j;
+    return strm.str();
+}
+
+//-*****************************************************************************
+// Writes a property for each pair of PODs, with the values to convert from
+// the first to the second stored as the first.
+inline void writeConvertArchive( const std::string & iArchiveName )
+{
+    Alembic::AbcCoreOgawa::WriteArchive w;
+    Alembic::AbcCoreAbstract::ArchiveWriterPtr a =
+        w( iArchiveName, Alembic::AbcCoreAbstract::MetaData() );
+    Alembic::AbcCoreAbstract::CompoundPropertyWriterPtr props =
+        a->getTop()->getProperties();
+
+    for ( std::size_t i = 0; i < NUM_CONVERT_PODS; ++i )
+    {
+        for ( std::size_t j = 0; j < NUM_CONVERT_PODS; ++j )
+        {
+            std::vector< Alembic::Util::float64_t > values =
+                convertValues( CONVERT_PODS[i], CONVERT_PODS[j] );
+            std::vector< char > data(
+                NUM_CONVERT * Alembic::Util::PODNumBytes( CONVERT_PODS[i] ) );
+
+            if ( CONVERT_PODS[i] == Alembic::Util::kBooleanPOD )
+            {
+                referenceToBool< Alembic::Util::float64_t >(
+                    &values.front(), &data.front(), NUM_CONVERT );
+            }
+            else
+            {
+                referenceFunc( Alembic::Util::kFloat64POD, CONVERT_PODS[i] )(
+                    &values.front(), &data.front(), NUM_CONVERT );
+            }
+
+            Alembic::AbcCoreAbstract::DataType dataType( CONVERT_PODS[i], 1 );
+            props->createArrayProperty( convertName( i, j ),
+                Alembic::AbcCoreAbstract::MetaData(), dataType, 0
+                )->setSample( Alembic::AbcCoreAbstract::ArraySample(
+                    &data.front(), dataType,
+                    Alembic::Util::Dimensions( NUM_CONVERT ) ) );
+        }
+    }
+}
+
+#endif
@@ -40,6 +40,7 @@
 
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <future>
 #include <iostream>
 #include <vector>
 
@@ -624,6 +625,23 @@ void testRepeatedScalarData(bool iUseMMap)
 
                     sp->getSample( 2, &f );
                     TESTING_ASSERT(f == 42.0);
+
+                    // and without waiting for each one
+                    std::vector< Alembic::Util::float32_t > fs( 6, 0 );
+                    std::vector< std::future< void > > futures;
+                    for ( size_t j = 0; j < fs.size(); ++j )
+                    {
+                        futures.push_back( sp->getSampleAsync( j, &fs[j] ) );
+                    }
+
+                    std::future< void > bad = sp->getSampleAsync( 100, &f );
+                    TESTING_ASSERT_THROW(bad.get(), Alembic::Util::Exception);
+
+                    for ( size_t j = 0; j < fs.size(); ++j )
+                    {
+                        futures[j].get();
+                        TESTING_ASSERT(fs[j] == ( j < 3 ? 42.0 : -3.0 ));
+                    }
                 }
                 break;
 
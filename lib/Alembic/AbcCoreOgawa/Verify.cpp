@@ -0,0 +1,313 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/Verify.h>
+#include <Alembic/AbcCoreOgawa/ReadWrite.h>
+#include <Alembic/AbcCoreOgawa/AprImpl.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
+#include <Alembic/AbcCoreOgawa/SprImpl.h>
+#include <Alembic/AbcCoreOgawa/StreamManager.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+// how many stored samples each task checks, so that big properties get
+// spread over the threads too
+const std::size_t VERIFY_CHUNK = 64;
+
+//-*****************************************************************************
+// some of the stored samples of a property, for one of the threads to check
+struct VerifyTask
+{
+    Ogawa::IGroupPtr group;
+    PropertyHeaderPtr header;
+    std::size_t numPerSample;
+    std::size_t firstStored;
+    std::size_t numStored;
+    std::string objectName;
+    std::string propertyName;
+};
+
+//-*****************************************************************************
+void addPropertyTasks( Ogawa::IGroupPtr iGroup,
+                       PropertyHeaderPtr iHeader,
+                       std::size_t iNumPerSample,
+                       const std::string & iObjectName,
+                       const std::string & iPropertyName,
+                       std::vector< VerifyTask > & ioTasks )
+{
+    if ( iHeader->nextSampleIndex == 0 )
+    {
+        return;
+    }
+
+    std::size_t numStored =
+        iHeader->verifyIndex( iHeader->nextSampleIndex - 1 ) + 1;
+
+    VerifyTask task;
+    task.group = iGroup;
+    task.header = iHeader;
+    task.numPerSample = iNumPerSample;
+    task.objectName = iObjectName;
+    task.propertyName = iPropertyName;
+
+    for ( std::size_t i = 0; i < numStored; i += VERIFY_CHUNK )
+    {
+        task.firstStored = i;
+        task.numStored = std::min( numStored - i, VERIFY_CHUNK );
+        ioTasks.push_back( task );
+    }
+}
+
+//-*****************************************************************************
+void addCompoundTasks( AbcA::CompoundPropertyReaderPtr iParent,
+                       const std::string & iObjectName,
+                       const std::string & iPrefix,
+                       std::vector< VerifyTask > & ioTasks )
+{
+    for ( std::size_t i = 0; i < iParent->getNumProperties(); ++i )
+    {
+        const AbcA::PropertyHeader & header = iParent->getPropertyHeader( i );
+        std::string name = iPrefix + header.getName();
+
+        if ( header.isCompound() )
+        {
+            addCompoundTasks( iParent->getCompoundProperty( header.getName() ),
+                              iObjectName, name + "/", ioTasks );
+        }
+        else if ( header.isScalar() )
+        {
+            AbcA::ScalarPropertyReaderPtr prop =
+                iParent->getScalarProperty( header.getName() );
+            SprImpl * impl = dynamic_cast< SprImpl * >( prop.get() );
+            ABCA_ASSERT( impl, "Not an Ogawa scalar property: " << name );
+            addPropertyTasks( impl->getGroup(), impl->getHeaderPtr(), 1,
+                              iObjectName, name, ioTasks );
+        }
+        else
+        {
+            AbcA::ArrayPropertyReaderPtr prop =
+                iParent->getArrayProperty( header.getName() );
+            AprImpl * impl = dynamic_cast< AprImpl * >( prop.get() );
+            ABCA_ASSERT( impl, "Not an Ogawa array property: " << name );
+
+            // the dimensions are written after each sample
+            addPropertyTasks( impl->getGroup(), impl->getHeaderPtr(), 2,
+                              iObjectName, name, ioTasks );
+        }
+    }
+}
+
+//-*****************************************************************************
+void addObjectTasks( AbcA::ObjectReaderPtr iObject,
+                     std::vector< VerifyTask > & ioTasks )
+{
+    addCompoundTasks( iObject->getProperties(), iObject->getFullName(), "",
+                      ioTasks );
+
+    for ( std::size_t i = 0; i < iObject->getNumChildren(); ++i )
+    {
+        addObjectTasks( iObject->getChild( i ), ioTasks );
+    }
+}
+
+//-*****************************************************************************
+// Checks tasks until there aren't any left, each thread runs one.
+struct VerifyWorker
+{
+    ArImpl * archive;
+    const std::vector< VerifyTask > * tasks;
+    std::atomic< std::size_t > * nextTask;
+    std::atomic< Util::uint64_t > * numBytes;
+    std::vector< VerifyMismatch > * mismatches;
+    Alembic::Util::mutex * mismatchLock;
+
+    // the first thing thrown by any of the threads, which VerifyArchive
+    // throws again once all of them are done
+    std::exception_ptr * error;
+
+    void operator()() const
+    {
+        // nothing can be allowed out of a thread
+        try
+        {
+            run();
+        }
+        catch ( ... )
+        {
+            Alembic::Util::scoped_lock l( *mismatchLock );
+            if ( !*error )
+            {
+                *error = std::current_exception();
+            }
+        }
+    }
+
+    void run() const
+    {
+        StreamLease stream( archive->getStreamManager() );
+
+        std::vector< std::size_t > badStored;
+        Util::uint64_t bytes = 0;
+        for ( std::size_t i = ( *nextTask )++; i < tasks->size();
+              i = ( *nextTask )++ )
+        {
+            const VerifyTask & task = ( *tasks )[i];
+
+            badStored.clear();
+            VerifySamples( task.group, task.numPerSample, task.firstStored,
+                           task.numStored,
+                           task.header->header.getDataType().getPod(),
+                           stream.getID(), badStored, bytes );
+
+            if ( badStored.empty() )
+            {
+                continue;
+            }
+
+            Alembic::Util::scoped_lock l( *mismatchLock );
+            for ( std::size_t j = 0; j < badStored.size(); ++j )
+            {
+                // the first stored sample also stands in for those before
+                // firstChangedIndex, the rest start at it
+                VerifyMismatch mismatch;
+                mismatch.objectName = task.objectName;
+                mismatch.propertyName = task.propertyName;
+                mismatch.sampleIndex = ( badStored[j] == 0 ) ? 0 :
+                    task.header->firstChangedIndex + badStored[j] - 1;
+                mismatches->push_back( mismatch );
+            }
+        }
+
+        *numBytes += bytes;
+    }
+};
+
+//-*****************************************************************************
+bool mismatchLess( const VerifyMismatch & iLhs, const VerifyMismatch & iRhs )
+{
+    if ( iLhs.objectName != iRhs.objectName )
+    {
+        return iLhs.objectName < iRhs.objectName;
+    }
+
+    if ( iLhs.propertyName != iRhs.propertyName )
+    {
+        return iLhs.propertyName < iRhs.propertyName;
+    }
+
+    return iLhs.sampleIndex < iRhs.sampleIndex;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+Util::uint64_t
+VerifyArchive( const std::string & iFileName,
+               std::vector< VerifyMismatch > & oMismatches,
+               std::size_t iNumThreads )
+{
+    oMismatches.clear();
+
+    std::size_t numThreads = iNumThreads;
+    if ( numThreads == 0 )
+    {
+        numThreads = std::max( std::thread::hardware_concurrency(), 1u );
+    }
+
+    // a stream for each thread, and no cache since every sample gets read
+    // only once anyway
+    ReadArchive reader( numThreads, true );
+    AbcA::ArchiveReaderPtr archive =
+        reader( iFileName, AbcA::ReadArraySampleCachePtr() );
+
+    ArImpl * impl = dynamic_cast< ArImpl * >( archive.get() );
+    ABCA_ASSERT( impl, "Not an Ogawa archive: " << iFileName );
+
+    std::vector< VerifyTask > tasks;
+    addObjectTasks( archive->getTop(), tasks );
+
+    std::atomic< std::size_t > nextTask( 0 );
+    std::atomic< Util::uint64_t > numBytes( 0 );
+    Alembic::Util::mutex mismatchLock;
+    std::exception_ptr error;
+
+    VerifyWorker worker;
+    worker.archive = impl;
+    worker.tasks = &tasks;
+    worker.nextTask = &nextTask;
+    worker.numBytes = &numBytes;
+    worker.mismatches = &oMismatches;
+    worker.mismatchLock = &mismatchLock;
+    worker.error = &error;
+
+    numThreads = std::min( numThreads, tasks.size() );
+    std::vector< std::thread > threads;
+    for ( std::size_t i = 1; i < numThreads; ++i )
+    {
+        threads.push_back( std::thread( worker ) );
+    }
+
+    // this thread does its share too
+    worker();
+
+    for ( std::size_t i = 0; i < threads.size(); ++i )
+    {
+        threads[i].join();
+    }
+
+    if ( error )
+    {
+        std::rethrow_exception( error );
+    }
+
+    std::sort( oMismatches.begin(), oMismatches.end(), mismatchLess );
+    return numBytes;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
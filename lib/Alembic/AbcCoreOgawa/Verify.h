@@ -0,0 +1,85 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreOgawa_Verify_h
+#define Alembic_AbcCoreOgawa_Verify_h
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/Util/Export.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! A property sample whose data doesn't match the digest stored with it.
+struct VerifyMismatch
+{
+    //! the full name of the object the property is on
+    std::string objectName;
+
+    //! the name of the property, along with the compound properties it is
+    //! in, separated by '/'
+    std::string propertyName;
+
+    //! the first sample which uses the data
+    ::Alembic::AbcCoreAbstract::index_t sampleIndex;
+};
+
+//-*****************************************************************************
+//! Reads the data of every property sample in the Ogawa archive iFileName,
+//! and checks it against the digest which was written along with it, to find
+//! data which has been corrupted.  The samples are spread over iNumThreads
+//! threads, or one per core when it is 0.
+//!
+//! The samples which don't match, or which can't be read at all, are put in
+//! oMismatches sorted by object, property and sample.  Samples which repeat
+//! the one before them aren't stored again, so only the first of them is
+//! reported.  Returns how many bytes of sample data were checked.  Throws if
+//! the archive can't be opened.
+ALEMBIC_EXPORT Util::uint64_t
+VerifyArchive( const std::string & iFileName,
+               std::vector< VerifyMismatch > & oMismatches,
+               std::size_t iNumThreads = 0 );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
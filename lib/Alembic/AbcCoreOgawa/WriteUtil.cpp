@@ -36,6 +36,10 @@
 
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
+#include <Alembic/AbcCoreOgawa/Compression.h>
+
+#include <algorithm>
+#include <cstring>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -156,6 +160,39 @@ GetWrittenSampleMap( AbcA::ArchiveWriterPtr iVal )
     return ptr->getWrittenSampleMap();
 }
 
+//-*****************************************************************************
+void CheckpointIfDue( AbcA::ArchiveWriterPtr iArchive )
+{
+    AwImpl *ptr = dynamic_cast<AwImpl*>( iArchive.get() );
+    ABCA_ASSERT( ptr, "NULL Impl Ptr" );
+    ptr->checkpointIfDue();
+}
+
+//-*****************************************************************************
+ChangeLock::ChangeLock( AbcA::ArchiveWriterPtr iArchive )
+    : m_archive( iArchive )
+{
+    AwImpl *ptr = dynamic_cast<AwImpl*>( m_archive.get() );
+    ABCA_ASSERT( ptr, "NULL Impl Ptr" );
+    ptr->beginChange();
+}
+
+//-*****************************************************************************
+ChangeLock::~ChangeLock()
+{
+    unlock();
+}
+
+//-*****************************************************************************
+void ChangeLock::unlock()
+{
+    if ( m_archive )
+    {
+        static_cast<AwImpl*>( m_archive.get() )->endChange();
+        m_archive.reset();
+    }
+}
+
 //-*****************************************************************************
 void WriteDimensions( Ogawa::OGroupPtr iGroup,
                       const AbcA::Dimensions & iDims,
@@ -178,12 +215,57 @@ void WriteDimensions( Ogawa::OGroupPtr iGroup,
                      ( const void * )iDims.rootPtr() );
 }
 
+//-*****************************************************************************
+// writes iKey followed by the iDataSize bytes of iData, which haven't been
+// written before
+static WrittenSampleIDPtr
+WriteNewData( WrittenSampleMap &iMap,
+              Ogawa::OGroupPtr iGroup,
+              const void * iData,
+              Util::uint64_t iDataSize,
+              std::size_t iElementSize,
+              std::size_t iNumPoints,
+              const AbcA::ArraySample::Key &iKey,
+              Util::int8_t iCompressionHint )
+{
+    Ogawa::ODataPtr dataPtr;
+
+    std::vector< char > compressed;
+    if ( iCompressionHint >= 0 && iDataSize != 0 &&
+         CompressData( iData, iDataSize, iElementSize, iCompressionHint,
+                       compressed ) )
+    {
+        // the key stays as is so we can still get at it without
+        // decompressing, followed by how big the data is uncompressed
+        const void * datas[3] = { &iKey.digest, &iDataSize,
+                                  &compressed.front() };
+        Alembic::Util::uint64_t sizes[3] = { 16, 8, compressed.size() };
+
+        dataPtr = iGroup->addData( 3, sizes, datas, true );
+    }
+    else
+    {
+        const void * datas[2] = { &iKey.digest, iData };
+        Alembic::Util::uint64_t sizes[2] = { 16, iDataSize };
+
+        dataPtr = iGroup->addData( 2, sizes, datas );
+    }
+
+    WrittenSampleIDPtr writeID( new WrittenSampleID( iKey, dataPtr->getPos(),
+                                                     iNumPoints ) );
+    iMap.store( writeID );
+
+    // Return the reference.
+    return writeID;
+}
+
 //-*****************************************************************************
 WrittenSampleIDPtr
 WriteData( WrittenSampleMap &iMap,
            Ogawa::OGroupPtr iGroup,
            const AbcA::ArraySample &iSamp,
-           const AbcA::ArraySample::Key &iKey )
+           const AbcA::ArraySample::Key &iKey,
+           Util::int8_t iCompressionHint )
 {
 
     // Okay, need to actually store it.
@@ -199,40 +281,48 @@ WriteData( WrittenSampleMap &iMap,
         return writeID;
     }
 
-    Ogawa::ODataPtr dataPtr;
-
     const AbcA::DataType &dataType = iSamp.getDataType();
 
+    // what gets written after the key
+    const void * data = NULL;
+    Util::uint64_t dataSize = 0;
+    std::size_t elementSize = 1;
+
+    std::vector <Util::int8_t> v;
+    std::vector <Util::int32_t> wv;
+
     if ( dataType.getPod() == Alembic::Util::kStringPOD )
     {
         size_t numPods = dataType.getExtent() * dims.numPoints();
-        std::vector <Util::int8_t> v;
+        const std::string * strs =
+            static_cast<const std::string*>( iSamp.getData() );
+
+        size_t numChars = numPods;
         for ( size_t j = 0; j < numPods; ++j )
         {
-            const std::string &str =
-                static_cast<const std::string*>( iSamp.getData() )[j];
+            numChars += strs[j].length();
+        }
+        v.reserve( numChars );
+
+        for ( size_t j = 0; j < numPods; ++j )
+        {
+            const std::string &str = strs[j];
 
             ABCA_ASSERT( str.find( '\0' ) == std::string::npos,
                      "Illegal NULL character found in string data " );
 
-            size_t strLen = str.length();
-            for ( size_t k = 0; k < strLen; ++k )
-            {
-                v.push_back(str[k]);
-            }
+            v.insert( v.end(), str.begin(), str.end() );
 
             // append a 0 for the NULL seperator character
             v.push_back(0);
         }
 
-        const void * datas[2] = { &iKey.digest, &v.front() };
-        Alembic::Util::uint64_t sizes[2] = { 16, v.size() };
-        dataPtr =  iGroup->addData( 2, sizes, datas );
+        data = v.empty() ? NULL : &v.front();
+        dataSize = v.size();
     }
     else if ( dataType.getPod() == Alembic::Util::kWstringPOD )
     {
         size_t numPods = dataType.getExtent() * dims.numPoints();
-        std::vector <Util::int32_t> v;
         for ( size_t j = 0; j < numPods; ++j )
         {
             const std::wstring &str =
@@ -245,34 +335,92 @@ WriteData( WrittenSampleMap &iMap,
             size_t strLen = str.length();
             for ( size_t k = 0; k < strLen; ++k )
             {
-                v.push_back(str[k]);
+                wv.push_back(str[k]);
             }
 
             // append a 0 for the NULL seperator character
-            v.push_back(0);
+            wv.push_back(0);
         }
 
-        const void * datas[2] = { &iKey.digest, &v.front() };
-        Alembic::Util::uint64_t sizes[2] = { 16,
-            v.size() * sizeof(Util::int32_t) };
-        dataPtr =  iGroup->addData( 2, sizes, datas );
+        data = wv.empty() ? NULL : &wv.front();
+        dataSize = wv.size() * sizeof(Util::int32_t);
+        elementSize = sizeof(Util::int32_t);
     }
     else
     {
-        const void * datas[2] = { &iKey.digest, iSamp.getData() };
-        Alembic::Util::uint64_t sizes[2] = { 16, iKey.numBytes };
+        data = iSamp.getData();
+        dataSize = iKey.numBytes;
+        elementSize = PODNumBytes( dataType.getPod() );
+    }
 
-        dataPtr = iGroup->addData( 2, sizes, datas );
+    return WriteNewData( iMap, iGroup, data, dataSize, elementSize,
+                         dataType.getExtent() * dims.numPoints(), iKey,
+                         iCompressionHint );
+}
+
+//-*****************************************************************************
+WrittenSampleIDPtr
+WriteData( WrittenSampleMap &iMap,
+           Ogawa::OGroupPtr iGroup,
+           const Util::StringArena &iStrings,
+           const AbcA::ArraySample::Key &iKey,
+           Util::int8_t iCompressionHint )
+{
+    WrittenSampleIDPtr writeID = iMap.find( iKey );
+    if ( writeID )
+    {
+        CopyWrittenData( iGroup, writeID );
+        return writeID;
     }
 
-    writeID.reset( new WrittenSampleID( iKey, dataPtr,
-                        dataType.getExtent() * dims.numPoints() ) );
-    iMap.store( writeID );
+    // the arena is already laid out the way strings are written
+    return WriteNewData( iMap, iGroup, iStrings.chars(), iStrings.numChars(),
+                         1, iStrings.size(), iKey, iCompressionHint );
+}
 
-    // Return the reference.
+//-*****************************************************************************
+WrittenSampleIDPtr
+WriteStoredData( WrittenSampleMap &iMap,
+                 Ogawa::OGroupPtr iGroup,
+                 const std::vector< char > & iData,
+                 bool iCompressed,
+                 std::size_t iNumPoints,
+                 const AbcA::ArraySample::Key &iKey )
+{
+    // empty data is at 0, like the empty samples AwImpl starts out with
+    Util::uint64_t pos = 0;
+    if ( iData.empty() )
+    {
+        iGroup->addEmptyData();
+    }
+    else
+    {
+        const void * datas[1] = { &iData.front() };
+        Alembic::Util::uint64_t sizes[1] = { iData.size() };
+        pos = iGroup->addData( 1, sizes, datas, iCompressed )->getPos();
+    }
+
+    WrittenSampleIDPtr writeID( new WrittenSampleID( iKey, pos,
+                                                     iNumPoints ) );
+    iMap.store( writeID );
     return writeID;
 }
 
+//-*****************************************************************************
+AbcA::ArraySample::Key
+GetStringsKey( const Util::StringArena &iStrings )
+{
+    // the same key ArraySample::getKey makes for the same strings
+    AbcA::ArraySample::Key key;
+    key.numBytes = iStrings.size() *
+        Util::PODNumBytes( Alembic::Util::kStringPOD );
+    key.origPOD = Alembic::Util::kStringPOD;
+    key.readPOD = Alembic::Util::kStringPOD;
+    Util::MurmurHash3_x64_128( iStrings.chars(), iStrings.numChars(),
+                               sizeof( Util::int8_t ), key.digest.words );
+    return key;
+}
+
 //-*****************************************************************************
 void CopyWrittenData( Ogawa::OGroupPtr iGroup,
                       WrittenSampleIDPtr iRef )
@@ -283,7 +431,7 @@ void CopyWrittenData( Ogawa::OGroupPtr iGroup,
     ABCA_ASSERT( iGroup,
                 "CopyWrittenData() passed in a bogus OGroupPtr" );
 
-    iGroup->addData(iRef->getObjectLocation());
+    iGroup->addDataAt( iRef->getObjectLocation() );
 }
 
 //-*****************************************************************************
@@ -481,16 +629,16 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
 }
 
 //-*****************************************************************************
-void WriteObjectHeader( std::vector< Util::uint8_t > & ioData,
-                    const AbcA::ObjectHeader &iHeader,
-                    MetaDataMapPtr iMap )
+static void writeNameAndMetaData( std::vector< Util::uint8_t > & ioData,
+                                  const std::string & iName,
+                                  const AbcA::MetaData & iMetaData,
+                                  MetaDataMapPtr iMap )
 {
-    Util::uint32_t nameSize = iHeader.getName().size();
+    Util::uint32_t nameSize = iName.size();
     pushUint32WithHint( ioData, nameSize, 2 );
-    ioData.insert( ioData.end(), iHeader.getName().begin(),
-                   iHeader.getName().end() );
+    ioData.insert( ioData.end(), iName.begin(), iName.end() );
 
-    std::string metaData = iHeader.getMetaData().serialize();
+    std::string metaData = iMetaData.serialize();
     Util::uint32_t metaDataSize = ( Util::uint32_t ) metaData.size();
 
     Util::uint32_t metaDataIndex = iMap->getIndex( metaData );
@@ -509,6 +657,58 @@ void WriteObjectHeader( std::vector< Util::uint8_t > & ioData,
     }
 }
 
+//-*****************************************************************************
+void WriteObjectHeader( std::vector< Util::uint8_t > & ioData,
+                    const AbcA::ObjectHeader &iHeader,
+                    MetaDataMapPtr iMap )
+{
+    writeNameAndMetaData( ioData, iHeader.getName(), iHeader.getMetaData(),
+                          iMap );
+}
+
+//-*****************************************************************************
+static void pushUint64( std::vector< Util::uint8_t > & ioData,
+                        Util::uint64_t iVal )
+{
+    Util::uint8_t * data = ( Util::uint8_t * ) &iVal;
+    ioData.insert( ioData.end(), data, data + 8 );
+}
+
+//-*****************************************************************************
+struct PathIndexEntryLess
+{
+    bool operator()( const PathIndexEntry & iLeft,
+                     const PathIndexEntry & iRight ) const
+    {
+        return iLeft.second->getFullName() < iRight.second->getFullName();
+    }
+};
+
+//-*****************************************************************************
+void WritePathIndex( std::vector< Util::uint8_t > & ioData,
+                     std::vector< PathIndexEntry > & ioEntries,
+                     MetaDataMapPtr iMap )
+{
+    std::sort( ioEntries.begin(), ioEntries.end(), PathIndexEntryLess() );
+
+    // the number of entries, then where each entry starts so that they can
+    // be binary searched without having to read through all of them
+    std::size_t start = ioData.size();
+    pushUint64( ioData, ioEntries.size() );
+    ioData.resize( ioData.size() + ioEntries.size() * 8 );
+
+    for ( std::size_t i = 0; i < ioEntries.size(); ++i )
+    {
+        Util::uint64_t offset = ioData.size() - start;
+        memcpy( &ioData[ start + 8 + i * 8 ], &offset, 8 );
+
+        const AbcA::ObjectHeader & header = *ioEntries[i].second;
+        pushUint64( ioData, ioEntries[i].first );
+        writeNameAndMetaData( ioData, header.getFullName(),
+                              header.getMetaData(), iMap );
+    }
+}
+
 //-*****************************************************************************
 void WriteTimeSampling( std::vector< Util::uint8_t > & ioData,
                     Util::uint32_t  iMaxSample,
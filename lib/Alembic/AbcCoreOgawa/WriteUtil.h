@@ -59,6 +59,30 @@ void HashDimensions( const AbcA::Dimensions & iDims,
 WrittenSampleMap& GetWrittenSampleMap(
     AbcA::ArchiveWriterPtr iArchive );
 
+//-*****************************************************************************
+// lets the archive write a checkpoint after a sample has been written, if one
+// is due, see WriteArchive::setCheckpointInterval
+void CheckpointIfDue( AbcA::ArchiveWriterPtr iArchive );
+
+//-*****************************************************************************
+// Held while setting a sample, creating an object or property, or closing an
+// object or compound property, so that a checkpoint, which waits for these
+// to finish and holds off new ones, never sees one of them half done.
+// Nothing is locked for archives which don't write checkpoints.  It mustn't
+// be held when calling CheckpointIfDue, nor taken twice on one thread.
+class ChangeLock : Alembic::Util::noncopyable
+{
+public:
+    ChangeLock( AbcA::ArchiveWriterPtr iArchive );
+    ~ChangeLock();
+
+    // lets go of it before going out of scope
+    void unlock();
+
+private:
+    AbcA::ArchiveWriterPtr m_archive;
+};
+
 //-*****************************************************************************
 void
 WriteDimensions( Ogawa::OGroupPtr iGroup,
@@ -75,7 +99,32 @@ WrittenSampleIDPtr
 WriteData( WrittenSampleMap &iMap,
            Ogawa::OGroupPtr iGroup,
            const AbcA::ArraySample &iSamp,
-           const AbcA::ArraySample::Key &iKey );
+           const AbcA::ArraySample::Key &iKey,
+           Util::int8_t iCompressionHint );
+
+//-*****************************************************************************
+// writes the strings in iStrings as they are, without copying them first
+WrittenSampleIDPtr
+WriteData( WrittenSampleMap &iMap,
+           Ogawa::OGroupPtr iGroup,
+           const Util::StringArena &iStrings,
+           const AbcA::ArraySample::Key &iKey,
+           Util::int8_t iCompressionHint );
+
+//-*****************************************************************************
+// writes iData, a sample with key iKey as another archive stored it, key
+// included and maybe compressed, as it is
+WrittenSampleIDPtr
+WriteStoredData( WrittenSampleMap &iMap,
+                 Ogawa::OGroupPtr iGroup,
+                 const std::vector< char > & iData,
+                 bool iCompressed,
+                 std::size_t iNumPoints,
+                 const AbcA::ArraySample::Key &iKey );
+
+//-*****************************************************************************
+AbcA::ArraySample::Key
+GetStringsKey( const Util::StringArena &iStrings );
 
 //-*****************************************************************************
 void
@@ -95,6 +144,18 @@ WriteObjectHeader( std::vector< Util::uint8_t > & ioData,
                    const AbcA::ObjectHeader &iHeader,
                    MetaDataMapPtr iMap );
 
+//-*****************************************************************************
+// where the group of an object was written, see OGroup::getPos
+typedef std::pair< Util::uint64_t, ObjectHeaderPtr > PathIndexEntry;
+
+//-*****************************************************************************
+// sorts ioEntries by full name and packs them into a table which can be
+// searched without reading all of it, see FindInPathIndex
+void
+WritePathIndex( std::vector< Util::uint8_t > & ioData,
+                std::vector< PathIndexEntry > & ioEntries,
+                MetaDataMapPtr iMap );
+
 //-*****************************************************************************
 void
 WriteTimeSampling( std::vector< Util::uint8_t > & ioData,
@@ -0,0 +1,285 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/WrittenSampleMap.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+namespace {
+
+// how many buckets a shard starts out with when there's no limit
+const std::size_t INITIAL_BUCKETS = 16;
+
+// the shard was picked with the other word of the digest
+std::size_t bucketStart( const Util::Digest &iDigest,
+                         std::size_t iNumEntries,
+                         std::size_t iNumWays )
+{
+    std::size_t numBuckets = iNumEntries / iNumWays;
+    return ( iDigest.words[0] & ( numBuckets - 1 ) ) * iNumWays;
+}
+
+Util::uint32_t tick( Util::uint32_t &ioClock )
+{
+    // 0 marks an unused entry
+    if ( ++ioClock == 0 )
+    {
+        ++ioClock;
+    }
+    return ioClock;
+}
+
+}
+
+//-*****************************************************************************
+WrittenSampleMap::WrittenSampleMap()
+  : m_maxEntries( 0 )
+{
+}
+
+//-*****************************************************************************
+void WrittenSampleMap::setMaxBytes( std::size_t iMaxBytes )
+{
+    // each shard gets an even share, but always at least one bucket
+    m_maxEntries = iMaxBytes / ( sizeof( Entry ) * NUM_SHARDS );
+    if ( iMaxBytes != 0 && m_maxEntries < NUM_WAYS )
+    {
+        m_maxEntries = NUM_WAYS;
+    }
+}
+
+//-*****************************************************************************
+bool WrittenSampleMap::matches( const Entry &iEntry,
+                                const AbcA::ArraySample::Key &iKey )
+{
+    return iEntry.lastUsed != 0 && iEntry.digest == iKey.digest &&
+        iEntry.numBytes == iKey.numBytes &&
+        iEntry.origPOD == ( Util::uint8_t ) iKey.origPOD &&
+        iEntry.readPOD == ( Util::uint8_t ) iKey.readPOD;
+}
+
+//-*****************************************************************************
+WrittenSampleMap::Shard &
+WrittenSampleMap::getShard( const AbcA::ArraySample::Key &key )
+{
+    return m_shards[ key.digest.words[1] % NUM_SHARDS ];
+}
+
+//-*****************************************************************************
+WrittenSampleIDPtr
+WrittenSampleMap::find( const AbcA::ArraySample::Key &key )
+{
+    Shard &shard = getShard( key );
+    Alembic::Util::scoped_lock l( shard.lock );
+
+    if ( shard.entries.empty() )
+    {
+        return WrittenSampleIDPtr();
+    }
+
+    std::size_t start = bucketStart( key.digest, shard.entries.size(),
+                                     NUM_WAYS );
+    for ( std::size_t i = start; i < start + NUM_WAYS; ++i )
+    {
+        Entry &entry = shard.entries[i];
+        if ( matches( entry, key ) )
+        {
+            entry.lastUsed = tick( shard.clock );
+            return WrittenSampleIDPtr( new WrittenSampleID( key, entry.pos,
+                entry.numPoints ) );
+        }
+    }
+
+    return WrittenSampleIDPtr();
+}
+
+//-*****************************************************************************
+void WrittenSampleMap::store( WrittenSampleIDPtr r )
+{
+    if ( !r )
+    {
+        ABCA_THROW( "Invalid WrittenSampleIDPtr" );
+    }
+
+    const AbcA::ArraySample::Key &key = r->getKey();
+
+    Entry entry;
+    entry.digest = key.digest;
+    entry.numBytes = key.numBytes;
+    entry.pos = r->getObjectLocation();
+    entry.numPoints = r->getNumPoints();
+    entry.origPOD = key.origPOD;
+    entry.readPOD = key.readPOD;
+
+    Shard &shard = getShard( key );
+    Alembic::Util::scoped_lock l( shard.lock );
+
+    entry.lastUsed = tick( shard.clock );
+
+    if ( !shard.entries.empty() )
+    {
+        std::size_t start = bucketStart( key.digest, shard.entries.size(),
+                                         NUM_WAYS );
+        for ( std::size_t i = start; i < start + NUM_WAYS; ++i )
+        {
+            if ( matches( shard.entries[i], key ) )
+            {
+                shard.entries[i] = entry;
+                return;
+            }
+        }
+    }
+
+    bool canGrow = ( m_maxEntries == 0 ||
+                     shard.entries.size() * 2 <= m_maxEntries );
+
+    // keep it no more than 3/4 full
+    if ( shard.entries.empty() ||
+         ( canGrow && ( shard.numUsed + 1 ) * 4 > shard.entries.size() * 3 ) )
+    {
+        grow( shard );
+        canGrow = ( m_maxEntries == 0 ||
+                    shard.entries.size() * 2 <= m_maxEntries );
+    }
+
+    while ( !place( shard, entry, !canGrow ) )
+    {
+        grow( shard );
+        canGrow = ( m_maxEntries == 0 ||
+                    shard.entries.size() * 2 <= m_maxEntries );
+    }
+}
+
+//-*****************************************************************************
+bool WrittenSampleMap::place( Shard &ioShard, const Entry &iEntry,
+                              bool iCanEvict ) const
+{
+    std::size_t start = bucketStart( iEntry.digest, ioShard.entries.size(),
+                                     NUM_WAYS );
+
+    // the one which was used the longest ago
+    std::size_t oldest = start;
+    for ( std::size_t i = start; i < start + NUM_WAYS; ++i )
+    {
+        const Entry &entry = ioShard.entries[i];
+        if ( entry.lastUsed == 0 )
+        {
+            ioShard.entries[i] = iEntry;
+            ioShard.numUsed ++;
+            return true;
+        }
+
+        if ( ioShard.clock - entry.lastUsed >
+             ioShard.clock - ioShard.entries[oldest].lastUsed )
+        {
+            oldest = i;
+        }
+    }
+
+    if ( !iCanEvict )
+    {
+        return false;
+    }
+
+    ioShard.entries[oldest] = iEntry;
+    return true;
+}
+
+//-*****************************************************************************
+void WrittenSampleMap::grow( Shard &ioShard ) const
+{
+    std::size_t numEntries = ioShard.entries.size() * 2;
+    if ( numEntries == 0 )
+    {
+        numEntries = INITIAL_BUCKETS * NUM_WAYS;
+        while ( m_maxEntries != 0 && numEntries > m_maxEntries &&
+                numEntries > NUM_WAYS )
+        {
+            numEntries /= 2;
+        }
+    }
+
+    Entry unused;
+    unused.numBytes = 0;
+    unused.pos = 0;
+    unused.numPoints = 0;
+    unused.lastUsed = 0;
+    unused.origPOD = 0;
+    unused.readPOD = 0;
+
+    std::vector< Entry > oldEntries( numEntries, unused );
+    oldEntries.swap( ioShard.entries );
+    ioShard.numUsed = 0;
+
+    // doubling splits each bucket in two, so everything still fits
+    for ( std::size_t i = 0; i < oldEntries.size(); ++i )
+    {
+        if ( oldEntries[i].lastUsed != 0 )
+        {
+            place( ioShard, oldEntries[i], true );
+        }
+    }
+}
+
+//-*****************************************************************************
+void WrittenSampleMap::clear()
+{
+    for ( std::size_t i = 0; i < NUM_SHARDS; ++i )
+    {
+        Alembic::Util::scoped_lock l( m_shards[i].lock );
+        std::vector< Entry >().swap( m_shards[i].entries );
+        m_shards[i].numUsed = 0;
+    }
+}
+
+//-*****************************************************************************
+std::size_t WrittenSampleMap::getNumBytes() const
+{
+    std::size_t numBytes = 0;
+    for ( std::size_t i = 0; i < NUM_SHARDS; ++i )
+    {
+        Alembic::Util::scoped_lock l( m_shards[i].lock );
+        numBytes += m_shards[i].entries.size() * sizeof( Entry );
+    }
+    return numBytes;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
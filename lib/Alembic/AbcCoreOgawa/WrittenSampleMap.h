@@ -61,25 +61,27 @@ public:
         m_sampleKey.numBytes = 0;
         m_sampleKey.origPOD = Alembic::Util::kInt8POD;
         m_sampleKey.readPOD = Alembic::Util::kInt8POD;
+        m_pos = 0;
         m_numPoints = 0;
     }
 
     WrittenSampleID( const AbcA::ArraySample::Key &iKey,
-                     Ogawa::ODataPtr iData,
+                     Util::uint64_t iPos,
                      std::size_t iNumPoints )
-      : m_sampleKey( iKey ), m_data( iData ), m_numPoints( iNumPoints )
+      : m_sampleKey( iKey ), m_pos( iPos ), m_numPoints( iNumPoints )
     {
     }
 
     const AbcA::ArraySample::Key &getKey() const { return m_sampleKey; }
 
-    Ogawa::ODataPtr getObjectLocation() const { return m_data; }
+    // where the data was written, see Ogawa::OData::getPos
+    Util::uint64_t getObjectLocation() const { return m_pos; }
 
     std::size_t getNumPoints() { return m_numPoints; }
 
 private:
     AbcA::ArraySample::Key m_sampleKey;
-    Ogawa::ODataPtr m_data;
+    Util::uint64_t m_pos;
     std::size_t m_numPoints;
 };
 
@@ -88,48 +90,83 @@ typedef Alembic::Util::shared_ptr<WrittenSampleID> WrittenSampleIDPtr;
 
 //-*****************************************************************************
 // This class handles the mapping.
+// Samples can be looked up and stored from several threads at once, the keys
+// are spread over a number of separately locked shards so that threads
+// writing different samples seldom wait on each other.
+//
+// Each shard is a small open addressing table which only holds the key and
+// where the sample was written.  When the map is given a limit on how much
+// memory it may use, and is full, storing a sample forgets one of the least
+// recently used samples which would have gone in the same place.  Writing a
+// forgotten sample again just writes another copy of it.
 class WrittenSampleMap
 {
 protected:
     friend class AwImpl;
 
-    WrittenSampleMap() {}
+    WrittenSampleMap();
+
+    // about how many bytes the map can use, 0 means there is no limit
+    void setMaxBytes( std::size_t iMaxBytes );
 
 public:
 
     // Returns 0 if it can't find it
-    WrittenSampleIDPtr find( const AbcA::ArraySample::Key &key ) const
-    {
-        Map::const_iterator miter = m_map.find( key );
-        if ( miter != m_map.end() )
-        {
-            return (*miter).second;
-        }
-        else
-        {
-            return WrittenSampleIDPtr();
-        }
-    }
+    WrittenSampleIDPtr find( const AbcA::ArraySample::Key &key );
 
     // Store. Will clobber if you've already stored it.
-    void store( WrittenSampleIDPtr r )
+    void store( WrittenSampleIDPtr r );
+
+    void clear();
+
+    // how many bytes the map is using
+    std::size_t getNumBytes() const;
+
+protected:
+    struct Entry
     {
-        if ( !r )
-        {
-            ABCA_THROW( "Invalid WrittenSampleIDPtr" );
-        }
+        Util::Digest digest;
+        Util::uint64_t numBytes;
+        Util::uint64_t pos;
+        Util::uint64_t numPoints;
 
-        m_map[r->getKey()] = r;
-    }
+        // when it was last found or stored, 0 when the entry isn't used
+        Util::uint32_t lastUsed;
+        Util::uint8_t origPOD;
+        Util::uint8_t readPOD;
+    };
+
+    // each key can only go in one of this many entries
+    static const std::size_t NUM_WAYS = 4;
 
-    void clear()
+    struct Shard
     {
-        m_map.clear();
-    }
+        Shard() : numUsed( 0 ), clock( 0 ) {}
 
-protected:
-    typedef AbcA::UnorderedMapUtil<WrittenSampleIDPtr>::umap_type Map;
-    Map m_map;
+        mutable Alembic::Util::mutex lock;
+
+        // NUM_WAYS entries for each bucket, the number of buckets is a power
+        // of 2
+        std::vector< Entry > entries;
+        std::size_t numUsed;
+        Util::uint32_t clock;
+    };
+
+    static const std::size_t NUM_SHARDS = 16;
+
+    Shard &getShard( const AbcA::ArraySample::Key &key );
+
+    static bool matches( const Entry &iEntry,
+                         const AbcA::ArraySample::Key &iKey );
+
+    // when the shard can't grow, forgets what is in the way if iCanEvict
+    // otherwise returns false
+    bool place( Shard &ioShard, const Entry &iEntry, bool iCanEvict ) const;
+
+    void grow( Shard &ioShard ) const;
+
+    Shard m_shards[NUM_SHARDS];
+    std::size_t m_maxEntries;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -49,6 +49,11 @@ const Alembic::Util::uint64_t EMPTY_GROUP   = 0x0000000000000000ULL;
 const Alembic::Util::uint64_t INVALID_DATA  = 0xffffffffffffffffULL;
 const Alembic::Util::uint64_t EMPTY_DATA    = 0x8000000000000000ULL;
 
+// set on the size written before the bytes of a data when those bytes have
+// been compressed by whoever wrote them, readers from before this existed
+// see it as an illegal size rather than misreading the data
+const Alembic::Util::uint64_t COMPRESSED_DATA_FLAG = 0x8000000000000000ULL;
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
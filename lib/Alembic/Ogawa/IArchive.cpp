@@ -41,8 +41,9 @@ namespace ALEMBIC_VERSION_NS {
 
 IArchive::IArchive(const std::string & iFileName,
                    std::size_t iNumStreams,
-                   bool iUseMMap) :
-    mStreams(new IStreams(iFileName, iNumStreams, iUseMMap))
+                   bool iUseMMap,
+                   bool iShareFiles) :
+    mStreams(new IStreams(iFileName, iNumStreams, iUseMMap, iShareFiles))
 {
     init();
 }
@@ -87,6 +88,33 @@ IGroupPtr IArchive::getGroup() const
     return mGroup;
 }
 
+bool IArchive::refresh()
+{
+    if (!mStreams->refresh())
+    {
+        return false;
+    }
+
+    init();
+    return true;
+}
+
+IGroupPtr IArchive::getGroup(Alembic::Util::uint64_t iPos, bool iLight,
+                             std::size_t iThreadIndex) const
+{
+    IGroupPtr group;
+    if (isValid())
+    {
+        group.reset(new IGroup(mStreams, iPos, iLight, iThreadIndex));
+    }
+    return group;
+}
+
+IStreamsPtr IArchive::getStreams() const
+{
+    return mStreams;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
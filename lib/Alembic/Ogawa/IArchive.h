@@ -50,9 +50,11 @@ namespace ALEMBIC_VERSION_NS {
 class ALEMBIC_EXPORT IArchive
 {
 public:
+    // see IStreams for iShareFiles
     IArchive(const std::string & iFileName,
              std::size_t iNumStreams=1,
-             bool iUseMMap=true);
+             bool iUseMMap=true,
+             bool iShareFiles=false);
     IArchive(const std::vector< std::istream * > & iStreams);
     ~IArchive();
 
@@ -64,6 +66,19 @@ public:
 
     IGroupPtr getGroup() const;
 
+    // For an archive opened before it was closed, see IStreams::refresh.
+    // When it returns true getGroup gives back the new top group, groups
+    // already gotten from it are unchanged.
+    bool refresh();
+
+    // the group written at iPos, as given by OGroup::getPos when writing,
+    // rather than getting to it through its parents
+    IGroupPtr getGroup(Alembic::Util::uint64_t iPos, bool iLight,
+                       std::size_t iThreadIndex) const;
+
+    // the streams everything is read through, for turning on statistics
+    IStreamsPtr getStreams() const;
+
 private:
     void init();
     IStreamsPtr mStreams;
@@ -38,10 +38,132 @@
 #include <Alembic/Ogawa/IData.h>
 #include <Alembic/Ogawa/IStreams.h>
 
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
 namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+IDataHandle::IDataHandle()
+{
+    mStreams = NULL;
+    mPos = 0;
+    mSize = 0;
+    mHeadSize = 0;
+    mCompressed = false;
+}
+
+Alembic::Util::uint64_t IDataHandle::getHeaderSize(IStreams * iStreams,
+    Alembic::Util::uint64_t iPos)
+{
+    // don't try to read past the end, unless it's hopeless anyway
+    Alembic::Util::uint64_t headerSize = MAX_HEADER_SIZE;
+    Alembic::Util::uint64_t fileSize = iStreams->getSize();
+    if (iPos < fileSize && fileSize - iPos < headerSize)
+    {
+        headerSize = std::max< Alembic::Util::uint64_t >(8, fileSize - iPos);
+    }
+    return headerSize;
+}
+
+void IDataHandle::load(IStreams * iStreams, Alembic::Util::uint64_t iPos,
+                       std::size_t iThreadId)
+{
+    Alembic::Util::uint64_t pos = iPos & INVALID_GROUP;
+
+    // not the empty data?  then we need to read our header
+    if (pos == 0)
+    {
+        init(iStreams, iPos, NULL, 0);
+        return;
+    }
+
+    char header[MAX_HEADER_SIZE];
+    Alembic::Util::uint64_t headerSize = getHeaderSize(iStreams, pos);
+    iStreams->read(iThreadId, pos, headerSize, header);
+    init(iStreams, iPos, header, headerSize);
+}
+
+void IDataHandle::init(IStreams * iStreams, Alembic::Util::uint64_t iPos,
+                       const char * iHeader,
+                       Alembic::Util::uint64_t iHeaderSize)
+{
+    // strip off the top bit (indicates data) to get our seek position
+    mStreams = iStreams;
+    mPos = iPos & INVALID_GROUP;
+    mSize = 0;
+    mHeadSize = 0;
+    mCompressed = false;
+
+    if (mPos == 0)
+    {
+        return;
+    }
+
+    Alembic::Util::uint64_t size = 0;
+    memcpy(&size, iHeader, 8);
+
+    if (size & COMPRESSED_DATA_FLAG)
+    {
+        mCompressed = true;
+        size &= ~COMPRESSED_DATA_FLAG;
+    }
+
+    if (mStreams->getSize() < size)
+    {
+        throw std::runtime_error("Ogawa IData illegal size.");
+    }
+
+    mSize = size;
+    mHeadSize = std::min(size, iHeaderSize - 8);
+    memcpy(mHead, iHeader + 8, mHeadSize);
+}
+
+void IDataHandle::read(Alembic::Util::uint64_t iSize, void * iData,
+                       Alembic::Util::uint64_t iOffset,
+                       std::size_t iThreadId) const
+{
+    // don't read anything if we will read beyond our buffer
+    if (iSize == 0 || mSize == 0 || iOffset + iSize > mSize)
+    {
+        return;
+    }
+
+    // we already have it
+    if (iOffset + iSize <= mHeadSize)
+    {
+        memcpy(iData, mHead + iOffset, iSize);
+        return;
+    }
+
+    // +8 is to account for the size
+    mStreams->read(iThreadId, mPos + iOffset + 8, iSize, iData);
+}
+
+const void * IDataHandle::getMappedData(Alembic::Util::uint64_t iSize,
+                                        Alembic::Util::uint64_t iOffset,
+                                        IStreams::MappingPtr * oMapping) const
+{
+    if (iSize == 0 || mSize == 0 || iOffset + iSize > mSize)
+    {
+        return NULL;
+    }
+
+    // +8 is to account for the size
+    return mStreams->getMappedData(mPos + iOffset + 8, iSize, oMapping);
+}
+
+void IDataHandle::prefetch() const
+{
+    if (mSize > mHeadSize)
+    {
+        // +8 is to account for the size
+        mStreams->prefetch(mPos + 8, mSize);
+    }
+}
+
 class IData::PrivateData
 {
 public:
@@ -52,11 +174,10 @@ public:
 
     ~PrivateData() {};
 
+    // keeps the streams the handle points at alive
     IStreamsPtr streams;
 
-    // set after freeze
-    Alembic::Util::uint64_t pos;
-    Alembic::Util::uint64_t size;
+    IDataHandle handle;
 };
 
 IData::~IData()
@@ -69,49 +190,92 @@ IData::IData(IStreamsPtr iStreams,
              std::size_t iThreadId) :
     mData(new IData::PrivateData(iStreams))
 {
-    mData->size = 0;
+    mData->handle.load(iStreams.get(), iPos, iThreadId);
+}
 
-    // strip off the top bit (indicates data) to get our seek position
-    mData->pos = iPos & INVALID_GROUP;
+IData::IData(IStreamsPtr iStreams, const IDataHandle & iHandle) :
+    mData(new IData::PrivateData(iStreams))
+{
+    mData->handle = iHandle;
+}
 
-    Alembic::Util::uint64_t size = 0;
+void IData::read(Alembic::Util::uint64_t iSize, void * iData,
+                 Alembic::Util::uint64_t iOffset, std::size_t iThreadId)
+{
+    mData->handle.read(iSize, iData, iOffset, iThreadId);
+}
+
+void IData::readv(const ReadRequest * iRequests, std::size_t iNumRequests,
+                  std::size_t iThreadId)
+{
+    IStreams * streams = NULL;
+    std::vector< IStreams::ReadRequest > requests;
+    requests.reserve(iNumRequests);
 
-    // not the empty group?  then figure out our size
-    if ( mData->pos != 0 )
+    for (std::size_t i = 0; i < iNumRequests; ++i)
     {
-        mData->streams->read(iThreadId, mData->pos, 8, &size);
-        if (mData->streams->getSize() < size)
+        const ReadRequest & request = iRequests[i];
+        const IDataHandle & data = request.data->mData->handle;
+
+        // same rules as read
+        if (request.size == 0 || data.mSize == 0 ||
+            request.offset + request.size > data.mSize)
+        {
+            continue;
+        }
+
+        if (request.offset + request.size <= data.mHeadSize)
+        {
+            memcpy(request.buf, data.mHead + request.offset, request.size);
+            continue;
+        }
+
+        if (!streams)
         {
-            throw std::runtime_error("Ogawa IData illegal size.");
+            streams = data.mStreams;
         }
-        else
+        else if (streams != data.mStreams)
         {
-            mData->size = size;
+            throw std::runtime_error(
+                "Ogawa IData::readv data from different archives.");
         }
+
+        IStreams::ReadRequest streamRequest = {
+            data.mPos + request.offset + 8, request.size, request.buf };
+        requests.push_back(streamRequest);
     }
-}
 
-void IData::read(Alembic::Util::uint64_t iSize, void * iData,
-                 Alembic::Util::uint64_t iOffset, std::size_t iThreadId)
-{
-    // don't read anything if we will read beyond our buffer
-    if (iSize == 0 || mData->size == 0 || iOffset + iSize > mData->size)
+    if (!requests.empty())
     {
-        return;
+        streams->readv(iThreadId, &requests.front(), requests.size());
     }
+}
 
-    // +8 is to account for the size
-    mData->streams->read(iThreadId, mData->pos + iOffset + 8, iSize, iData);
+const void * IData::getMappedData(Alembic::Util::uint64_t iSize,
+                                  Alembic::Util::uint64_t iOffset,
+                                  IStreams::MappingPtr * oMapping) const
+{
+    return mData->handle.getMappedData(iSize, iOffset, oMapping);
+}
+
+void IData::prefetch()
+{
+    mData->handle.prefetch();
 }
 
 Alembic::Util::uint64_t IData::getSize() const
 {
-    return mData->size;
+    return mData->handle.getSize();
+}
+
+bool IData::isCompressed() const
+{
+    return mData->handle.isCompressed();
 }
 
 Alembic::Util::uint64_t IData::getPos() const
 {
-    return mData->pos;
+    return mData->handle.getPos();
 }
 
 } // End namespace ALEMBIC_VERSION_NS
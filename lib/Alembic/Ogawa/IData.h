@@ -44,6 +44,67 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+//! Everything needed to read a piece of data, held by value so that reading
+//! small pieces of data over and over doesn't have to allocate anything.
+//! Unlike an IData it doesn't keep the archive alive, so it is only good
+//! for as long as the IGroup it came from.  A default constructed handle,
+//! or one for a child which isn't data, isn't valid, much like a NULL
+//! IDataPtr.
+class ALEMBIC_EXPORT IDataHandle
+{
+public:
+    IDataHandle();
+
+    bool isValid() const { return mStreams != NULL; }
+
+    // the same as on IData
+    void read(Alembic::Util::uint64_t iSize, void * iData,
+              Alembic::Util::uint64_t iOffset, std::size_t iThreadId) const;
+
+    const void * getMappedData(Alembic::Util::uint64_t iSize,
+                               Alembic::Util::uint64_t iOffset,
+                               IStreams::MappingPtr * oMapping = NULL) const;
+
+    Alembic::Util::uint64_t getSize() const { return mSize; }
+
+    void prefetch() const;
+
+    bool isCompressed() const { return mCompressed; }
+
+    Alembic::Util::uint64_t getPos() const { return mPos; }
+
+private:
+    friend class IData;
+    friend class IGroup;
+
+    // how many bytes to read at iPos for the header, which is our size and
+    // as much of the start of our data as we hang on to, at most
+    // MAX_HEADER_SIZE
+    enum { MAX_HEADER_SIZE = 32 };
+    static Alembic::Util::uint64_t getHeaderSize(IStreams * iStreams,
+                                                 Alembic::Util::uint64_t iPos);
+
+    // reads our header from iStreams
+    void load(IStreams * iStreams, Alembic::Util::uint64_t iPos,
+              std::size_t iThreadId);
+
+    // for when the header was already read, see getHeaderSize
+    void init(IStreams * iStreams, Alembic::Util::uint64_t iPos,
+              const char * iHeader, Alembic::Util::uint64_t iHeaderSize);
+
+    // the start of the data is read along with the size and kept around,
+    // since that's where AbcCoreOgawa keeps the key and other small bits
+    // we'd otherwise go back to the file for
+    enum { HEAD_SIZE = MAX_HEADER_SIZE - 8 };
+
+    IStreams * mStreams;
+    Alembic::Util::uint64_t mPos;
+    Alembic::Util::uint64_t mSize;
+    Alembic::Util::uint64_t mHeadSize;
+    bool mCompressed;
+    char mHead[HEAD_SIZE];
+};
+
 class ALEMBIC_EXPORT IData
 {
 public:
@@ -53,8 +114,38 @@ public:
     void read(Alembic::Util::uint64_t iSize, void * iData,
               Alembic::Util::uint64_t iOffset, std::size_t iThreadId);
 
+    struct ReadRequest
+    {
+        IData * data;
+        Alembic::Util::uint64_t size;
+        void * buf;
+        Alembic::Util::uint64_t offset;
+    };
+
+    // does each of the reads like read() would, but all at once so that
+    // reads which are close together in the file can be merged.
+    // All of the data has to come from the same archive.
+    static void readv(const ReadRequest * iRequests, std::size_t iNumRequests,
+                      std::size_t iThreadId);
+
+    // if the archive is memory mapped, returns a pointer to iSize bytes of
+    // this data starting at iOffset without copying, otherwise NULL.
+    // The pointer stays valid for as long as this IData is alive and the
+    // archive isn't refreshed, or while oMapping is held onto, see
+    // IStreams::getMappedData.
+    const void * getMappedData(Alembic::Util::uint64_t iSize,
+                               Alembic::Util::uint64_t iOffset,
+                               IStreams::MappingPtr * oMapping = NULL) const;
+
     Alembic::Util::uint64_t getSize() const;
 
+    // a hint that all of this data will be read soon, see IStreams::prefetch
+    void prefetch();
+
+    // whether the writer flagged these bytes as compressed, Ogawa itself
+    // doesn't know or care how
+    bool isCompressed() const;
+
     // not really necessary for most workflows, it could be used by some
     // Ogawa utilities to detect when this IData is shared
     Alembic::Util::uint64_t getPos() const;
@@ -64,6 +155,9 @@ private:
     IData(IStreamsPtr iStreams, Alembic::Util::uint64_t iPos,
           std::size_t iThreadId);
 
+    // takes over a handle which came from iStreams
+    IData(IStreamsPtr iStreams, const IDataHandle & iHandle);
+
     class PrivateData;
     Alembic::Util::unique_ptr< PrivateData > mData;
 };
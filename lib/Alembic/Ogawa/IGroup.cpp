@@ -37,10 +37,23 @@
 #include <Alembic/Ogawa/IArchive.h>
 #include <Alembic/Ogawa/IStreams.h>
 
+#include <algorithm>
+
 namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+namespace
+{
+    // groups with more children than this don't read all of them up front,
+    // they read windows of this many children as they are needed
+    const Alembic::Util::uint64_t PAGE_SIZE = 512;
+
+    // and hang on to this many of those windows, the least recently used
+    // one is replaced when we need another
+    const std::size_t MAX_PAGES = 4;
+}
+
 class IGroup::PrivateData
 {
 public:
@@ -49,16 +62,102 @@ public:
         numChildren = 0;
         pos = 0;
         streams = iStreams;
+        paged = false;
+        threadIndex = 0;
+        pageUses = 0;
     }
 
     ~PrivateData() {}
 
+    // the position of child iIndex, which has to be < numChildren
+    Alembic::Util::uint64_t getChild(Alembic::Util::uint64_t iIndex,
+                                     std::size_t iThreadIndex)
+    {
+        if (!childVec.empty())
+        {
+            return childVec[iIndex];
+        }
+
+        if (!paged)
+        {
+            Alembic::Util::uint64_t childPos = 0;
+            streams->read(iThreadIndex, pos + 8 * iIndex + 8, 8, &childPos);
+            return childPos;
+        }
+
+        Alembic::Util::uint64_t first = iIndex - iIndex % PAGE_SIZE;
+
+        Alembic::Util::scoped_lock l(pageLock);
+
+        Page * page = NULL;
+        for (std::size_t i = 0; i < pages.size(); ++i)
+        {
+            if (pages[i].first == first)
+            {
+                page = &pages[i];
+                break;
+            }
+        }
+
+        if (!page)
+        {
+            // read it before touching the pages, so that if the read fails
+            // no page is left claiming children it doesn't have
+            Alembic::Util::uint64_t numPageChildren =
+                std::min(PAGE_SIZE, numChildren - first);
+            std::vector<Alembic::Util::uint64_t> children(numPageChildren);
+            streams->read(iThreadIndex, pos + 8 * first + 8,
+                          8 * numPageChildren, &(children.front()));
+
+            if (pages.size() < MAX_PAGES)
+            {
+                pages.push_back(Page());
+                page = &pages.back();
+            }
+            else
+            {
+                page = &pages.front();
+                for (std::size_t i = 1; i < pages.size(); ++i)
+                {
+                    if (pages[i].lastUse < page->lastUse)
+                    {
+                        page = &pages[i];
+                    }
+                }
+            }
+
+            page->first = first;
+            page->children.swap(children);
+        }
+
+        page->lastUse = ++pageUses;
+        return page->children[iIndex - first];
+    }
+
     IStreamsPtr streams;
 
     std::vector<Alembic::Util::uint64_t> childVec;
 
     Alembic::Util::uint64_t numChildren;
     Alembic::Util::uint64_t pos;
+
+    // for big groups, childVec stays empty and the children are read a
+    // window at a time instead
+    struct Page
+    {
+        Alembic::Util::uint64_t first;
+        Alembic::Util::uint64_t lastUse;
+        std::vector<Alembic::Util::uint64_t> children;
+    };
+
+    bool paged;
+
+    // used when we're asked about our children without a thread index
+    std::size_t threadIndex;
+
+    Alembic::Util::mutex pageLock;
+    std::vector<Page> pages;
+    Alembic::Util::uint64_t pageUses;
 };
 
 IGroup::IGroup(IStreamsPtr iStreams,
@@ -74,6 +173,7 @@ IGroup::IGroup(IStreamsPtr iStreams,
     }
 
     mData->pos = iPos;
+    mData->threadIndex = iThreadIndex;
     mData->streams->read(iThreadIndex, iPos, 8, &mData->numChildren);
 
     // make sure we don't have a maliciously bad number of children
@@ -88,13 +188,22 @@ IGroup::IGroup(IStreamsPtr iStreams,
     // special EMPTY_GROUP instead
 
     // read all our child indices, unless we are light and have more than 8
-    // children
-    if (!iLight || mData->numChildren < 9)
+    // children, or we have so many that we'll read them as we need them
+    if (iLight && mData->numChildren > 8)
     {
-        mData->childVec.resize(mData->numChildren);
-        mData->streams->read(iThreadIndex, iPos + 8, mData->numChildren * 8,
-                             &(mData->childVec.front()));
+        return;
     }
+
+    if (mData->numChildren > PAGE_SIZE)
+    {
+        mData->paged = true;
+        mData->pages.reserve(MAX_PAGES);
+        return;
+    }
+
+    mData->childVec.resize(mData->numChildren);
+    mData->streams->read(iThreadIndex, iPos + 8, mData->numChildren * 8,
+                         &(mData->childVec.front()));
 }
 
 IGroup::~IGroup()
@@ -107,21 +216,13 @@ IGroupPtr IGroup::getGroup(Alembic::Util::uint64_t iIndex, bool iLight,
 {
     IGroupPtr child;
 
-    Alembic::Util::uint64_t childPos = EMPTY_DATA;
-
-    if (isLight())
-    {
-        if (iIndex < mData->numChildren)
-        {
-            mData->streams->read(iThreadIndex, mData->pos + 8 * iIndex + 8, 8,
-                                 &childPos);
-        }
-    }
-    else if (isChildGroup(iIndex))
+    if (iIndex >= mData->numChildren)
     {
-        childPos = mData->childVec[iIndex];
+        return child;
     }
 
+    Alembic::Util::uint64_t childPos = mData->getChild(iIndex, iThreadIndex);
+
     // sanity check that we have a valid group, either an empty one
     // or a non data that has a decent value
     if (childPos == EMPTY_GROUP || ((childPos & EMPTY_DATA) == 0 &&
@@ -137,27 +238,178 @@ IDataPtr IGroup::getData(Alembic::Util::uint64_t iIndex,
                          std::size_t iThreadIndex)
 {
     IDataPtr child;
-    if (isLight())
+
+    IDataHandle handle;
+    if (getData(iIndex, iThreadIndex, handle))
+    {
+        child.reset(new IData(mData->streams, handle));
+    }
+
+    return child;
+}
+
+void IGroup::getData(Alembic::Util::uint64_t iIndex,
+                     Alembic::Util::uint64_t iNumData,
+                     std::size_t iThreadIndex,
+                     std::vector< IDataPtr > & oData)
+{
+    oData.assign(iNumData, IDataPtr());
+    if (iIndex >= mData->numChildren || iNumData == 0)
+    {
+        return;
+    }
+
+    std::size_t numData = std::min(iNumData, mData->numChildren - iIndex);
+    std::vector< IDataHandle > handles(numData);
+    getData(iIndex, numData, iThreadIndex, &handles.front());
+
+    for (std::size_t i = 0; i < numData; ++i)
     {
-        if (iIndex < mData->numChildren)
+        if (handles[i].isValid())
         {
-            Alembic::Util::uint64_t childPos = 0;
-            mData->streams->read(iThreadIndex, mData->pos + 8 * iIndex + 8, 8,
-                                 &childPos);
+            oData[i].reset(new IData(mData->streams, handles[i]));
+        }
+    }
+}
 
-            // top bit should be set for data
-            if ((childPos & EMPTY_DATA) != 0)
-            {
-                child.reset(new IData(mData->streams, childPos, iThreadIndex));
-            }
+bool IGroup::getData(Alembic::Util::uint64_t iIndex, std::size_t iThreadIndex,
+                     IDataHandle & oData)
+{
+    oData = IDataHandle();
+
+    if (iIndex >= mData->numChildren)
+    {
+        return false;
+    }
+
+    Alembic::Util::uint64_t childPos = mData->getChild(iIndex, iThreadIndex);
+
+    // top bit should be set for data
+    if ((childPos & EMPTY_DATA) == 0)
+    {
+        return false;
+    }
+
+    oData.load(mData->streams.get(), childPos, iThreadIndex);
+    return true;
+}
+
+void IGroup::getData(Alembic::Util::uint64_t iIndex,
+                     Alembic::Util::uint64_t iNumData,
+                     std::size_t iThreadIndex,
+                     IDataHandle * oData)
+{
+    getData(iIndex, iNumData, 1, iThreadIndex, oData);
+}
+
+void IGroup::getData(Alembic::Util::uint64_t iIndex,
+                     Alembic::Util::uint64_t iNumData,
+                     Alembic::Util::uint64_t iStride,
+                     std::size_t iThreadIndex,
+                     IDataHandle * oData)
+{
+    for (Alembic::Util::uint64_t i = 0; i < iNumData; ++i)
+    {
+        oData[i] = IDataHandle();
+    }
+
+    if (iIndex >= mData->numChildren || iStride == 0)
+    {
+        return;
+    }
+
+    std::size_t numData = std::min(iNumData,
+        (mData->numChildren - iIndex + iStride - 1) / iStride);
+
+    // a few fit on the stack, any more than that and we allocate so that
+    // they can all be read together
+    const std::size_t STACK_SIZE = 8;
+    Alembic::Util::uint64_t stackPos[STACK_SIZE];
+    char stackHeaders[STACK_SIZE * IDataHandle::MAX_HEADER_SIZE];
+    IStreams::ReadRequest stackRequests[STACK_SIZE];
+
+    std::vector< Alembic::Util::uint64_t > heapPos;
+    std::vector< char > heapHeaders;
+    std::vector< IStreams::ReadRequest > heapRequests;
+
+    Alembic::Util::uint64_t * childPos = stackPos;
+    char * headers = stackHeaders;
+    IStreams::ReadRequest * requests = stackRequests;
+
+    if (numData > STACK_SIZE)
+    {
+        heapPos.resize(numData);
+        heapHeaders.resize(numData * IDataHandle::MAX_HEADER_SIZE);
+        heapRequests.resize(numData);
+        childPos = &heapPos.front();
+        headers = &heapHeaders.front();
+        requests = &heapRequests.front();
+    }
+
+    IStreams * streams = mData->streams.get();
+    if (isLight() && iStride == 1)
+    {
+        streams->read(iThreadIndex, mData->pos + 8 * iIndex + 8,
+                      8 * numData, childPos);
+    }
+    else if (isLight())
+    {
+        for (std::size_t i = 0; i < numData; ++i)
+        {
+            IStreams::ReadRequest request = {
+                mData->pos + 8 * (iIndex + i * iStride) + 8, 8,
+                &childPos[i] };
+            requests[i] = request;
         }
+        streams->readv(iThreadIndex, requests, numData);
     }
-    else if (isChildData(iIndex))
+    else
     {
-        child.reset(new IData(mData->streams, mData->childVec[iIndex],
-                              iThreadIndex));
+        for (std::size_t i = 0; i < numData; ++i)
+        {
+            childPos[i] = mData->getChild(iIndex + i * iStride, iThreadIndex);
+        }
+    }
+
+    // read all of the headers together
+    std::size_t numRequests = 0;
+    for (std::size_t i = 0; i < numData; ++i)
+    {
+        Alembic::Util::uint64_t pos = childPos[i] & INVALID_GROUP;
+        if ((childPos[i] & EMPTY_DATA) != 0 && pos != 0)
+        {
+            IStreams::ReadRequest request = { pos,
+                IDataHandle::getHeaderSize(streams, pos),
+                &headers[i * IDataHandle::MAX_HEADER_SIZE] };
+            requests[numRequests++] = request;
+        }
+    }
+
+    if (numRequests != 0)
+    {
+        streams->readv(iThreadIndex, requests, numRequests);
+    }
+
+    std::size_t requestIndex = 0;
+    for (std::size_t i = 0; i < numData; ++i)
+    {
+        // top bit should be set for data
+        if ((childPos[i] & EMPTY_DATA) == 0)
+        {
+            continue;
+        }
+
+        if ((childPos[i] & INVALID_GROUP) == 0)
+        {
+            oData[i].init(streams, childPos[i], NULL, 0);
+        }
+        else
+        {
+            const IStreams::ReadRequest & request = requests[requestIndex++];
+            oData[i].init(streams, childPos[i],
+                static_cast< const char * >(request.buf), request.size);
+        }
     }
-    return child;
 }
 
 Alembic::Util::uint64_t IGroup::getNumChildren() const
@@ -167,31 +419,32 @@ Alembic::Util::uint64_t IGroup::getNumChildren() const
 
 bool IGroup::isChildGroup(Alembic::Util::uint64_t iIndex) const
 {
-    return (iIndex < mData->childVec.size() &&
-            (mData->childVec[iIndex] & EMPTY_DATA) == 0);
+    return (iIndex < mData->numChildren && !isLight() &&
+            (mData->getChild(iIndex, mData->threadIndex) & EMPTY_DATA) == 0);
 }
 
 bool IGroup::isChildData(Alembic::Util::uint64_t iIndex) const
 {
-    return (iIndex < mData->childVec.size() &&
-            (mData->childVec[iIndex] & EMPTY_DATA) != 0);
+    return (iIndex < mData->numChildren && !isLight() &&
+            (mData->getChild(iIndex, mData->threadIndex) & EMPTY_DATA) != 0);
 }
 
 bool IGroup::isEmptyChildGroup(Alembic::Util::uint64_t iIndex) const
 {
-    return (iIndex < mData->childVec.size() &&
-            mData->childVec[iIndex] == EMPTY_GROUP);
+    return (iIndex < mData->numChildren && !isLight() &&
+            mData->getChild(iIndex, mData->threadIndex) == EMPTY_GROUP);
 }
 
 bool IGroup::isEmptyChildData(Alembic::Util::uint64_t iIndex) const
 {
-    return (iIndex < mData->childVec.size() &&
-        mData->childVec[iIndex] == EMPTY_DATA);
+    return (iIndex < mData->numChildren && !isLight() &&
+        mData->getChild(iIndex, mData->threadIndex) == EMPTY_DATA);
 }
 
 bool IGroup::isLight() const
 {
-    return mData->numChildren != 0 && mData->childVec.empty();
+    return mData->numChildren != 0 && mData->childVec.empty() &&
+        !mData->paged;
 }
 
 } // End namespace ALEMBIC_VERSION_NS
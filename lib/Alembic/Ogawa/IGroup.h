@@ -58,6 +58,36 @@ public:
 
     IDataPtr getData(Alembic::Util::uint64_t iIndex, std::size_t iThreadIndex);
 
+    // gets iNumData children starting at iIndex at once, reading what
+    // they need to get started in as few trips to the file as possible.
+    // oData ends up with iNumData entries, any which aren't data are NULL.
+    void getData(Alembic::Util::uint64_t iIndex,
+                 Alembic::Util::uint64_t iNumData,
+                 std::size_t iThreadIndex,
+                 std::vector< IDataPtr > & oData);
+
+    // the same as the above, but filling in handles instead, so that nothing
+    // is allocated.  The handles are only good while this group is alive.
+    // Returns false, with oData left invalid, if the child isn't data.
+    bool getData(Alembic::Util::uint64_t iIndex, std::size_t iThreadIndex,
+                 IDataHandle & oData);
+
+    // oData has to have room for iNumData handles
+    void getData(Alembic::Util::uint64_t iIndex,
+                 Alembic::Util::uint64_t iNumData,
+                 std::size_t iThreadIndex,
+                 IDataHandle * oData);
+
+    // the same as the above, but for every iStride'th child starting at
+    // iIndex, like just the data of samples which are each written as data
+    // followed by their dimensions.  Any number of handles are read in one
+    // go, which allocates if there are more than a few.
+    void getData(Alembic::Util::uint64_t iIndex,
+                 Alembic::Util::uint64_t iNumData,
+                 Alembic::Util::uint64_t iStride,
+                 std::size_t iThreadIndex,
+                 IDataHandle * oData);
+
     Alembic::Util::uint64_t getNumChildren() const;
 
     bool isChildGroup(Alembic::Util::uint64_t iIndex) const;
@@ -34,7 +34,13 @@
 //-*****************************************************************************
 
 #include <Alembic/Ogawa/IStreams.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
 #include <fstream>
+#include <list>
+#include <map>
 #include <stdexcept>
 
 
@@ -71,6 +77,77 @@ namespace ALEMBIC_VERSION_NS
 namespace
 {
 
+// the requests all come from one array, so ties are broken by where they
+// are in it, which keeps them in the order they were asked for
+bool requestLess(const IStreams::ReadRequest * iLhs,
+                 const IStreams::ReadRequest * iRhs)
+{
+    return iLhs->pos < iRhs->pos || (iLhs->pos == iRhs->pos && iLhs < iRhs);
+}
+
+// tells one file apart from another no matter which name it is opened by,
+// along with enough to notice that it has been rewritten since
+struct FileKey
+{
+    Alembic::Util::uint64_t device;
+    Alembic::Util::uint64_t index;
+    Alembic::Util::uint64_t size;
+    Alembic::Util::int64_t modified;
+
+    // memory mapped and file stream readers aren't shared with each other
+    bool mapped;
+
+    bool operator<(const FileKey & iRhs) const
+    {
+        if (device != iRhs.device) return device < iRhs.device;
+        if (index != iRhs.index) return index < iRhs.index;
+        if (size != iRhs.size) return size < iRhs.size;
+        if (modified != iRhs.modified) return modified < iRhs.modified;
+        return mapped < iRhs.mapped;
+    }
+
+    bool operator==(const FileKey & iRhs) const
+    {
+        return !(*this < iRhs) && !(iRhs < *this);
+    }
+};
+
+bool getFileKey(const std::string & iFileName, bool iMapped, FileKey & oKey)
+{
+#ifdef _WIN32
+    // no access is needed just to ask about it
+    HANDLE file = CreateFileA(iFileName.c_str(), 0,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    BY_HANDLE_FILE_INFORMATION info;
+    BOOL success = GetFileInformationByHandle(file, &info);
+    CloseHandle(file);
+    if (!success) return false;
+
+    oKey.device = info.dwVolumeSerialNumber;
+    oKey.index = (Alembic::Util::uint64_t(info.nFileIndexHigh) << 32) |
+        info.nFileIndexLow;
+    oKey.size = (Alembic::Util::uint64_t(info.nFileSizeHigh) << 32) |
+        info.nFileSizeLow;
+    oKey.modified =
+        (Alembic::Util::int64_t(info.ftLastWriteTime.dwHighDateTime) << 32) |
+        info.ftLastWriteTime.dwLowDateTime;
+#else
+    struct stat buf;
+    if (stat(iFileName.c_str(), &buf) < 0) return false;
+
+    oKey.device = buf.st_dev;
+    oKey.index = buf.st_ino;
+    oKey.size = buf.st_size;
+    oKey.modified = buf.st_mtime;
+#endif
+
+    oKey.mapped = iMapped;
+    return true;
+}
+
 class IStreamReader
 {
 public:
@@ -83,8 +160,119 @@ public:
     virtual bool read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
                       Alembic::Util::uint64_t iSize, void* oBuf) = 0;
 
+    // reads close to each other are merged, as long as the bytes in between
+    // are fewer than this, and the merged read stays under MAX_MERGED_READ
+    static const Alembic::Util::uint64_t MAX_READ_GAP = 4096;
+    static const Alembic::Util::uint64_t MAX_MERGED_READ = 262144;
+
+    virtual bool readv(std::size_t iThreadId,
+                       const IStreams::ReadRequest * iRequests,
+                       std::size_t iNumRequests)
+    {
+        // visit them in file order, a handful of requests, which is the
+        // common case, are sorted and merged on the stack
+        const std::size_t NUM_LOCAL = 16;
+        const IStreams::ReadRequest * localOrder[NUM_LOCAL];
+        std::vector< const IStreams::ReadRequest * > orderVec;
+        const IStreams::ReadRequest ** order = localOrder;
+        if (iNumRequests > NUM_LOCAL)
+        {
+            orderVec.resize(iNumRequests);
+            order = &orderVec.front();
+        }
+
+        for (std::size_t i = 0; i < iNumRequests; ++i)
+        {
+            order[i] = &iRequests[i];
+        }
+        std::sort(order, order + iNumRequests, requestLess);
+
+        char localMerged[MAX_READ_GAP + 1024];
+        std::vector< char > merged;
+        std::size_t i = 0;
+        while (i < iNumRequests)
+        {
+            Alembic::Util::uint64_t start = order[i]->pos;
+            Alembic::Util::uint64_t end = start + order[i]->size;
+
+            std::size_t j = i + 1;
+            for (; j < iNumRequests; ++j)
+            {
+                Alembic::Util::uint64_t nextEnd =
+                    std::max(end, order[j]->pos + order[j]->size);
+                if (order[j]->pos > end + MAX_READ_GAP ||
+                    nextEnd - start > MAX_MERGED_READ)
+                {
+                    break;
+                }
+                end = nextEnd;
+            }
+
+            if (j == i + 1)
+            {
+                if (order[i]->size != 0 && !read(iThreadId, order[i]->pos,
+                    order[i]->size, order[i]->buf))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                char * mergedBuf = localMerged;
+                if (end - start > sizeof(localMerged))
+                {
+                    merged.resize(end - start);
+                    mergedBuf = &merged.front();
+                }
+
+                if (!read(iThreadId, start, end - start, mergedBuf))
+                {
+                    return false;
+                }
+
+                for (std::size_t k = i; k < j; ++k)
+                {
+                    if (order[k]->size != 0)
+                    {
+                        std::memcpy(order[k]->buf,
+                                    mergedBuf + (order[k]->pos - start),
+                                    order[k]->size);
+                    }
+                }
+            }
+
+            i = j;
+        }
+
+        return true;
+    }
+
     // not all streams have a size
     virtual Alembic::Util::uint64_t size() {return 0xffffffffffffffff;};
+
+    // only readers which have the whole file resident in memory can hand
+    // back a pointer to it, everyone else returns NULL, see
+    // IStreams::getMappedData
+    virtual const void * getMappedData(Alembic::Util::uint64_t /*iPos*/,
+                                       Alembic::Util::uint64_t /*iSize*/,
+                                       IStreams::MappingPtr * /*oMapping*/)
+    {
+        return NULL;
+    }
+
+    // a hint that this part of the file will be read soon, readers which
+    // can't do anything useful with that just ignore it
+    virtual void prefetch(Alembic::Util::uint64_t /*iPos*/,
+                          Alembic::Util::uint64_t /*iSize*/)
+    {
+    }
+
+    // picks up whatever has been appended to the file since it was opened,
+    // returns whether there is more to read than before
+    virtual bool refresh()
+    {
+        return false;
+    }
 };
 
 typedef Alembic::Util::shared_ptr<IStreamReader> IStreamReaderPtr;
@@ -104,6 +292,22 @@ public:
         {
             offsets.push_back(streams[i]->tellg());
         }
+
+        // how much there is to read past that, if we can tell
+        streamSize = 0xffffffffffffffff;
+        if (!streams.empty() && streams[0]->good())
+        {
+            std::istream * stream = streams[0];
+            stream->seekg(0, std::ios_base::end);
+            std::streamoff end = stream->tellg();
+            if (stream->good() && end >= 0 &&
+                static_cast<Alembic::Util::uint64_t>(end) >= offsets[0])
+            {
+                streamSize = end - offsets[0];
+            }
+            stream->clear();
+            stream->seekg(offsets[0]);
+        }
     }
 
     ~StdIStreamReader()
@@ -121,6 +325,11 @@ public:
         return !streams.empty();
     }
 
+    Alembic::Util::uint64_t size()
+    {
+        return streamSize;
+    }
+
     bool read(std::size_t iTheadId, Alembic::Util::uint64_t iPos,
               Alembic::Util::uint64_t iSize, void* oBuf)
     {
@@ -145,13 +354,14 @@ public:
 private:
     std::vector<std::istream*> streams;
     std::vector<Alembic::Util::uint64_t> offsets;
+    Alembic::Util::uint64_t streamSize;
     Alembic::Util::mutex* locks;
 };
 
 
 class FileIStreamReader : public IStreamReader
 {
-private:
+protected:
 
 // Platform support functions for file access
 #ifdef _WIN32
@@ -355,7 +565,31 @@ public:
         return readFile(fid, oBuf, iPos, iSize);
     }
 
-private:
+    void prefetch(Alembic::Util::uint64_t iPos, Alembic::Util::uint64_t iSize)
+    {
+#if defined(POSIX_FADV_WILLNEED)
+        if (isOpen() && iPos < fileLen)
+        {
+            // the kernel starts reading it in without us waiting on it
+            posix_fadvise(fid, iPos, std::min(iSize, fileLen - iPos),
+                          POSIX_FADV_WILLNEED);
+        }
+#endif
+    }
+
+    bool refresh()
+    {
+        Alembic::Util::uint64_t newLen = 0;
+        if (!isOpen() || getFileLength(fid, newLen) < 0 || newLen <= fileLen)
+        {
+            return false;
+        }
+
+        fileLen = newLen;
+        return true;
+    }
+
+protected:
     FileDescriptor fid;
     size_t nstreams;
     Alembic::Util::uint64_t fileLen;
@@ -397,6 +631,18 @@ private:
         return 0;
     }
 
+    static bool getFileIdentity(FileHandle iFile,
+                                Alembic::Util::uint64_t & oDevice,
+                                Alembic::Util::uint64_t & oIndex)
+    {
+        struct stat buf;
+        if (fstat(iFile, &buf) < 0) return false;
+
+        oDevice = buf.st_dev;
+        oIndex = buf.st_ino;
+        return true;
+    }
+
     struct MappedRegion
     {
         size_t len;
@@ -470,6 +716,19 @@ private:
         return 0;
     }
 
+    static bool getFileIdentity(FileHandle iFile,
+                                Alembic::Util::uint64_t & oDevice,
+                                Alembic::Util::uint64_t & oIndex)
+    {
+        BY_HANDLE_FILE_INFORMATION info;
+        if (!GetFileInformationByHandle(iFile, &info)) return false;
+
+        oDevice = info.dwVolumeSerialNumber;
+        oIndex = (Alembic::Util::uint64_t(info.nFileIndexHigh) << 32) |
+            info.nFileIndexLow;
+        return true;
+    }
+
     struct MappedRegion
     {
         Alembic::Util::uint64_t len;
@@ -528,27 +787,26 @@ public:
     MemoryMappedIStreamReader(const std::string& iFileName,
                               std::size_t iNumStreams)
         : nstreams(iNumStreams), fileName(iFileName),
-          fileHandle(BAD_FILE_HANDLE)
+          mappedRegion(new MappedRegion()), device(0), index(0)
     {
-        fileHandle = openFile(iFileName);
+        FileHandle fileHandle = openFile(iFileName);
         if (fileHandle == BAD_FILE_HANDLE) return;
 
         size_t len = 0;
-        int err = getFileLength(fileHandle, len);
-        if (err < 0) return;
-
-        mappedRegion.map(fileHandle, len);
-    }
+        if (getFileIdentity(fileHandle, device, index) &&
+            getFileLength(fileHandle, len) >= 0)
+        {
+            mappedRegion->map(fileHandle, len);
+        }
 
-    ~MemoryMappedIStreamReader()
-    {
-        mappedRegion.close();
+        // the mapping keeps the file around by itself, so there's no need
+        // to hold onto a handle which counts against the open file limit
         closeFile(fileHandle);
     }
 
     bool isOpen() const
     {
-        return mappedRegion.isMapped();
+        return mappedRegion->isMapped();
     }
 
     size_t numStreams() const
@@ -560,33 +818,602 @@ public:
 
     Alembic::Util::uint64_t size()
     {
-        return static_cast<Alembic::Util::uint64_t>(mappedRegion.len);
+        return static_cast<Alembic::Util::uint64_t>(mappedRegion->len);
     }
 
     bool read(std::size_t iStream, Alembic::Util::uint64_t iPos,
               Alembic::Util::uint64_t iSize, void* oBuf)
     {
-        if (iSize > mappedRegion.len || iPos > mappedRegion.len || iPos + iSize > mappedRegion.len) return false;
+        const void * p = getMappedData(iPos, iSize, NULL);
+        if (p == NULL) return false;
 
-        const char* p = static_cast<const char*>(mappedRegion.p) + iPos;
         std::memcpy(oBuf, p, iSize);
 
         return true;
     }
 
+    // nothing to gain from merging, it's all in memory already
+    bool readv(std::size_t iStream, const IStreams::ReadRequest * iRequests,
+               std::size_t iNumRequests)
+    {
+        for (std::size_t i = 0; i < iNumRequests; ++i)
+        {
+            if (!read(iStream, iRequests[i].pos, iRequests[i].size,
+                      iRequests[i].buf))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    const void * getMappedData(Alembic::Util::uint64_t iPos,
+                               Alembic::Util::uint64_t iSize,
+                               IStreams::MappingPtr * oMapping)
+    {
+        const MappedRegion & region = *mappedRegion;
+        if (iSize > region.len || iPos > region.len ||
+            iPos + iSize > region.len)
+        {
+            return NULL;
+        }
+
+        if (oMapping)
+        {
+            *oMapping = mappedRegion;
+        }
+
+        return static_cast<const char*>(region.p) + iPos;
+    }
+
+    void prefetch(Alembic::Util::uint64_t iPos, Alembic::Util::uint64_t iSize)
+    {
+#if !defined(_WIN32) && defined(MADV_WILLNEED)
+        if (iPos >= mappedRegion->len || iSize == 0)
+        {
+            return;
+        }
+
+        iSize = std::min<Alembic::Util::uint64_t>(iSize,
+                                                  mappedRegion->len - iPos);
+
+        // madvise wants page aligned addresses
+        Alembic::Util::uint64_t pageSize = sysconf(_SC_PAGESIZE);
+        Alembic::Util::uint64_t start = iPos - iPos % pageSize;
+        madvise(static_cast<char*>(mappedRegion->p) + start,
+                iSize + iPos - start, MADV_WILLNEED);
+#endif
+    }
+
+    // the old mapping goes away with the last zero copy sample pointing
+    // into it, right away if there aren't any
+    bool refresh()
+    {
+        FileHandle fileHandle = openFile(fileName);
+        if (fileHandle == BAD_FILE_HANDLE) return false;
+
+        // a file written over or renamed into its place isn't more of the
+        // one we have
+        bool grown = false;
+        Alembic::Util::uint64_t newDevice = 0;
+        Alembic::Util::uint64_t newIndex = 0;
+        size_t len = 0;
+        if (getFileIdentity(fileHandle, newDevice, newIndex) &&
+            newDevice == device && newIndex == index &&
+            getFileLength(fileHandle, len) >= 0 && len > mappedRegion->len)
+        {
+            Alembic::Util::shared_ptr< MappedRegion > newRegion(
+                new MappedRegion());
+            newRegion->map(fileHandle, len);
+            if (newRegion->isMapped())
+            {
+                mappedRegion = newRegion;
+                grown = true;
+            }
+        }
+
+        closeFile(fileHandle);
+        return grown;
+    }
+
+private:
+    std::size_t nstreams;
+    std::string fileName;
+
+    // shared with the zero copy samples pointing into it
+    Alembic::Util::shared_ptr< MappedRegion > mappedRegion;
+
+    // which file was opened, so refresh doesn't pick up a different one
+    Alembic::Util::uint64_t device;
+    Alembic::Util::uint64_t index;
+};
+
+class SharedFileIStreamReader;
+
+// Readers of the same file are shared by the IStreams which ask to share
+// them.  When there is a limit on how many files may be open at once, the
+// shared file stream readers close their descriptors, least recently read
+// first, to stay under it, and open them again when they are next read.
+// Memory mapped readers don't hold a descriptor open.
+class ReaderPool
+{
+public:
+    // never destroyed, so readers outliving static destruction can still
+    // take themselves out of it
+    static ReaderPool & get()
+    {
+        static ReaderPool * pool = new ReaderPool();
+        return *pool;
+    }
+
+    // oKey is set to whatever the file was looked up by
+    IStreamReaderPtr getReader(const std::string & iFileName, bool iUseMMap,
+                               FileKey & oKey);
+
+    // a reader of the file which was iKey, which isn't handed out to anyone
+    // else, for an IStreams which has to grow its reader without disturbing
+    // the others sharing the file
+    IStreamReaderPtr getPrivateReader(const std::string & iFileName,
+                                      const FileKey & iKey);
+
+    // the descriptor iReader reads through, opened again if it had been
+    // closed, which is kept open until the matching release
+    int acquire(SharedFileIStreamReader & iReader);
+    void release(SharedFileIStreamReader & iReader);
+
+    // picks up whatever has been appended to the file iReader reads, which
+    // must be a private reader
+    bool refresh(SharedFileIStreamReader & iReader);
+
+    void remove(SharedFileIStreamReader & iReader);
+
+    void setMaxOpenFiles(std::size_t iMaxOpenFiles);
+    std::size_t getMaxOpenFiles();
+    std::size_t getNumSharedFiles();
+    std::size_t getNumOpenFiles();
+
+private:
+    ReaderPool() : maxOpenFiles(0), sweepSize(64) {}
+
+    IStreamReaderPtr makeReader(const std::string & iFileName,
+                                const FileKey & iKey);
+    void markOpen(SharedFileIStreamReader & iReader);
+    void closeIdle();
+
+    Alembic::Util::mutex lock;
+
+    typedef std::map< FileKey, Alembic::Util::weak_ptr< IStreamReader > >
+        ReaderMap;
+    ReaderMap readers;
+
+    // readers with an open descriptor, the most recently read first
+    std::list< SharedFileIStreamReader * > openReaders;
+
+    std::size_t maxOpenFiles;
+
+    // how big readers gets before the readers which are gone are swept out
+    std::size_t sweepSize;
+};
+
+class SharedFileIStreamReader : public FileIStreamReader
+{
+public:
+    SharedFileIStreamReader(const std::string & iFileName,
+                            const FileKey & iKey)
+        : FileIStreamReader(iFileName, 1), fileName(iFileName), key(iKey),
+          opened(fid > -1), numReading(0), listed(false)
+    {
+    }
+
+    ~SharedFileIStreamReader()
+    {
+        ReaderPool::get().remove(*this);
+    }
+
+    bool isOpen() const
+    {
+        return opened;
+    }
+
+    bool read(std::size_t /*iThreadId*/, Alembic::Util::uint64_t iPos,
+              Alembic::Util::uint64_t iSize, void* oBuf)
+    {
+        if (fileLen < iSize && fileLen < iSize + iPos)
+        {
+            return false;
+        }
+
+        FileDescriptor readFid = ReaderPool::get().acquire(*this);
+        if (readFid < 0)
+        {
+            return false;
+        }
+
+        bool success = readFile(readFid, oBuf, iPos, iSize);
+        ReaderPool::get().release(*this);
+        return success;
+    }
+
+    void prefetch(Alembic::Util::uint64_t iPos, Alembic::Util::uint64_t iSize)
+    {
+#if defined(POSIX_FADV_WILLNEED)
+        if (iPos >= fileLen)
+        {
+            return;
+        }
+
+        FileDescriptor readFid = ReaderPool::get().acquire(*this);
+        if (readFid > -1)
+        {
+            posix_fadvise(readFid, iPos, std::min(iSize, fileLen - iPos),
+                          POSIX_FADV_WILLNEED);
+            ReaderPool::get().release(*this);
+        }
+#endif
+    }
+
+    bool refresh()
+    {
+        return ReaderPool::get().refresh(*this);
+    }
+
+    // these are only called by ReaderPool, with its lock held
+
+    // takes on iKey as long as it is still the same file, grown bigger,
+    // which is only done to private readers since fileLen isn't locked
+    bool grow(const FileKey & iKey)
+    {
+        if (iKey.device != key.device || iKey.index != key.index ||
+            iKey.size <= fileLen)
+        {
+            return false;
+        }
+
+        key = iKey;
+        fileLen = iKey.size;
+        return true;
+    }
+
+    // opens the file again, as long as it is still the same file, which
+    // may have been appended to since
+    bool openDescriptor()
+    {
+        FileDescriptor newFid = openFile(fileName.c_str(), O_RDONLY);
+        if (newFid < 0)
+        {
+            return false;
+        }
+
+        FileKey newKey;
+        if (!getFileKey(fileName, key.mapped, newKey) ||
+            newKey.device != key.device || newKey.index != key.index ||
+            newKey.size < fileLen)
+        {
+            closeFile(newFid);
+            return false;
+        }
+
+        fid = newFid;
+        return true;
+    }
+
+    void closeDescriptor()
+    {
+        closeFile(fid);
+        fid = -1;
+    }
+
+    FileDescriptor getDescriptor() const
+    {
+        return fid;
+    }
+
+    std::string fileName;
+    FileKey key;
+    bool opened;
+    std::size_t numReading;
+    bool listed;
+    std::list< SharedFileIStreamReader * >::iterator listPos;
+};
+
+// gives out a shared reader as having however many streams were asked for
+class SharedIStreamReader : public IStreamReader
+{
+public:
+    SharedIStreamReader(IStreamReaderPtr iReader, std::size_t iNumStreams,
+                        const std::string & iFileName, const FileKey & iKey)
+        : reader(iReader), nstreams(iNumStreams), fileName(iFileName),
+          key(iKey), isPrivate(false)
+    {
+    }
+
+    std::size_t numStreams() const
+    {
+        return nstreams;
+    }
+
+    bool isOpen() const
+    {
+        return reader->isOpen();
+    }
+
+    bool read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
+              Alembic::Util::uint64_t iSize, void* oBuf)
+    {
+        return reader->read(iThreadId, iPos, iSize, oBuf);
+    }
+
+    bool readv(std::size_t iThreadId, const IStreams::ReadRequest * iRequests,
+               std::size_t iNumRequests)
+    {
+        return reader->readv(iThreadId, iRequests, iNumRequests);
+    }
+
+    Alembic::Util::uint64_t size()
+    {
+        return reader->size();
+    }
+
+    const void * getMappedData(Alembic::Util::uint64_t iPos,
+                               Alembic::Util::uint64_t iSize,
+                               IStreams::MappingPtr * oMapping)
+    {
+        return reader->getMappedData(iPos, iSize, oMapping);
+    }
+
+    void prefetch(Alembic::Util::uint64_t iPos, Alembic::Util::uint64_t iSize)
+    {
+        reader->prefetch(iPos, iSize);
+    }
+
+    // the shared reader may be in the middle of reads for the other
+    // IStreams sharing it, so rather than growing it, the first refresh
+    // which finds the file grown moves this one onto a private reader
+    bool refresh()
+    {
+        if (isPrivate)
+        {
+            return reader->refresh();
+        }
+
+        FileKey newKey;
+        if (!getFileKey(fileName, key.mapped, newKey) ||
+            newKey.device != key.device || newKey.index != key.index ||
+            newKey.size <= reader->size())
+        {
+            return false;
+        }
+
+        IStreamReaderPtr newReader =
+            ReaderPool::get().getPrivateReader(fileName, newKey);
+        if (!newReader->isOpen() || newReader->size() <= reader->size())
+        {
+            return false;
+        }
+
+        // zero copy samples pointing into the shared reader's mapping hold
+        // onto it by themselves
+        reader = newReader;
+        isPrivate = true;
+        return true;
+    }
+
 private:
+    IStreamReaderPtr reader;
     std::size_t nstreams;
     std::string fileName;
-    FileHandle fileHandle;
-    MappedRegion mappedRegion;
+    FileKey key;
+    bool isPrivate;
 };
 
+IStreamReaderPtr ReaderPool::getReader(const std::string & iFileName,
+                                       bool iUseMMap, FileKey & oKey)
+{
+    if (!getFileKey(iFileName, iUseMMap, oKey))
+    {
+        // it won't open, let the reader say so
+        return IStreamReaderPtr(new FileIStreamReader(iFileName, 1));
+    }
+
+    Alembic::Util::scoped_lock l(lock);
+
+    ReaderMap::iterator it = readers.find(oKey);
+    if (it != readers.end())
+    {
+        IStreamReaderPtr reader = it->second.lock();
+        if (reader)
+        {
+            return reader;
+        }
+    }
+
+    IStreamReaderPtr reader = makeReader(iFileName, oKey);
+    if (!reader->isOpen())
+    {
+        return reader;
+    }
+
+    if (readers.size() >= sweepSize)
+    {
+        for (it = readers.begin(); it != readers.end();)
+        {
+            if (it->second.expired())
+            {
+                readers.erase(it++);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        sweepSize = std::max< std::size_t >(64, readers.size() * 2);
+    }
+
+    readers[oKey] = reader;
+    return reader;
+}
+
+IStreamReaderPtr ReaderPool::getPrivateReader(const std::string & iFileName,
+                                              const FileKey & iKey)
+{
+    // it is never put in readers, but still counts towards maxOpenFiles
+    Alembic::Util::scoped_lock l(lock);
+    return makeReader(iFileName, iKey);
+}
+
+IStreamReaderPtr ReaderPool::makeReader(const std::string & iFileName,
+                                        const FileKey & iKey)
+{
+    if (iKey.mapped)
+    {
+        return IStreamReaderPtr(new MemoryMappedIStreamReader(iFileName, 1));
+    }
+
+    SharedFileIStreamReader * fileReader =
+        new SharedFileIStreamReader(iFileName, iKey);
+    IStreamReaderPtr reader(fileReader);
+
+    if (fileReader->isOpen())
+    {
+        markOpen(*fileReader);
+        closeIdle();
+    }
+
+    return reader;
+}
+
+int ReaderPool::acquire(SharedFileIStreamReader & iReader)
+{
+    Alembic::Util::scoped_lock l(lock);
+
+    if (iReader.getDescriptor() < 0)
+    {
+        if (!iReader.openDescriptor())
+        {
+            return -1;
+        }
+    }
+
+    ++iReader.numReading;
+    markOpen(iReader);
+    closeIdle();
+    return iReader.getDescriptor();
+}
+
+void ReaderPool::release(SharedFileIStreamReader & iReader)
+{
+    Alembic::Util::scoped_lock l(lock);
+    --iReader.numReading;
+    closeIdle();
+}
+
+bool ReaderPool::refresh(SharedFileIStreamReader & iReader)
+{
+    Alembic::Util::scoped_lock l(lock);
+
+    // private readers aren't in readers, so there is no key to update
+    FileKey key;
+    return getFileKey(iReader.fileName, iReader.key.mapped, key) &&
+        iReader.grow(key);
+}
+
+void ReaderPool::remove(SharedFileIStreamReader & iReader)
+{
+    Alembic::Util::scoped_lock l(lock);
+    if (iReader.listed)
+    {
+        openReaders.erase(iReader.listPos);
+        iReader.listed = false;
+    }
+}
+
+void ReaderPool::markOpen(SharedFileIStreamReader & iReader)
+{
+    if (iReader.listed)
+    {
+        openReaders.splice(openReaders.begin(), openReaders, iReader.listPos);
+    }
+    else
+    {
+        openReaders.push_front(&iReader);
+        iReader.listed = true;
+    }
+    iReader.listPos = openReaders.begin();
+}
+
+void ReaderPool::closeIdle()
+{
+    if (maxOpenFiles == 0)
+    {
+        return;
+    }
+
+    // readers which are in the middle of a read are skipped, so this can
+    // stay over the limit until they are done
+    std::list< SharedFileIStreamReader * >::iterator it = openReaders.end();
+    while (openReaders.size() > maxOpenFiles && it != openReaders.begin())
+    {
+        --it;
+        SharedFileIStreamReader * reader = *it;
+        if (reader->numReading == 0)
+        {
+            reader->closeDescriptor();
+            reader->listed = false;
+            it = openReaders.erase(it);
+        }
+    }
+}
+
+void ReaderPool::setMaxOpenFiles(std::size_t iMaxOpenFiles)
+{
+    Alembic::Util::scoped_lock l(lock);
+    maxOpenFiles = iMaxOpenFiles;
+    closeIdle();
+}
+
+std::size_t ReaderPool::getMaxOpenFiles()
+{
+    Alembic::Util::scoped_lock l(lock);
+    return maxOpenFiles;
+}
+
+std::size_t ReaderPool::getNumSharedFiles()
+{
+    Alembic::Util::scoped_lock l(lock);
+    std::size_t numShared = 0;
+    for (ReaderMap::iterator it = readers.begin(); it != readers.end(); ++it)
+    {
+        if (!it->second.expired())
+        {
+            ++numShared;
+        }
+    }
+    return numShared;
+}
+
+std::size_t ReaderPool::getNumOpenFiles()
+{
+    Alembic::Util::scoped_lock l(lock);
+    return openReaders.size();
+}
+
 
 IStreamReaderPtr constructStreamReader(
     const std::string & iFileName,
     std::size_t iNumStreams,
-    bool iUseMMap)
+    bool iUseMMap,
+    bool iShareFiles)
 {
+    if (iShareFiles)
+    {
+        FileKey key = FileKey();
+        IStreamReaderPtr reader =
+            ReaderPool::get().getReader(iFileName, iUseMMap, key);
+        return IStreamReaderPtr(new SharedIStreamReader(reader, iNumStreams,
+                                                        iFileName, key));
+    }
+
     // if allowed by the options, use memory mapped file access
     if (iUseMMap)
     {
@@ -617,8 +1444,11 @@ public:
     {
         valid = false;
         frozen = false;
+        topGroupPos = 0;
         version = 0;
         size = 0;
+        numCounters = 0;
+        collect = false;
     }
 
     void init(IStreamReaderPtr iReader, size_t iNumStreams)
@@ -683,24 +1513,77 @@ public:
         {
             reader = iReader;        // preserve the reader
             valid = true;
+            topGroupPos = firstGroupPos;
+
+            numCounters = reader->numStreams();
+            counters.reset(new Counters[numCounters]);
+            resetCounters();
+        }
+    }
+
+    struct Counters
+    {
+        std::atomic< Alembic::Util::uint64_t > numReads;
+        std::atomic< Alembic::Util::uint64_t > numBytes;
+        std::atomic< Alembic::Util::uint64_t > nanoseconds;
+    };
+
+    // the counters to add a read on iThreadId to, NULL when not collecting
+    Counters * getCounters(std::size_t iThreadId)
+    {
+        if (!collect.load(std::memory_order_relaxed) || numCounters == 0)
+        {
+            return NULL;
+        }
+
+        // the memory mapped reader doesn't care about the thread id
+        return &counters[std::min(iThreadId, numCounters - 1)];
+    }
+
+    static void count(Counters * iCounters,
+                      Alembic::Util::uint64_t iNumReads,
+                      Alembic::Util::uint64_t iNumBytes,
+                      std::chrono::steady_clock::time_point iStart)
+    {
+        Alembic::Util::uint64_t elapsed =
+            std::chrono::duration_cast< std::chrono::nanoseconds >(
+                std::chrono::steady_clock::now() - iStart).count();
+
+        iCounters->numReads.fetch_add(iNumReads, std::memory_order_relaxed);
+        iCounters->numBytes.fetch_add(iNumBytes, std::memory_order_relaxed);
+        iCounters->nanoseconds.fetch_add(elapsed, std::memory_order_relaxed);
+    }
+
+    void resetCounters()
+    {
+        for (std::size_t i = 0; i < numCounters; ++i)
+        {
+            counters[i].numReads.store(0, std::memory_order_relaxed);
+            counters[i].numBytes.store(0, std::memory_order_relaxed);
+            counters[i].nanoseconds.store(0, std::memory_order_relaxed);
         }
     }
 
 
     bool valid;
     bool frozen;
+    Alembic::Util::uint64_t topGroupPos;
     Alembic::Util::uint16_t version;
     Alembic::Util::uint64_t size;
 
     IStreamReaderPtr reader;
+
+    Alembic::Util::unique_ptr< Counters[] > counters;
+    std::size_t numCounters;
+    std::atomic< bool > collect;
 };
 
 IStreams::IStreams(const std::string & iFileName, std::size_t iNumStreams,
-                   bool iUseMMap) :
+                   bool iUseMMap, bool iShareFiles) :
     mData(new IStreams::PrivateData())
 {
     IStreamReaderPtr reader = constructStreamReader(iFileName, iNumStreams,
-                                                    iUseMMap);
+                                                    iUseMMap, iShareFiles);
     mData->init(reader, 1);
 }
 
@@ -725,6 +1608,43 @@ bool IStreams::isFrozen()
     return mData->frozen;
 }
 
+bool IStreams::isCheckpoint()
+{
+    // nothing points at the top group until it is frozen or checkpointed
+    return mData->valid && !mData->frozen && mData->topGroupPos != 0;
+}
+
+bool IStreams::refresh()
+{
+    // nothing changes once the file has been closed
+    if (!isValid() || mData->frozen)
+    {
+        return false;
+    }
+
+    mData->reader->refresh();
+
+    char header[16];
+    if (!mData->reader->read(0, 0, 16, static_cast<void*>(header)))
+    {
+        return false;
+    }
+
+    bool filefrozen = (header[5] == char(0xff));
+    Alembic::Util::uint64_t groupPos =
+        *((Alembic::Util::uint64_t*) (&(header[8])));
+    mData->size = mData->reader->size();
+
+    if (groupPos == mData->topGroupPos && filefrozen == mData->frozen)
+    {
+        return false;
+    }
+
+    mData->topGroupPos = groupPos;
+    mData->frozen = filefrozen;
+    return true;
+}
+
 Alembic::Util::uint16_t IStreams::getVersion()
 {
     return mData->version;
@@ -743,12 +1663,136 @@ void IStreams::read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
         return;
     }
 
+    PrivateData::Counters * counters = mData->getCounters(iThreadId);
+    std::chrono::steady_clock::time_point start;
+    if (counters)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+
     bool success = mData->reader->read(iThreadId, iPos, iSize, oBuf);
     if (!success)
     {
         throw std::runtime_error(
             "Ogawa IStreams::read failed.");
     }
+
+    if (counters)
+    {
+        PrivateData::count(counters, 1, iSize, start);
+    }
+}
+
+void IStreams::readv(std::size_t iThreadId, const ReadRequest * iRequests,
+                     std::size_t iNumRequests)
+{
+    if (!isValid() || iNumRequests == 0)
+    {
+        return;
+    }
+
+    PrivateData::Counters * counters = mData->getCounters(iThreadId);
+    std::chrono::steady_clock::time_point start;
+    if (counters)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+
+    bool success = mData->reader->readv(iThreadId, iRequests, iNumRequests);
+    if (!success)
+    {
+        throw std::runtime_error(
+            "Ogawa IStreams::readv failed.");
+    }
+
+    if (counters)
+    {
+        Alembic::Util::uint64_t numBytes = 0;
+        for (std::size_t i = 0; i < iNumRequests; ++i)
+        {
+            numBytes += iRequests[i].size;
+        }
+        PrivateData::count(counters, iNumRequests, numBytes, start);
+    }
+}
+
+void IStreams::prefetch(Alembic::Util::uint64_t iPos,
+                        Alembic::Util::uint64_t iSize)
+{
+    if (isValid())
+    {
+        mData->reader->prefetch(iPos, iSize);
+    }
+}
+
+const void * IStreams::getMappedData(Alembic::Util::uint64_t iPos,
+                                     Alembic::Util::uint64_t iSize,
+                                     MappingPtr * oMapping)
+{
+    if (!isValid())
+    {
+        return NULL;
+    }
+
+    return mData->reader->getMappedData(iPos, iSize, oMapping);
+}
+
+void IStreams::setCollectStatistics(bool iCollect)
+{
+    mData->collect.store(iCollect, std::memory_order_relaxed);
+}
+
+bool IStreams::getCollectStatistics()
+{
+    return mData->collect.load(std::memory_order_relaxed);
+}
+
+std::size_t IStreams::getNumStreams()
+{
+    return mData->numCounters;
+}
+
+void IStreams::getStatistics(std::size_t iStream,
+                             Alembic::Util::uint64_t & oNumReads,
+                             Alembic::Util::uint64_t & oNumBytes,
+                             Alembic::Util::uint64_t & oNanoseconds)
+{
+    oNumReads = 0;
+    oNumBytes = 0;
+    oNanoseconds = 0;
+
+    if (iStream < mData->numCounters)
+    {
+        PrivateData::Counters & counters = mData->counters[iStream];
+        oNumReads = counters.numReads.load(std::memory_order_relaxed);
+        oNumBytes = counters.numBytes.load(std::memory_order_relaxed);
+        oNanoseconds = counters.nanoseconds.load(std::memory_order_relaxed);
+    }
+}
+
+void IStreams::resetStatistics()
+{
+    mData->resetCounters();
+}
+
+void IStreams::setMaxOpenFiles(std::size_t iMaxOpenFiles)
+{
+    ReaderPool::get().setMaxOpenFiles(iMaxOpenFiles);
+}
+
+std::size_t IStreams::getMaxOpenFiles()
+{
+    return ReaderPool::get().getMaxOpenFiles();
+}
+
+std::size_t IStreams::getNumSharedFiles()
+{
+    return ReaderPool::get().getNumSharedFiles();
+}
+
+std::size_t IStreams::getNumOpenFiles()
+{
+    return ReaderPool::get().getNumOpenFiles();
 }
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -48,14 +48,33 @@ namespace ALEMBIC_VERSION_NS {
 class ALEMBIC_EXPORT IStreams
 {
 public:
+    // When iShareFiles is true the file is read through the same reader as
+    // every other IStreams sharing it, by the device and inode of the file
+    // rather than by its name, so a file is opened or memory mapped only
+    // once however many times it is opened this way.
     IStreams(const std::string & iFileName,
              std::size_t iNumStreams=1,
-             bool iUseMMap=true);
+             bool iUseMMap=true,
+             bool iShareFiles=false);
     IStreams(const std::vector< std::istream * > & iStreams);
     ~IStreams();
 
     bool isValid();
     bool isFrozen();
+
+    // Whether the stream wasn't cleanly closed, but a checkpoint was written
+    // before it was cut short, see OArchive::checkpoint.  The top group is
+    // then the one given to the last checkpoint.
+    bool isCheckpoint();
+
+    // For a stream which wasn't closed when it was opened, picks up what
+    // has been written to it since.  Returns whether the top group has
+    // moved, because of a new checkpoint or the stream having been closed.
+    // It mustn't be called while reading on other threads.  A shared file
+    // which has grown is from then on read through a reader of its own, so
+    // the others sharing it can keep reading while this is called.
+    bool refresh();
+
     Alembic::Util::uint16_t getVersion();
 
     Alembic::Util::uint64_t getSize();
@@ -64,6 +83,66 @@ public:
     void read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
               Alembic::Util::uint64_t iSize, void * oBuf);
 
+    struct ReadRequest
+    {
+        Alembic::Util::uint64_t pos;
+        Alembic::Util::uint64_t size;
+        void * buf;
+    };
+
+    // does all of the reads at once, reads which are next to or close to
+    // each other in the file are merged into one bigger read so we don't
+    // pay for a round trip to the file system for each of them
+    void readv(std::size_t iThreadId, const ReadRequest * iRequests,
+               std::size_t iNumRequests);
+
+    // a hint that iSize bytes at iPos will be read soon, so the OS can
+    // start reading them in the background.  It doesn't wait for them.
+    void prefetch(Alembic::Util::uint64_t iPos, Alembic::Util::uint64_t iSize);
+
+    // keeps a memory mapping around, see getMappedData
+    typedef Alembic::Util::shared_ptr< void > MappingPtr;
+
+    // returns a pointer directly into the file contents for iSize bytes
+    // starting at iPos, or NULL if the streams aren't memory mapped or the
+    // range is out of bounds.  The pointer is valid until this IStreams is
+    // refreshed or goes away, or for as long as oMapping is held onto when
+    // it is given, since a refresh maps the file again and the old mapping
+    // is let go of once nothing holds onto it.
+    const void * getMappedData(Alembic::Util::uint64_t iPos,
+                               Alembic::Util::uint64_t iSize,
+                               MappingPtr * oMapping = NULL);
+
+    // Reads aren't counted until this is turned on, after which each read
+    // costs a few relaxed atomic adds and two clock reads.
+    void setCollectStatistics(bool iCollect);
+    bool getCollectStatistics();
+
+    std::size_t getNumStreams();
+
+    // the reads done through stream iStream since statistics were turned on
+    // or reset, batched reads count each request.  Time is in nanoseconds.
+    void getStatistics(std::size_t iStream,
+                       Alembic::Util::uint64_t & oNumReads,
+                       Alembic::Util::uint64_t & oNumBytes,
+                       Alembic::Util::uint64_t & oNanoseconds);
+
+    void resetStatistics();
+
+    // The most descriptors the shared file stream readers keep open at
+    // once, across the whole process.  Past it, the least recently read
+    // ones are closed and opened again when they are next read, and if the
+    // file has been replaced in the meantime those reads fail, while one
+    // which has only been appended to is read as before.  Memory mapped
+    // files don't keep a descriptor open.  0, the default, is no limit.
+    static void setMaxOpenFiles(std::size_t iMaxOpenFiles);
+    static std::size_t getMaxOpenFiles();
+
+    // how many files are currently shared, and how many of those are
+    // holding a descriptor open
+    static std::size_t getNumSharedFiles();
+    static std::size_t getNumOpenFiles();
+
 private:
     // noncopyable
     IStreams(const IStreams &);
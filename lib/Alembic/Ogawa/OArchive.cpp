@@ -41,14 +41,17 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
-OArchive::OArchive(const std::string & iFileName) :
-    mStream(new OStream(iFileName))
+OArchive::OArchive(const std::string & iFileName, std::size_t iBufferSize,
+                   std::size_t iMaxQueued) :
+    mStream(new OStream(iFileName, iBufferSize, iMaxQueued))
 {
     mGroup.reset(new OGroup(mStream));
 }
 
-OArchive::OArchive(std::ostream * iStream) :
-    mStream(new OStream(iStream)), mGroup(new OGroup(mStream))
+OArchive::OArchive(std::ostream * iStream, std::size_t iBufferSize,
+                   std::size_t iMaxQueued) :
+    mStream(new OStream(iStream, iBufferSize, iMaxQueued)),
+    mGroup(new OGroup(mStream))
 {
 }
 
@@ -61,6 +64,26 @@ bool OArchive::isValid()
     return mStream->isValid();
 }
 
+void OArchive::checkpoint(OGroupPtr iGroup)
+{
+    if (!isValid() || !iGroup || !iGroup->isFrozen())
+    {
+        return;
+    }
+
+    // the group has to be all there before anything points at it
+    mStream->flush();
+
+    Alembic::Util::uint64_t pos = iGroup->getPos();
+    mStream->writeAt(8, &pos, 8);
+    mStream->flush();
+}
+
+Alembic::Util::uint64_t OArchive::getSize()
+{
+    return mStream->getSize();
+}
+
 OGroupPtr OArchive::getGroup()
 {
     return mGroup;
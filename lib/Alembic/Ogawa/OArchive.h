@@ -48,14 +48,28 @@ namespace ALEMBIC_VERSION_NS {
 class ALEMBIC_EXPORT OArchive
 {
 public:
-    OArchive(const std::string & iFileName);
-    OArchive(std::ostream * iStream);
+    // see OStream for iBufferSize and iMaxQueued
+    OArchive(const std::string & iFileName, std::size_t iBufferSize=0,
+             std::size_t iMaxQueued=0);
+    OArchive(std::ostream * iStream, std::size_t iBufferSize=0,
+             std::size_t iMaxQueued=0);
     ~OArchive();
 
     OGroupPtr getGroup();
 
     bool isValid();
 
+    // Makes the header of the stream point at iGroup, which has to be
+    // frozen, instead of at getGroup.  Everything written so far is flushed
+    // first, so if writing is cut short before the archive is closed, the
+    // stream can still be read with iGroup as its top group, see
+    // IStreams::isCheckpoint.  Closing the archive points the header back
+    // at getGroup.
+    void checkpoint(OGroupPtr iGroup);
+
+    // how many bytes have been written so far
+    Alembic::Util::uint64_t getSize();
+
 private:
     OStreamPtr mStream;
     OGroupPtr mGroup;
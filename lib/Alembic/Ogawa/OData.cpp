@@ -93,8 +93,7 @@ void OData::rewrite(Alembic::Util::uint64_t iSize, void * iData,
     }
 
     // +8 is to account for the written out size
-    mData->stream->seek(mData->pos + iOffset + 8);
-    mData->stream->write(iData, iSize);
+    mData->stream->writeAt(mData->pos + iOffset + 8, iData, iSize);
 }
 
 Alembic::Util::uint64_t OData::getSize() const
@@ -62,13 +62,15 @@ public:
 
     Alembic::Util::uint64_t getSize() const;
 
+    // where the data was written within the stream, it can be referenced
+    // again by this via OGroup::addDataAt without holding onto the OData
+    Alembic::Util::uint64_t getPos() const;
+
 private:
     friend class OGroup; // friend so we can call the constructor below
     OData(OStreamPtr iStream, Alembic::Util::uint64_t iPos,
           Alembic::Util::uint64_t iSize);
 
-    Alembic::Util::uint64_t getPos() const;
-
     class PrivateData;
     Alembic::Util::unique_ptr< PrivateData > mData;
 };
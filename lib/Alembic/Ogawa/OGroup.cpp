@@ -53,6 +53,11 @@ public:
 
     OStreamPtr stream;
 
+    // Shared by every group written to the stream.  Freezing a group
+    // updates its parents, so groups of different objects and properties
+    // can be written from different threads at once.
+    Alembic::Util::shared_ptr< Alembic::Util::mutex > lock;
+
     // used before freeze
     ParentPairVec parents;
 
@@ -61,12 +66,31 @@ public:
 
     // set after freeze
     Alembic::Util::uint64_t pos;
+
+    // expects the lock to be held
+    bool isFrozen() const
+    {
+        return pos != INVALID_GROUP;
+    }
+
+    // adds a child if we aren't frozen yet, expects the lock to be held
+    bool addChild(Alembic::Util::uint64_t iChild)
+    {
+        if (isFrozen())
+        {
+            return false;
+        }
+
+        childVec.push_back(iChild);
+        return true;
+    }
 };
 
 OGroup::OGroup(OGroupPtr iParent, Alembic::Util::uint64_t iIndex)
     : mData(new OGroup::PrivateData())
 {
     mData->stream = iParent->mData->stream;
+    mData->lock = iParent->mData->lock;
     mData->parents.push_back( ParentPair(iParent, iIndex) );
     mData->pos = INVALID_GROUP;
 }
@@ -75,10 +99,17 @@ OGroup::OGroup(OStreamPtr iStream)
     : mData(new OGroup::PrivateData())
 {
     mData->stream = iStream;
+    mData->lock.reset(new Alembic::Util::mutex());
     mData->parents.push_back(ParentPair(OGroupPtr(), 0));
     mData->pos = INVALID_GROUP;
 }
 
+OGroup::OGroup()
+    : mData(new OGroup::PrivateData())
+{
+    mData->pos = INVALID_GROUP;
+}
+
 OGroup::~OGroup()
 {
     freeze();
@@ -87,11 +118,17 @@ OGroup::~OGroup()
 OGroupPtr OGroup::addGroup()
 {
     OGroupPtr child;
-    if (!isFrozen())
+    Alembic::Util::uint64_t index = 0;
     {
-        mData->childVec.push_back(0);
-        child.reset(new OGroup(shared_from_this(), mData->childVec.size() - 1));
+        Alembic::Util::scoped_lock l(*mData->lock);
+        if (!mData->addChild(0))
+        {
+            return child;
+        }
+        index = mData->childVec.size() - 1;
     }
+
+    child.reset(new OGroup(shared_from_this(), index));
     return child;
 }
 
@@ -105,16 +142,15 @@ ODataPtr OGroup::createData(Alembic::Util::uint64_t iSize, const void * iData)
 
     if (iSize == 0)
     {
-        mData->childVec.push_back(EMPTY_DATA);
+        addEmptyData();
         child.reset(new OData());
         return child;
     }
 
-    Alembic::Util::uint64_t pos = mData->stream->getAndSeekEndPos();
-
     Alembic::Util::uint64_t size = iSize;
-    mData->stream->write(&size, 8);
-    mData->stream->write(iData, iSize);
+    const void * datas[2] = { &size, iData };
+    Alembic::Util::uint64_t sizes[2] = { 8, iSize };
+    Alembic::Util::uint64_t pos = mData->stream->append(2, sizes, datas);
 
     child.reset(new OData(mData->stream, pos, iSize));
 
@@ -126,16 +162,15 @@ ODataPtr OGroup::addData(Alembic::Util::uint64_t iSize, const void * iData)
     ODataPtr child = OGroup::createData(iSize, iData);
     if (child)
     {
-        // flip top bit for data so we can easily distinguish between it and
-        // a group
-        mData->childVec.push_back(child->getPos() | 0x8000000000000000ULL);
+        addData(child);
     }
     return child;
 }
 
 ODataPtr OGroup::createData(Alembic::Util::uint64_t iNumData,
                             const Alembic::Util::uint64_t * iSizes,
-                            const void ** iDatas)
+                            const void ** iDatas,
+                            bool iCompressed)
 {
     ODataPtr child;
     if (isFrozen())
@@ -151,23 +186,31 @@ ODataPtr OGroup::createData(Alembic::Util::uint64_t iNumData,
 
     if (totalSize == 0)
     {
-        mData->childVec.push_back(EMPTY_DATA);
+        addEmptyData();
         child.reset(new OData());
         return child;
     }
 
-    Alembic::Util::uint64_t pos = mData->stream->getAndSeekEndPos();
+    Alembic::Util::uint64_t writtenSize = totalSize;
+    if (iCompressed)
+    {
+        writtenSize |= COMPRESSED_DATA_FLAG;
+    }
 
-    mData->stream->write(&totalSize, 8);
+    // the size goes first, followed by each of the sources
+    std::vector< const void * > datas(iNumData + 1);
+    std::vector< Alembic::Util::uint64_t > sizes(iNumData + 1);
+    datas[0] = &writtenSize;
+    sizes[0] = 8;
     for (Alembic::Util::uint64_t i = 0; i < iNumData; ++i)
     {
-        Alembic::Util::uint64_t size = iSizes[i];
-        if (size != 0)
-        {
-            mData->stream->write(iDatas[i], size);
-        }
+        datas[i + 1] = iDatas[i];
+        sizes[i + 1] = iSizes[i];
     }
 
+    Alembic::Util::uint64_t pos = mData->stream->append(iNumData + 1,
+        &sizes.front(), &datas.front());
+
     child.reset(new OData(mData->stream, pos, totalSize));
 
     return child;
@@ -175,31 +218,36 @@ ODataPtr OGroup::createData(Alembic::Util::uint64_t iNumData,
 
 ODataPtr OGroup::addData(Alembic::Util::uint64_t iNumData,
                          const Alembic::Util::uint64_t * iSizes,
-                         const void ** iDatas)
+                         const void ** iDatas,
+                         bool iCompressed)
 {
-    ODataPtr child = createData(iNumData, iSizes, iDatas);
+    ODataPtr child = createData(iNumData, iSizes, iDatas, iCompressed);
     if (child)
     {
-        // flip top bit for data so we can easily distinguish between it and
-        // a group
-        mData->childVec.push_back(child->getPos() | 0x8000000000000000ULL);
+        addData(child);
     }
     return child;
 }
 
 void OGroup::addData(ODataPtr iData)
 {
-    if (!isFrozen())
-    {
-        mData->childVec.push_back(iData->getPos() | 0x8000000000000000ULL);
-    }
+    addDataAt(iData->getPos());
+}
+
+void OGroup::addDataAt(Alembic::Util::uint64_t iPos)
+{
+    // flip top bit for data so we can easily distinguish between it and
+    // a group
+    Alembic::Util::scoped_lock l(*mData->lock);
+    mData->addChild(iPos | 0x8000000000000000ULL);
 }
 
 void OGroup::addGroup(OGroupPtr iGroup)
 {
-    if (!isFrozen())
+    Alembic::Util::scoped_lock l(*mData->lock);
+    if (!mData->isFrozen())
     {
-        if (iGroup->isFrozen())
+        if (iGroup->mData->isFrozen())
         {
             mData->childVec.push_back(iGroup->mData->pos);
         }
@@ -214,25 +262,26 @@ void OGroup::addGroup(OGroupPtr iGroup)
 
 void OGroup::addEmptyGroup()
 {
-    if (!isFrozen())
-    {
-        mData->childVec.push_back(EMPTY_GROUP);
-    }
+    Alembic::Util::scoped_lock l(*mData->lock);
+    mData->addChild(EMPTY_GROUP);
 }
 
 void OGroup::addEmptyData()
 {
-    if (!isFrozen())
-    {
-        mData->childVec.push_back(EMPTY_DATA);
-    }
+    Alembic::Util::scoped_lock l(*mData->lock);
+    mData->addChild(EMPTY_DATA);
 }
 
 // no more children can be added, commit to the stream
 void OGroup::freeze()
 {
+    // let go of the parents after unlocking, since that may freeze them
+    ParentPairVec parents;
+
+    Alembic::Util::scoped_lock l(*mData->lock);
+
     // bail if we've already done this work
-    if (isFrozen())
+    if (mData->isFrozen())
     {
         return;
     }
@@ -245,85 +294,124 @@ void OGroup::freeze()
     }
     else
     {
-        mData->pos = mData->stream->getAndSeekEndPos();
         Alembic::Util::uint64_t size = mData->childVec.size();
-        mData->stream->write(&size, 8);
-        mData->stream->write(&mData->childVec.front(), size*8);
+        const void * datas[2] = { &size, &mData->childVec.front() };
+        Alembic::Util::uint64_t sizes[2] = { 8, size * 8 };
+        mData->pos = mData->stream->append(2, sizes, datas);
     }
 
     // go through and update each of the parents
+    parents.swap(mData->parents);
     ParentPairVec::iterator it;
-    for(it = mData->parents.begin(); it != mData->parents.end(); ++it)
+    for(it = parents.begin(); it != parents.end(); ++it)
     {
         // special group owned by the archive
         if (!it->first && it->second == 0)
         {
-            mData->stream->seek(8);
-            mData->stream->write(&mData->pos, 8);
+            mData->stream->writeAt(8, &mData->pos, 8);
             continue;
         }
-        else if (it->first->isFrozen())
+        else if (it->first->mData->isFrozen())
         {
-            mData->stream->seek(it->first->mData->pos + (it->second + 1) * 8);
-            mData->stream->write(&mData->pos, 8);
+            Alembic::Util::uint64_t childPos =
+                it->first->mData->pos + (it->second + 1) * 8;
+            mData->stream->writeAt(childPos, &mData->pos, 8);
         }
         it->first->mData->childVec[it->second] = mData->pos;
     }
-
-    mData->parents.clear();
-
 }
 
 bool OGroup::isFrozen()
 {
-    return mData->pos != INVALID_GROUP;
+    Alembic::Util::scoped_lock l(*mData->lock);
+    return mData->isFrozen();
+}
+
+Alembic::Util::uint64_t OGroup::getPos() const
+{
+    Alembic::Util::scoped_lock l(*mData->lock);
+    return mData->pos;
 }
 
 Alembic::Util::uint64_t OGroup::getNumChildren() const
 {
+    Alembic::Util::scoped_lock l(*mData->lock);
     return mData->childVec.size();
 }
 
 bool OGroup::isChildGroup(Alembic::Util::uint64_t iIndex) const
 {
+    Alembic::Util::scoped_lock l(*mData->lock);
     return (iIndex < mData->childVec.size() &&
             (mData->childVec[iIndex] & EMPTY_DATA) == 0);
 }
 
 bool OGroup::isChildData(Alembic::Util::uint64_t iIndex) const
 {
+    Alembic::Util::scoped_lock l(*mData->lock);
     return (iIndex < mData->childVec.size() &&
             (mData->childVec[iIndex] & EMPTY_DATA) != 0);
 }
 
 bool OGroup::isChildEmptyGroup(Alembic::Util::uint64_t iIndex) const
 {
+    Alembic::Util::scoped_lock l(*mData->lock);
     return (iIndex < mData->childVec.size() &&
             mData->childVec[iIndex] == EMPTY_GROUP);
 }
 
 bool OGroup::isChildEmptyData(Alembic::Util::uint64_t iIndex) const
 {
+    Alembic::Util::scoped_lock l(*mData->lock);
     return (iIndex < mData->childVec.size() &&
         mData->childVec[iIndex] == EMPTY_DATA);
 }
 
 void OGroup::replaceData(Alembic::Util::uint64_t iIndex, ODataPtr iData)
 {
-    if (!isChildData(iIndex))
+    Alembic::Util::scoped_lock l(*mData->lock);
+    if (iIndex >= mData->childVec.size() ||
+        (mData->childVec[iIndex] & EMPTY_DATA) == 0)
     {
         return;
     }
 
     Alembic::Util::uint64_t pos = iData->getPos() | 0x8000000000000000ULL;
-    if (isFrozen())
+    if (mData->isFrozen())
     {
-        mData->stream->seek(mData->pos + (iIndex + 1) * 8);
-        mData->stream->write(&pos, 8);
+        mData->stream->writeAt(mData->pos + (iIndex + 1) * 8, &pos, 8);
     }
     mData->childVec[iIndex] = pos;
 }
 
+void OGroup::replaceGroup(Alembic::Util::uint64_t iIndex, OGroupPtr iGroup)
+{
+    Alembic::Util::scoped_lock l(*mData->lock);
+    if (!iGroup->mData->isFrozen() || iIndex >= mData->childVec.size() ||
+        (mData->childVec[iIndex] & EMPTY_DATA) != 0)
+    {
+        return;
+    }
+
+    Alembic::Util::uint64_t pos = iGroup->mData->pos;
+    if (mData->isFrozen())
+    {
+        mData->stream->writeAt(mData->pos + (iIndex + 1) * 8, &pos, 8);
+    }
+    mData->childVec[iIndex] = pos;
+}
+
+OGroupPtr OGroup::snapshot()
+{
+    OGroupPtr group(new OGroup());
+    group->mData->stream = mData->stream;
+    group->mData->lock = mData->lock;
+
+    Alembic::Util::scoped_lock l(*mData->lock);
+    group->mData->childVec = mData->childVec;
+    return group;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
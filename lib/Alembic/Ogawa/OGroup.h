@@ -48,6 +48,9 @@ namespace ALEMBIC_VERSION_NS {
 class OGroup;
 typedef Alembic::Util::shared_ptr< OGroup > OGroupPtr;
 
+// Different groups of the same archive, and the data added to them, can be
+// written from different threads at once, as long as each group is only
+// added to from one thread at a time.
 class ALEMBIC_EXPORT OGroup
     : public Alembic::Util::enable_shared_from_this< OGroup >
 {
@@ -62,9 +65,12 @@ public:
 
     // write data streams from multiple sources as one continuous data stream
     // and add it as a child to this group
+    // iCompressed flags the data as having been compressed by the caller,
+    // see IData::isCompressed
     ODataPtr addData(Alembic::Util::uint64_t iNumData,
                      const Alembic::Util::uint64_t * iSizes,
-                     const void ** iDatas);
+                     const void ** iDatas,
+                     bool iCompressed=false);
 
     // write a data stream but DON'T add it as a child to this group
     // If ODataPtr isn't added to this or any other group, you will
@@ -77,11 +83,15 @@ public:
     // end up abandoning it within the file and waste disk space.
     ODataPtr createData(Alembic::Util::uint64_t iNumData,
                         const Alembic::Util::uint64_t * iSizes,
-                        const void ** iDatas);
+                        const void ** iDatas,
+                        bool iCompressed=false);
 
     // reference existing data
     void addData(ODataPtr iData);
 
+    // reference existing data by where it was written, see OData::getPos
+    void addDataAt(Alembic::Util::uint64_t iPos);
+
     // reference an existing group
     void addGroup(OGroupPtr iGroup);
 
@@ -97,6 +107,10 @@ public:
 
     bool isFrozen();
 
+    // where the group was written within the stream, only valid once frozen,
+    // see IArchive::getGroup
+    Alembic::Util::uint64_t getPos() const;
+
     Alembic::Util::uint64_t getNumChildren() const;
 
     bool isChildGroup(Alembic::Util::uint64_t iIndex) const;
@@ -109,19 +123,26 @@ public:
 
     void replaceData(Alembic::Util::uint64_t iIndex, ODataPtr iData);
 
-    // currently I'm going to leave this out, because a bad implementation
-    // could cause all sorts of subtle race conditions when unfrozen children
-    // are suddenly frozen.  It may also not be necessary (you can still
-    // reference an existing group)
-    // if this is necessary, an easy compromise might be that iGroup HAS to
-    // be frozen, much like how replaceData deals with something implicitly
-    // frozen
-    //void replaceGroup(Alembic::Util::uint64_t iIndex, OGroupPtr iGroup);
+    // To avoid the subtle race conditions of unfrozen children suddenly
+    // being frozen, iGroup HAS to be frozen, much like how replaceData deals
+    // with something implicitly frozen.  A child group at iIndex which isn't
+    // frozen yet will still put itself back there once it is frozen.
+    void replaceGroup(Alembic::Util::uint64_t iIndex, OGroupPtr iGroup);
+
+    // Creates a group with the children this group has so far, but which
+    // isn't a child of any group.  Children which are groups which aren't
+    // frozen yet are empty groups until replaced via replaceGroup.  More
+    // children can be added to it, then freezing it writes it without
+    // changing this group, see OArchive::checkpoint.
+    OGroupPtr snapshot();
 
 private:
     friend class OArchive;
     OGroup(OStreamPtr iStream);
 
+    // the group made by snapshot
+    OGroup();
+
     OGroup(OGroupPtr iParent, Alembic::Util::uint64_t iIndex);
 
     class PrivateData;
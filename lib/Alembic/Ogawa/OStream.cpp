@@ -34,8 +34,16 @@
 //-*****************************************************************************
 
 #include <Alembic/Ogawa/OStream.h>
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
 #include <fstream>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 namespace Alembic {
 namespace Ogawa {
@@ -44,9 +52,14 @@ namespace ALEMBIC_VERSION_NS {
 class OStream::PrivateData
 {
 public:
-    PrivateData(const std::string & iFileName) :
-        stream(NULL), fileName(iFileName), startPos(0), curPos(0), maxPos(0)
+    PrivateData(const std::string & iFileName, std::size_t iBufferSize,
+                std::size_t iMaxQueued) :
+        stream(NULL), fileName(iFileName), startPos(0), curPos(0), maxPos(0),
+        pendingPos(0), pendingUsed(0), maxQueued(iMaxQueued), queued(0),
+        stopWriter(false)
     {
+        initPending(iBufferSize);
+
         std::ofstream * filestream = new std::ofstream(fileName.c_str(),
             std::ios_base::trunc | std::ios_base::binary);
         if (filestream->is_open())
@@ -65,9 +78,14 @@ public:
         }
     }
 
-    PrivateData(std::ostream * iStream) :
-        stream(iStream), startPos(0), curPos(0), maxPos(0)
+    PrivateData(std::ostream * iStream, std::size_t iBufferSize,
+                std::size_t iMaxQueued) :
+        stream(iStream), startPos(0), curPos(0), maxPos(0),
+        pendingPos(0), pendingUsed(0), maxQueued(iMaxQueued), queued(0),
+        stopWriter(false)
     {
+        initPending(iBufferSize);
+
         if (stream)
         {
             stream->exceptions ( std::ostream::failbit |
@@ -83,6 +101,8 @@ public:
 
     ~PrivateData()
     {
+        stopWriting();
+
         // if this was done via file, try to clean it up
         if (!fileName.empty() && stream)
         {
@@ -104,16 +124,271 @@ public:
     Alembic::Util::uint64_t curPos;
     Alembic::Util::uint64_t maxPos;
     Alembic::Util::mutex lock;
+
+    // the write combining buffer holds pendingUsed contiguous bytes which
+    // belong at pendingPos, it is empty when we aren't buffering
+    std::vector< char > pending;
+    Alembic::Util::uint64_t pendingPos;
+    Alembic::Util::uint64_t pendingUsed;
+
+    // When writing asynchronously, full buffers are queued up in order and
+    // written out by the writer thread.  No more than maxQueued bytes can
+    // wait in the queue before the writing thread has to wait for room.
+    struct Block
+    {
+        Alembic::Util::uint64_t pos;
+        std::size_t size;
+        std::vector< char > data;
+    };
+
+    std::size_t bufferSize;
+    std::size_t maxQueued;
+    std::size_t queued;
+    std::deque< Block > queue;
+    std::vector< std::vector< char > > spares;
+    std::mutex queueLock;
+    std::condition_variable queueChanged;
+    std::thread writer;
+    bool stopWriter;
+    std::exception_ptr writerError;
+
+    void initPending(std::size_t iBufferSize)
+    {
+        // asynchronous writes have to go through the buffer
+        if (maxQueued != 0 && iBufferSize == 0)
+        {
+            iBufferSize = std::min< std::size_t >(maxQueued, 4194304);
+        }
+        bufferSize = iBufferSize;
+        pending.resize(bufferSize);
+    }
+
+    void startWriting()
+    {
+        if (maxQueued != 0)
+        {
+            writer = std::thread(&PrivateData::writeQueued, this);
+        }
+    }
+
+    // lets the writer thread drain the queue and waits for it to finish
+    void stopWriting()
+    {
+        if (writer.joinable())
+        {
+            {
+                std::lock_guard< std::mutex > l(queueLock);
+                stopWriter = true;
+            }
+            queueChanged.notify_all();
+            writer.join();
+        }
+    }
+
+    // the body of the writer thread
+    void writeQueued()
+    {
+        std::unique_lock< std::mutex > l(queueLock);
+        for (;;)
+        {
+            while (queue.empty() && !stopWriter)
+            {
+                queueChanged.wait(l);
+            }
+
+            if (queue.empty())
+            {
+                return;
+            }
+
+            // only we pop from the queue, so this stays put while unlocked
+            Block & block = queue.front();
+            bool failed = (writerError != NULL);
+            std::exception_ptr error;
+            l.unlock();
+
+            // once something has gone wrong just drain the queue
+            if (!failed)
+            {
+                try
+                {
+                    stream->seekp(block.pos + startPos).write(
+                        &block.data.front(), block.size);
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+            }
+
+            l.lock();
+            if (error)
+            {
+                writerError = error;
+            }
+
+            queued -= block.size;
+            if (block.data.size() == bufferSize && spares.size() < 2)
+            {
+                spares.push_back(std::vector< char >());
+                spares.back().swap(block.data);
+            }
+            queue.pop_front();
+            queueChanged.notify_all();
+        }
+    }
+
+    // hands iData over to the writer thread, leaving it empty
+    void queueBlock(Alembic::Util::uint64_t iPos, std::vector< char > & iData,
+                    std::size_t iSize)
+    {
+        std::unique_lock< std::mutex > l(queueLock);
+
+        // always let at least one block through so we can't get stuck
+        while (queued != 0 && queued + iSize > maxQueued && !writerError)
+        {
+            queueChanged.wait(l);
+        }
+
+        queue.push_back(Block());
+        queue.back().pos = iPos;
+        queue.back().size = iSize;
+        queue.back().data.swap(iData);
+        queued += iSize;
+        queueChanged.notify_all();
+    }
+
+    // replaces pending after it was handed to the writer thread, reusing
+    // a buffer which has already been written if there is one
+    void replacePending()
+    {
+        {
+            std::lock_guard< std::mutex > l(queueLock);
+            if (!spares.empty())
+            {
+                pending.swap(spares.back());
+                spares.pop_back();
+            }
+        }
+
+        if (pending.empty())
+        {
+            pending.resize(bufferSize);
+        }
+    }
+
+    // waits until the writer thread has written everything queued so far
+    void waitForWriter()
+    {
+        std::unique_lock< std::mutex > l(queueLock);
+        while (!queue.empty())
+        {
+            queueChanged.wait(l);
+        }
+    }
+
+    // rethrows the first error the writer thread ran into
+    void checkWriter()
+    {
+        std::exception_ptr error;
+        {
+            std::lock_guard< std::mutex > l(queueLock);
+            error = writerError;
+        }
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // expects the lock to be held
+    void writePending()
+    {
+        if (pendingUsed != 0)
+        {
+            if (writer.joinable())
+            {
+                queueBlock(pendingPos, pending, pendingUsed);
+                replacePending();
+            }
+            else
+            {
+                stream->seekp(pendingPos + startPos).write(&pending.front(),
+                                                           pendingUsed);
+            }
+            pendingPos += pendingUsed;
+            pendingUsed = 0;
+        }
+    }
+
+    // writes iSize bytes at iPos, expects the lock to be held
+    void writeAt(Alembic::Util::uint64_t iPos, const void * iBuf,
+                 Alembic::Util::uint64_t iSize)
+    {
+        if (writer.joinable())
+        {
+            checkWriter();
+        }
+
+        if (pending.empty())
+        {
+            stream->seekp(iPos + startPos).write((const char *)iBuf,
+                                                 iSize).flush();
+        }
+        else if (iSize >= bufferSize)
+        {
+            // too big to bother buffering
+            writePending();
+            if (writer.joinable())
+            {
+                const char * buf = (const char *)iBuf;
+                std::vector< char > data(buf, buf + iSize);
+                queueBlock(iPos, data, iSize);
+            }
+            else
+            {
+                stream->seekp(iPos + startPos).write((const char *)iBuf,
+                                                     iSize);
+            }
+            pendingPos = iPos + iSize;
+        }
+        else
+        {
+            // not patching or appending within what the buffer can hold?
+            if (iPos < pendingPos || iPos > pendingPos + pendingUsed ||
+                iPos + iSize > pendingPos + bufferSize)
+            {
+                writePending();
+                pendingPos = iPos;
+            }
+
+            Alembic::Util::uint64_t offset = iPos - pendingPos;
+            std::memcpy(&pending[offset], iBuf, iSize);
+            if (offset + iSize > pendingUsed)
+            {
+                pendingUsed = offset + iSize;
+            }
+        }
+
+        if (iPos + iSize > maxPos)
+        {
+            maxPos = iPos + iSize;
+        }
+    }
 };
 
-OStream::OStream(const std::string & iFileName) :
-    mData(new PrivateData(iFileName))
+OStream::OStream(const std::string & iFileName, std::size_t iBufferSize,
+                 std::size_t iMaxQueued) :
+    mData(new PrivateData(iFileName, iBufferSize, iMaxQueued))
 {
     init();
 }
 
 // we'll be writing from this already open stream which we don't own
-OStream::OStream(std::ostream * iStream) : mData(new PrivateData(iStream))
+OStream::OStream(std::ostream * iStream, std::size_t iBufferSize,
+                 std::size_t iMaxQueued) :
+    mData(new PrivateData(iStream, iBufferSize, iMaxQueued))
 {
     init();
 }
@@ -123,6 +398,16 @@ OStream::~OStream()
     // write our "frozen" byte (totally done writing)
     if (isValid())
     {
+        mData->writePending();
+        mData->stopWriting();
+
+        // if the writer thread failed, what we wrote is incomplete so don't
+        // mark it as frozen
+        if (mData->writerError)
+        {
+            return;
+        }
+
         char frozen = 0xff;
         mData->stream->seekp(mData->startPos + 5).write(&frozen, 1).flush();
     }
@@ -162,6 +447,9 @@ void OStream::init()
         {
             mData->maxPos = mData->curPos;
         }
+
+        // from here on only the writer thread touches the stream
+        mData->startWriting();
     }
 }
 
@@ -172,7 +460,12 @@ Alembic::Util::uint64_t OStream::getAndSeekEndPos()
         Alembic::Util::scoped_lock l(mData->lock);
 
         mData->curPos = mData->maxPos;
-        mData->stream->seekp(mData->curPos + mData->startPos);
+
+        // when buffering the stream is positioned lazily by writePending
+        if (mData->pending.empty())
+        {
+            mData->stream->seekp(mData->curPos + mData->startPos);
+        }
         return mData->curPos;
     }
     return 0;
@@ -183,22 +476,107 @@ void OStream::seek(Alembic::Util::uint64_t iPos)
     if (isValid())
     {
         Alembic::Util::scoped_lock l(mData->lock);
-        mData->stream->seekp(iPos + mData->startPos);
+        if (mData->pending.empty())
+        {
+            mData->stream->seekp(iPos + mData->startPos);
+        }
         mData->curPos = iPos;
     }
 }
 
+Alembic::Util::uint64_t OStream::getSize()
+{
+    Alembic::Util::scoped_lock l(mData->lock);
+    return mData->maxPos;
+}
+
+void OStream::flush()
+{
+    if (isValid())
+    {
+        Alembic::Util::scoped_lock l(mData->lock);
+        mData->writePending();
+        if (mData->writer.joinable())
+        {
+            mData->waitForWriter();
+            mData->checkWriter();
+        }
+        mData->stream->flush();
+    }
+}
+
 void OStream::write(const void * iBuf, Alembic::Util::uint64_t iSize)
 {
     if (isValid())
     {
         Alembic::Util::scoped_lock l(mData->lock);
-        mData->stream->write((const char *)iBuf, iSize).flush();
+        mData->writeAt(mData->curPos, iBuf, iSize);
         mData->curPos += iSize;
-        if(mData->curPos > mData->maxPos)
+    }
+}
+
+Alembic::Util::uint64_t OStream::append(Alembic::Util::uint64_t iNumData,
+                                        const Alembic::Util::uint64_t * iSizes,
+                                        const void * const * iDatas)
+{
+    if (!isValid())
+    {
+        return 0;
+    }
+
+    Alembic::Util::uint64_t totalSize = 0;
+    for (Alembic::Util::uint64_t i = 0; i < iNumData; ++i)
+    {
+        totalSize += iSizes[i];
+    }
+
+    // Too big to bother buffering, and written by the writer thread, so
+    // gather it up before taking the lock and only hold the lock long enough
+    // to find out where it goes and queue it.
+    if (mData->writer.joinable() && totalSize >= mData->bufferSize)
+    {
+        std::vector< char > data(totalSize);
+        Alembic::Util::uint64_t offset = 0;
+        for (Alembic::Util::uint64_t i = 0; i < iNumData; ++i)
         {
-            mData->maxPos = mData->curPos;
+            if (iSizes[i] != 0)
+            {
+                std::memcpy(&data[offset], iDatas[i], iSizes[i]);
+                offset += iSizes[i];
+            }
         }
+
+        Alembic::Util::scoped_lock l(mData->lock);
+        mData->checkWriter();
+        Alembic::Util::uint64_t pos = mData->maxPos;
+        mData->writePending();
+        mData->queueBlock(pos, data, totalSize);
+        mData->pendingPos = pos + totalSize;
+        mData->maxPos = pos + totalSize;
+        return pos;
+    }
+
+    Alembic::Util::scoped_lock l(mData->lock);
+    Alembic::Util::uint64_t pos = mData->maxPos;
+    Alembic::Util::uint64_t offset = pos;
+    for (Alembic::Util::uint64_t i = 0; i < iNumData; ++i)
+    {
+        if (iSizes[i] != 0)
+        {
+            mData->writeAt(offset, iDatas[i], iSizes[i]);
+            offset += iSizes[i];
+        }
+    }
+    return pos;
+}
+
+void OStream::writeAt(Alembic::Util::uint64_t iPos, const void * iBuf,
+                      Alembic::Util::uint64_t iSize)
+{
+    if (isValid())
+    {
+        Alembic::Util::scoped_lock l(mData->lock);
+        mData->writeAt(iPos, iBuf, iSize);
     }
 }
 
@@ -52,8 +52,18 @@ namespace ALEMBIC_VERSION_NS {
 class ALEMBIC_EXPORT OStream
 {
 public:
-    OStream(const std::string & iFileName);
-    OStream(std::ostream * iStream);
+    // iBufferSize is the size in bytes of the write combining buffer,
+    // 0 means every write goes straight to the stream and is flushed.
+    // Otherwise writes are gathered in the buffer and only handed to the
+    // stream when it fills up, when writing outside of it, or on destruction.
+    //
+    // If iMaxQueued isn't 0, full buffers are written to the stream by a
+    // background thread, and write only waits for it once more than
+    // iMaxQueued bytes are queued up.  A buffer size of 0 then picks one.
+    OStream(const std::string & iFileName, std::size_t iBufferSize=0,
+            std::size_t iMaxQueued=0);
+    OStream(std::ostream * iStream, std::size_t iBufferSize=0,
+            std::size_t iMaxQueued=0);
     ~OStream();
 
     bool isValid();
@@ -62,6 +72,26 @@ public:
     void write(const void * iBuf, Alembic::Util::uint64_t iSize);
     void seek(Alembic::Util::uint64_t iPos);
 
+    // Writes the iNumData buffers, one after the other, at the end of the
+    // stream and returns where they start.  Nothing else can be written in
+    // between, so unlike getAndSeekEndPos and write this can be called from
+    // several threads at once.
+    Alembic::Util::uint64_t append(Alembic::Util::uint64_t iNumData,
+                                   const Alembic::Util::uint64_t * iSizes,
+                                   const void * const * iDatas);
+
+    // overwrites iSize bytes, which have already been written, at iPos
+    // can also be called from several threads at once
+    void writeAt(Alembic::Util::uint64_t iPos, const void * iBuf,
+                 Alembic::Util::uint64_t iSize);
+
+    // the end of what has been written so far
+    Alembic::Util::uint64_t getSize();
+
+    // hands anything still in the write buffer to the stream, waits for it
+    // to be written, and flushes it
+    void flush();
+
 private:
     // noncopyable
     OStream(const OStream &);
@@ -37,6 +37,12 @@
 #include <Alembic/Ogawa/All.h>
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
 void test(bool iUseMMap)
 {
     {
@@ -78,11 +84,293 @@ void stringStreamTest()
 }
 
 
+void failedPageTest()
+{
+    // enough children that they are read a page at a time
+    std::stringstream strm;
+    {
+        Alembic::Ogawa::OArchive oa(&strm);
+        for (Alembic::Util::uint64_t i = 0; i < 1500; ++i)
+        {
+            oa.getGroup()->addData(8, &i);
+        }
+    }
+
+    std::vector< std::istream * > streams;
+    streams.push_back(&strm);
+    Alembic::Ogawa::IArchive ia(streams);
+    Alembic::Ogawa::IGroupPtr group = ia.getGroup();
+    TESTING_ASSERT(group->getNumChildren() == 1500);
+
+    Alembic::Util::uint64_t val = 0;
+    group->getData(10, 0)->read(8, &val, 0, 0);
+    TESTING_ASSERT(val == 10);
+
+    // reading the page with 1100 in it fails
+    std::stringbuf emptyBuf;
+    std::istream & istrm = strm;
+    std::streambuf * buf = istrm.rdbuf(&emptyBuf);
+    TESTING_ASSERT_THROW(group->getData(1100, 0), std::exception);
+    istrm.rdbuf(buf);
+
+    // and nothing wrong about it was kept around
+    group->getData(1100, 0)->read(8, &val, 0, 0);
+    TESTING_ASSERT(val == 1100);
+    group->getData(1499, 0)->read(8, &val, 0, 0);
+    TESTING_ASSERT(val == 1499);
+}
+
+void writeSharedFile(const std::string & iName, const std::string & iData)
+{
+    Alembic::Ogawa::OArchive oa(iName);
+    oa.getGroup()->addData(iData.size(), iData.c_str());
+}
+
+std::string readSharedFile(const Alembic::Ogawa::IArchive & iArchive)
+{
+    Alembic::Ogawa::IDataPtr data = iArchive.getGroup()->getData(0, 0);
+    std::string str(data->getSize(), ' ');
+    data->read(str.size(), &str[0], 0, 0);
+    return str;
+}
+
+void sharedFilesTest()
+{
+    using Alembic::Ogawa::IArchive;
+    using Alembic::Ogawa::IArchivePtr;
+    using Alembic::Ogawa::IStreams;
+
+    writeSharedFile("sharedA.ogawa", "apple");
+    writeSharedFile("sharedB.ogawa", "banana");
+    writeSharedFile("sharedC.ogawa", "cherry");
+    TESTING_ASSERT(IStreams::getNumSharedFiles() == 0);
+
+    {
+        // the same file by another name is still shared
+        IArchive a("sharedA.ogawa", 1, true, true);
+        IArchive a2("./sharedA.ogawa", 4, true, true);
+        IArchive unshared("sharedA.ogawa", 1, true);
+        TESTING_ASSERT(IStreams::getNumSharedFiles() == 1);
+        TESTING_ASSERT(a2.getStreams()->getNumStreams() == 4);
+        TESTING_ASSERT(readSharedFile(a2) == "apple");
+
+        const void * mapped = a.getStreams()->getMappedData(0, 8);
+        TESTING_ASSERT(mapped != NULL);
+        TESTING_ASSERT(mapped == a2.getStreams()->getMappedData(0, 8));
+        TESTING_ASSERT(mapped != unshared.getStreams()->getMappedData(0, 8));
+
+        // memory mapped files don't hold a descriptor open
+        TESTING_ASSERT(IStreams::getNumOpenFiles() == 0);
+
+        IArchive streamed("sharedA.ogawa", 2, false, true);
+        TESTING_ASSERT(IStreams::getNumSharedFiles() == 2);
+        TESTING_ASSERT(IStreams::getNumOpenFiles() == 1);
+        TESTING_ASSERT(readSharedFile(streamed) == "apple");
+    }
+    TESTING_ASSERT(IStreams::getNumSharedFiles() == 0);
+    TESTING_ASSERT(IStreams::getNumOpenFiles() == 0);
+
+    IStreams::setMaxOpenFiles(2);
+    TESTING_ASSERT(IStreams::getMaxOpenFiles() == 2);
+    {
+        const char * names[] = {"sharedA.ogawa", "sharedB.ogawa",
+            "sharedC.ogawa", "sharedA.ogawa"};
+        const char * contents[] = {"apple", "banana", "cherry", "apple"};
+
+        std::vector< IArchivePtr > archives;
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            archives.push_back(IArchivePtr(new IArchive(names[i], 1, false,
+                                                        true)));
+            TESTING_ASSERT(archives.back()->isValid());
+        }
+        TESTING_ASSERT(IStreams::getNumSharedFiles() == 3);
+        TESTING_ASSERT(IStreams::getNumOpenFiles() == 2);
+
+        // the closed ones are opened again as they are read
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                TESTING_ASSERT(readSharedFile(*archives[i]) == contents[i]);
+                TESTING_ASSERT(IStreams::getNumOpenFiles() == 2);
+            }
+        }
+
+        IStreams::setMaxOpenFiles(1);
+        TESTING_ASSERT(IStreams::getNumOpenFiles() == 1);
+        TESTING_ASSERT(readSharedFile(*archives[1]) == "banana");
+        TESTING_ASSERT(IStreams::getNumOpenFiles() == 1);
+    }
+    TESTING_ASSERT(IStreams::getNumSharedFiles() == 0);
+    TESTING_ASSERT(IStreams::getNumOpenFiles() == 0);
+
+    IStreams::setMaxOpenFiles(0);
+}
+
+std::string readGrowingFile(const Alembic::Ogawa::IArchive & iArchive,
+                            Alembic::Util::uint64_t iIndex)
+{
+    Alembic::Ogawa::IDataPtr data = iArchive.getGroup()->getData(iIndex, 0);
+    std::string str(data->getSize(), ' ');
+    data->read(str.size(), &str[0], 0, 0);
+    return str;
+}
+
+void growingSharedFileTest(bool iUseMMap)
+{
+    using Alembic::Ogawa::IArchive;
+    using Alembic::Ogawa::IStreams;
+    using Alembic::Ogawa::OArchive;
+    using Alembic::Ogawa::OGroupPtr;
+
+    writeSharedFile("sharedD.ogawa", "date");
+
+    OArchive oa("sharedGrow.ogawa");
+    OGroupPtr first = oa.getGroup()->addGroup();
+    first->addData(5, "apple");
+    first->freeze();
+    oa.checkpoint(first);
+
+    IArchive a("sharedGrow.ogawa", 1, iUseMMap, true);
+    IArchive other("sharedGrow.ogawa", 1, iUseMMap, true);
+    TESTING_ASSERT(a.getStreams()->isCheckpoint());
+    TESTING_ASSERT(IStreams::getNumSharedFiles() == 1);
+    Alembic::Util::uint64_t size = other.getStreams()->getSize();
+    const void * mapped = other.getStreams()->getMappedData(0, 8);
+
+    OGroupPtr second = oa.getGroup()->addGroup();
+    second->addData(5, "apple");
+    second->addData(6, "banana");
+    second->freeze();
+    oa.checkpoint(second);
+
+    // the refreshed archive moves onto a reader of its own, the reader
+    // other shares is left just as it was
+    TESTING_ASSERT(a.refresh());
+    TESTING_ASSERT(a.getStreams()->getSize() > size);
+    TESTING_ASSERT(a.getGroup()->getNumChildren() == 2);
+    TESTING_ASSERT(readGrowingFile(a, 1) == "banana");
+    TESTING_ASSERT(other.getStreams()->getSize() == size);
+    TESTING_ASSERT(other.getStreams()->getMappedData(0, 8) == mapped);
+    TESTING_ASSERT(readGrowingFile(other, 0) == "apple");
+    TESTING_ASSERT(IStreams::getNumSharedFiles() == 1);
+
+    // the private reader keeps following the file
+    OGroupPtr third = oa.getGroup()->addGroup();
+    third->addData(5, "apple");
+    third->addData(6, "banana");
+    third->addData(6, "cherry");
+    third->freeze();
+    oa.checkpoint(third);
+    TESTING_ASSERT(a.refresh());
+    TESTING_ASSERT(readGrowingFile(a, 2) == "cherry");
+
+    // the descriptors of the grown file are opened again after being
+    // closed to make way for another file
+    IStreams::setMaxOpenFiles(1);
+    {
+        IArchive d("sharedD.ogawa", 1, iUseMMap, true);
+        TESTING_ASSERT(readSharedFile(d) == "date");
+        TESTING_ASSERT(readGrowingFile(other, 0) == "apple");
+        TESTING_ASSERT(readSharedFile(d) == "date");
+        TESTING_ASSERT(readGrowingFile(a, 2) == "cherry");
+    }
+    IStreams::setMaxOpenFiles(0);
+
+    TESTING_ASSERT(other.refresh());
+    TESTING_ASSERT(readGrowingFile(other, 2) == "cherry");
+}
+
+// how many times iName is memory mapped by this process, or 0 where that
+// can't be found out
+std::size_t countMappings(const std::string & iName)
+{
+    std::size_t count = 0;
+#ifdef __linux__
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    while (std::getline(maps, line))
+    {
+        if (line.size() > iName.size() &&
+            line.compare(line.size() - iName.size() - 1, std::string::npos,
+                         "/" + iName) == 0)
+        {
+            ++count;
+        }
+    }
+#endif
+    return count;
+}
+
+void refreshMappingsTest()
+{
+    using Alembic::Ogawa::IArchive;
+    using Alembic::Ogawa::IStreams;
+    using Alembic::Ogawa::OArchive;
+    using Alembic::Ogawa::OGroupPtr;
+
+    IStreams::MappingPtr held;
+    {
+        OArchive oa("refreshMappings.ogawa");
+        OGroupPtr first = oa.getGroup()->addGroup();
+        first->addData(5, "apple");
+        first->freeze();
+        oa.checkpoint(first);
+
+        IArchive a("refreshMappings.ogawa", 1, true);
+        const void * mapped = a.getStreams()->getMappedData(0, 5, &held);
+        TESTING_ASSERT(mapped != NULL);
+
+        // only the current mapping and the one being held onto are kept
+        for (std::size_t i = 0; i < 2000; ++i)
+        {
+            OGroupPtr next = oa.getGroup()->addGroup();
+            next->addData(6, "banana");
+            next->freeze();
+            oa.checkpoint(next);
+            TESTING_ASSERT(a.refresh());
+        }
+        TESTING_ASSERT(readGrowingFile(a, 0) == "banana");
+        TESTING_ASSERT(countMappings("refreshMappings.ogawa") <= 2);
+        TESTING_ASSERT(std::memcmp(mapped, "Ogawa", 5) == 0);
+
+        held.reset();
+        TESTING_ASSERT(countMappings("refreshMappings.ogawa") <= 1);
+    }
+
+    // a file renamed into its place isn't more of the one which was opened,
+    // Windows won't replace a file which is still open
+#ifndef _WIN32
+    {
+        OArchive oa("refreshReplaced.ogawa");
+        OGroupPtr first = oa.getGroup()->addGroup();
+        first->addData(5, "apple");
+        first->freeze();
+        oa.checkpoint(first);
+
+        IArchive a("refreshReplaced.ogawa", 1, true);
+        writeSharedFile("refreshReplacement.ogawa",
+                        std::string(4096, 'x'));
+        TESTING_ASSERT(std::rename("refreshReplacement.ogawa",
+                                   "refreshReplaced.ogawa") == 0);
+
+        TESTING_ASSERT(!a.refresh());
+        TESTING_ASSERT(readGrowingFile(a, 0) == "apple");
+    }
+#endif
+}
+
 int main ( int argc, char *argv[] )
 {
     test(true);     // Use mmap
     test(false);    // Use streams
 
     stringStreamTest();
+    failedPageTest();
+    sharedFilesTest();
+    growingSharedFileTest(true);
+    growingSharedFileTest(false);
+    refreshMappingsTest();
     return 0;
 }
\ No newline at end of file
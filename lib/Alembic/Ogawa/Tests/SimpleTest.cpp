@@ -37,12 +37,13 @@
 #include <Alembic/Ogawa/All.h>
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 #include <iostream>
+#include <sstream>
 
-void test(bool iUseMMap)
+void test(bool iUseMMap, std::size_t iBufferSize, std::size_t iMaxQueued)
 {
 
 {
-    Alembic::Ogawa::OArchive oa("simpleTest.ogawa");
+    Alembic::Ogawa::OArchive oa("simpleTest.ogawa", iBufferSize, iMaxQueued);
     Alembic::Ogawa::OGroupPtr top = oa.getGroup();
     TESTING_ASSERT(!top->isFrozen());
 
@@ -187,10 +188,239 @@ void test(bool iUseMMap)
 
 }
 
+void checkBatchedReads(Alembic::Ogawa::IArchive & ia,
+                       const std::vector< std::vector< char > > & iDatas)
+{
+    Alembic::Ogawa::IGroupPtr top = ia.getGroup();
+    TESTING_ASSERT(top->getNumChildren() == iDatas.size() + 2);
+
+    // past the end gives us NULLs
+    std::vector< Alembic::Ogawa::IDataPtr > datas;
+    top->getData(0, iDatas.size() + 4, 0, datas);
+    TESTING_ASSERT(datas.size() == iDatas.size() + 4);
+    TESTING_ASSERT(datas[0]->getSize() == 0);
+    TESTING_ASSERT(!datas[iDatas.size() + 1]);
+    TESTING_ASSERT(!datas.back());
+
+    std::vector< std::vector< char > > readBack(iDatas.size());
+    std::vector< Alembic::Ogawa::IData::ReadRequest > requests;
+    for (std::size_t i = 0; i < iDatas.size(); ++i)
+    {
+        Alembic::Ogawa::IDataPtr data = datas[i + 1];
+        TESTING_ASSERT(data->getSize() == iDatas[i].size());
+        TESTING_ASSERT(data->getPos() == top->getData(i + 1, 0)->getPos());
+
+        if (iDatas[i].empty())
+        {
+            continue;
+        }
+
+        // read it in two pieces, with the second one first
+        readBack[i].resize(iDatas[i].size());
+        std::size_t half = iDatas[i].size() / 2;
+        Alembic::Ogawa::IData::ReadRequest second = { data.get(),
+            iDatas[i].size() - half, &readBack[i][half], half };
+        Alembic::Ogawa::IData::ReadRequest first = { data.get(), half,
+            &readBack[i].front(), 0 };
+        requests.push_back(second);
+        requests.push_back(first);
+    }
+
+    Alembic::Ogawa::IData::readv(&requests.front(), requests.size(), 0);
+
+    for (std::size_t i = 0; i < iDatas.size(); ++i)
+    {
+        TESTING_ASSERT(readBack[i] == iDatas[i]);
+    }
+
+    // the last group is light, so the children are read as needed
+    Alembic::Ogawa::IGroupPtr light = top->getGroup(iDatas.size() + 1, true,
+                                                    0);
+    TESTING_ASSERT(light->isLight());
+    light->getData(3, 20, 0, datas);
+    TESTING_ASSERT(datas.size() == 20);
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+        TESTING_ASSERT(datas[i]->getSize() == 1);
+        char c = 0;
+        datas[i]->read(1, &c, 0, 0);
+        TESTING_ASSERT(c == char(i + 3));
+    }
+}
+
+void batchedReadTest()
+{
+    // all sorts of sizes, including ones much bigger than will be merged
+    std::vector< std::vector< char > > datas;
+    for (std::size_t i = 0; i < 40; ++i)
+    {
+        std::size_t size = i % 4 == 0 ? i * 11 : i * i * i * 7;
+        datas.push_back(std::vector< char >(size));
+        for (std::size_t j = 0; j < size; ++j)
+        {
+            datas.back()[j] = char(i + j * 3);
+        }
+    }
+
+    std::stringstream strm;
+    strm << "prefix";
+    for (int s = 0; s < 2; ++s)
+    {
+        Alembic::Util::unique_ptr< Alembic::Ogawa::OArchive > oa;
+        if (s == 0)
+        {
+            oa.reset(new Alembic::Ogawa::OArchive("batchedReadTest.ogawa"));
+        }
+        else
+        {
+            oa.reset(new Alembic::Ogawa::OArchive(&strm));
+        }
+
+        Alembic::Ogawa::OGroupPtr top = oa->getGroup();
+        top->addEmptyData();
+        for (std::size_t i = 0; i < datas.size(); ++i)
+        {
+            if (datas[i].empty())
+            {
+                top->addEmptyData();
+            }
+            else
+            {
+                top->addData(datas[i].size(), &datas[i].front());
+            }
+        }
+
+        Alembic::Ogawa::OGroupPtr light = top->addGroup();
+        for (std::size_t i = 0; i < 30; ++i)
+        {
+            char c = char(i);
+            light->addData(1, &c);
+        }
+    }
+
+    Alembic::Ogawa::IArchive mmapArchive("batchedReadTest.ogawa", 1, true);
+    checkBatchedReads(mmapArchive, datas);
+
+    Alembic::Ogawa::IArchive fileArchive("batchedReadTest.ogawa", 1, false);
+    checkBatchedReads(fileArchive, datas);
+
+    strm.seekg(6);
+    std::vector< std::istream * > streams;
+    streams.push_back(&strm);
+    Alembic::Ogawa::IArchive streamArchive(streams);
+    checkBatchedReads(streamArchive, datas);
+}
+
+void checkWideGroup(Alembic::Ogawa::IGroupPtr iGroup, std::size_t iNumChildren)
+{
+    TESTING_ASSERT(iGroup->getNumChildren() == iNumChildren);
+    TESTING_ASSERT(!iGroup->isLight());
+
+    // jump all over the place so we go through plenty of windows
+    for (std::size_t j = 0; j < iNumChildren; ++j)
+    {
+        std::size_t i = (j * 997) % iNumChildren;
+        if (i % 7 == 0)
+        {
+            TESTING_ASSERT(iGroup->isChildGroup(i));
+            TESTING_ASSERT(iGroup->isEmptyChildGroup(i));
+            TESTING_ASSERT(!iGroup->getData(i, 0));
+        }
+        else if (i % 5 == 0)
+        {
+            TESTING_ASSERT(iGroup->isChildGroup(i));
+            TESTING_ASSERT(!iGroup->isEmptyChildGroup(i));
+            Alembic::Ogawa::IGroupPtr child = iGroup->getGroup(i, false, 0);
+            TESTING_ASSERT(child->getNumChildren() == 1);
+            TESTING_ASSERT(child->getData(0, 0)->getSize() == 2);
+        }
+        else
+        {
+            TESTING_ASSERT(iGroup->isChildData(i));
+            TESTING_ASSERT(!iGroup->isEmptyChildData(i));
+            TESTING_ASSERT(!iGroup->getGroup(i, false, 0));
+            Alembic::Ogawa::IDataPtr data = iGroup->getData(i, 0);
+            TESTING_ASSERT(data->getSize() == 4);
+            Alembic::Util::uint32_t val = 0;
+            data->read(4, &val, 0, 0);
+            TESTING_ASSERT(val == i);
+        }
+    }
+
+    TESTING_ASSERT(!iGroup->isChildGroup(iNumChildren));
+    TESTING_ASSERT(!iGroup->isChildData(iNumChildren));
+    TESTING_ASSERT(!iGroup->getData(iNumChildren, 0));
+    TESTING_ASSERT(!iGroup->getGroup(iNumChildren, false, 0));
+
+    // straddling a window
+    std::vector< Alembic::Ogawa::IDataPtr > datas;
+    iGroup->getData(1020, 8, 0, datas);
+    for (std::size_t i = 1020; i < 1028; ++i)
+    {
+        Alembic::Util::uint32_t val = 0;
+        if (i % 7 == 0 || i % 5 == 0)
+        {
+            TESTING_ASSERT(!datas[i - 1020]);
+            continue;
+        }
+        datas[i - 1020]->read(4, &val, 0, 0);
+        TESTING_ASSERT(val == i);
+    }
+}
+
+void wideGroupTest(bool iUseMMap)
+{
+    std::size_t numChildren = 20000;
+    {
+        Alembic::Ogawa::OArchive oa("wideGroupTest.ogawa");
+        Alembic::Ogawa::OGroupPtr wide = oa.getGroup()->addGroup();
+        for (Alembic::Util::uint32_t i = 0; i < numChildren; ++i)
+        {
+            if (i % 7 == 0)
+            {
+                wide->addEmptyGroup();
+            }
+            else if (i % 5 == 0)
+            {
+                wide->addGroup()->addData(2, &i);
+            }
+            else
+            {
+                wide->addData(4, &i);
+            }
+        }
+    }
+
+    Alembic::Ogawa::IArchive ia("wideGroupTest.ogawa", 1, iUseMMap);
+    Alembic::Ogawa::IGroupPtr wide = ia.getGroup()->getGroup(0, false, 0);
+    checkWideGroup(wide, numChildren);
+
+    // light groups still just read what they are asked for
+    Alembic::Ogawa::IGroupPtr light = ia.getGroup()->getGroup(0, true, 0);
+    TESTING_ASSERT(light->isLight());
+    TESTING_ASSERT(!light->isChildData(1));
+    Alembic::Util::uint32_t val = 0;
+    light->getData(19998, 0)->read(4, &val, 0, 0);
+    TESTING_ASSERT(val == 19998);
+}
+
 int main ( int argc, char *argv[] )
 {
-    test(true);     // Use mmap
-    test(false);    // Use streams
+    test(true, 0, 0);     // Use mmap
+    test(false, 0, 0);    // Use streams
+
+    // small enough that most writes won't fit, and plenty big
+    test(true, 16, 0);
+    test(false, 1024 * 1024, 0);
+
+    // written by a background thread
+    test(true, 16, 32);
+    test(false, 0, 1024 * 1024);
+
+    batchedReadTest();
+
+    wideGroupTest(true);
+    wideGroupTest(false);
 
     return 0;
 }
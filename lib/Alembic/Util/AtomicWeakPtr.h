@@ -0,0 +1,189 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+//-*****************************************************************************
+//! \file Alembic/Util/AtomicWeakPtr.h
+//! \brief The header file containing the class definition for
+//!     the \ref Alembic::Util::AtomicWeakPtr class
+//-*****************************************************************************
+#ifndef Alembic_Util_AtomicWeakPtr_h
+#define Alembic_Util_AtomicWeakPtr_h
+
+#include <Alembic/Util/Foundation.h>
+
+#include <atomic>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// ATOMIC WEAK POINTER
+//
+//! \brief A weak pointer which any number of threads can lock at once
+//!     without taking a mutex, for the readers which hang on to the children
+//!     and properties they have made without keeping them alive.
+//!
+//! \details lock never blocks.  Storing a new pointer, which only happens
+//!     when what was stored before has gone away, must be done by one
+//!     thread at a time, usually under the mutex guarding the making of a
+//!     new one:
+//!
+//! \code
+//!     ChildPtr child = m_child.lock();
+//!     if ( !child )
+//!     {
+//!         scoped_lock l( m_lock );
+//!         child = m_child.lock();
+//!         if ( !child )
+//!         {
+//!             child.reset( new Child() );
+//!             m_child.store( child );
+//!         }
+//!     }
+//! \endcode
+//!
+//!     Each pointer stored is kept in a node which is never changed once
+//!     it is published.  Nodes which have been replaced are freed by a
+//!     later store, or the destructor, once no lock is looking at them.
+//-*****************************************************************************
+template < class T >
+class AtomicWeakPtr
+{
+public:
+    AtomicWeakPtr()
+      : m_node( NULL )
+      , m_numLocking( 0 )
+      , m_retired( NULL )
+    {
+    }
+
+    //! Copies what iCopy points to.  Neither copying nor assigning is safe
+    //! to do while other threads are using either pointer.
+    AtomicWeakPtr( const AtomicWeakPtr & iCopy )
+      : m_node( NULL )
+      , m_numLocking( 0 )
+      , m_retired( NULL )
+    {
+        store( iCopy.lock() );
+    }
+
+    AtomicWeakPtr & operator=( const AtomicWeakPtr & iCopy )
+    {
+        if ( this != &iCopy )
+        {
+            store( iCopy.lock() );
+        }
+        return *this;
+    }
+
+    ~AtomicWeakPtr()
+    {
+        delete m_node.load( std::memory_order_relaxed );
+        freeRetired();
+    }
+
+    //! What was stored, if it is still alive, otherwise NULL.
+    shared_ptr< T > lock() const
+    {
+        // announce ourselves before looking at the node, so that a store
+        // which doesn't see us also can't have freed the node we find
+        m_numLocking.fetch_add( 1, std::memory_order_seq_cst );
+
+        shared_ptr< T > ret;
+        const Node * node = m_node.load( std::memory_order_seq_cst );
+        if ( node )
+        {
+            ret = node->ptr.lock();
+        }
+
+        m_numLocking.fetch_sub( 1, std::memory_order_release );
+        return ret;
+    }
+
+    //! Points at iPtr, without keeping it alive.  Only one thread at a time
+    //! may store.
+    void store( const shared_ptr< T > & iPtr )
+    {
+        Node * old = m_node.exchange( new Node( iPtr ),
+                                      std::memory_order_seq_cst );
+        if ( old )
+        {
+            old->next = m_retired;
+            m_retired = old;
+        }
+
+        if ( m_numLocking.load( std::memory_order_seq_cst ) == 0 )
+        {
+            // anyone locking from here on sees the new node
+            freeRetired();
+        }
+    }
+
+private:
+    struct Node
+    {
+        Node( const shared_ptr< T > & iPtr ) : ptr( iPtr ), next( NULL ) {}
+
+        weak_ptr< T > ptr;
+        Node * next;
+    };
+
+    void freeRetired()
+    {
+        while ( m_retired )
+        {
+            Node * next = m_retired->next;
+            delete m_retired;
+            m_retired = next;
+        }
+    }
+
+    std::atomic< Node * > m_node;
+    mutable std::atomic< std::size_t > m_numLocking;
+
+    // nodes which have been replaced, but may still be looked at
+    Node * m_retired;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Util
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,225 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+//-*****************************************************************************
+//! \file Alembic/Util/NameIndex.cpp
+//! \brief The body file containing the class implementation for
+//!     the \ref Alembic::Util::NameIndex class
+//-*****************************************************************************
+
+#include <Alembic/Util/NameIndex.h>
+
+#include <functional>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+NameIndex::NameIndex()
+{
+}
+
+//-*****************************************************************************
+void NameIndex::reserve( std::size_t iNumNames )
+{
+    // keep it no more than half full, so probes stay short
+    std::size_t numSlots = 16;
+    while ( numSlots < iNumNames * 2 )
+    {
+        numSlots *= 2;
+    }
+
+    if ( numSlots > m_slots.size() )
+    {
+        rehash( numSlots );
+    }
+
+    m_entries.reserve( iNumNames );
+}
+
+//-*****************************************************************************
+void NameIndex::clear()
+{
+    m_entries.clear();
+    m_slots.clear();
+}
+
+//-*****************************************************************************
+void NameIndex::set( const std::string & iName, std::size_t iIndex )
+{
+    if ( ( m_entries.size() + 1 ) * 2 > m_slots.size() )
+    {
+        reserve( m_entries.size() + 1 );
+    }
+
+    std::size_t hash = hashName( iName );
+    Slot & slot = m_slots[ findSlot( iName, hash ) ];
+    if ( slot.entry != EMPTY_SLOT )
+    {
+        m_entries[ slot.entry ].index = iIndex;
+        return;
+    }
+
+    slot.hash = hash;
+    slot.entry = m_entries.size();
+
+    Entry entry;
+    entry.name = iName;
+    entry.index = iIndex;
+    m_entries.push_back( entry );
+}
+
+//-*****************************************************************************
+bool NameIndex::find( const std::string & iName, std::size_t & oIndex ) const
+{
+    if ( m_entries.empty() )
+    {
+        return false;
+    }
+
+    const Slot & slot = m_slots[ findSlot( iName, hashName( iName ) ) ];
+    if ( slot.entry == EMPTY_SLOT )
+    {
+        return false;
+    }
+
+    oIndex = m_entries[ slot.entry ].index;
+    return true;
+}
+
+//-*****************************************************************************
+bool NameIndex::eraseAndShift( const std::string & iName )
+{
+    if ( m_entries.empty() )
+    {
+        return false;
+    }
+
+    std::size_t hole = findSlot( iName, hashName( iName ) );
+    std::size_t entry = m_slots[ hole ].entry;
+    if ( entry == EMPTY_SLOT )
+    {
+        return false;
+    }
+
+    // close up the hole by moving back anything after it that would
+    // otherwise no longer be found
+    std::size_t mask = m_slots.size() - 1;
+    for ( std::size_t i = ( hole + 1 ) & mask;
+          m_slots[i].entry != EMPTY_SLOT; i = ( i + 1 ) & mask )
+    {
+        std::size_t home = m_slots[i].hash & mask;
+        if ( ( ( i - home ) & mask ) >= ( ( i - hole ) & mask ) )
+        {
+            m_slots[ hole ] = m_slots[i];
+            hole = i;
+        }
+    }
+    m_slots[ hole ].entry = EMPTY_SLOT;
+
+    // move the last entry into the one being removed
+    std::size_t removedIndex = m_entries[ entry ].index;
+    std::size_t last = m_entries.size() - 1;
+    if ( entry != last )
+    {
+        const std::string & lastName = m_entries[ last ].name;
+        m_slots[ findSlot( lastName, hashName( lastName ) ) ].entry = entry;
+        m_entries[ entry ].name.swap( m_entries[ last ].name );
+        m_entries[ entry ].index = m_entries[ last ].index;
+    }
+    m_entries.pop_back();
+
+    for ( std::size_t i = 0; i < m_entries.size(); ++i )
+    {
+        if ( m_entries[i].index > removedIndex )
+        {
+            m_entries[i].index --;
+        }
+    }
+
+    return true;
+}
+
+//-*****************************************************************************
+std::size_t NameIndex::hashName( const std::string & iName )
+{
+    return std::hash< std::string >()( iName );
+}
+
+//-*****************************************************************************
+std::size_t NameIndex::findSlot( const std::string & iName,
+                                 std::size_t iHash ) const
+{
+    // m_slots is never full, so this always finds an empty slot eventually
+    std::size_t mask = m_slots.size() - 1;
+    for ( std::size_t i = iHash & mask; ; i = ( i + 1 ) & mask )
+    {
+        const Slot & slot = m_slots[i];
+        if ( slot.entry == EMPTY_SLOT ||
+             ( slot.hash == iHash && m_entries[ slot.entry ].name == iName ) )
+        {
+            return i;
+        }
+    }
+}
+
+//-*****************************************************************************
+void NameIndex::rehash( std::size_t iNumSlots )
+{
+    Slot empty;
+    empty.hash = 0;
+    empty.entry = EMPTY_SLOT;
+    m_slots.assign( iNumSlots, empty );
+
+    std::size_t mask = iNumSlots - 1;
+    for ( std::size_t i = 0; i < m_entries.size(); ++i )
+    {
+        std::size_t hash = hashName( m_entries[i].name );
+        std::size_t j = hash & mask;
+        while ( m_slots[j].entry != EMPTY_SLOT )
+        {
+            j = ( j + 1 ) & mask;
+        }
+
+        m_slots[j].hash = hash;
+        m_slots[j].entry = i;
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Util
+} // End namespace Alembic
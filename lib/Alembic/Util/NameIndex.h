@@ -0,0 +1,126 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+//-*****************************************************************************
+//! \file Alembic/Util/NameIndex.h
+//! \brief The header file containing the class definition for
+//!     the \ref Alembic::Util::NameIndex class
+//-*****************************************************************************
+#ifndef Alembic_Util_NameIndex_h
+#define Alembic_Util_NameIndex_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Util/Foundation.h>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// NAME INDEX
+//
+//! \brief Maps the names of children to where they are kept, the way the
+//!     readers look their children and properties up by name.
+//!
+//! \details It is an open addressing hash table, with the hash of each name
+//!     kept next to where its entry is, so a lookup is usually a single
+//!     string compare no matter how many names there are.  It is meant to
+//!     be built once when the headers are read, and then only read, which
+//!     is safe to do from many threads at once.
+//-*****************************************************************************
+class ALEMBIC_EXPORT NameIndex
+{
+public:
+    NameIndex();
+
+    //! Makes room for iNumNames names, so adding them won't rehash.
+    void reserve( std::size_t iNumNames );
+
+    std::size_t size() const { return m_entries.size(); }
+
+    bool empty() const { return m_entries.empty(); }
+
+    void clear();
+
+    //! Maps iName to iIndex, replacing what it was mapped to before if it
+    //! was already in here.
+    void set( const std::string & iName, std::size_t iIndex );
+
+    //! Returns true and sets oIndex to what iName is mapped to, if it is in
+    //! here.
+    bool find( const std::string & iName, std::size_t & oIndex ) const;
+
+    //! Removes iName, and then moves everything mapped past it down by one,
+    //! the same way erasing it from the vector the indices are into would.
+    //! Returns false if iName wasn't in here.
+    bool eraseAndShift( const std::string & iName );
+
+private:
+    static const std::size_t EMPTY_SLOT = ~std::size_t( 0 );
+
+    struct Entry
+    {
+        std::string name;
+        std::size_t index;
+    };
+
+    // entry is EMPTY_SLOT when nothing is in the slot
+    struct Slot
+    {
+        std::size_t hash;
+        std::size_t entry;
+    };
+
+    static std::size_t hashName( const std::string & iName );
+
+    // the slot iName is in, or the empty slot it would go in
+    std::size_t findSlot( const std::string & iName,
+                          std::size_t iHash ) const;
+
+    void rehash( std::size_t iNumSlots );
+
+    std::vector< Entry > m_entries;
+    std::vector< Slot > m_slots;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Util
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,118 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+//-*****************************************************************************
+//! \file Alembic/Util/StringArena.cpp
+//! \brief The body file containing the class implementation for
+//!     the \ref Alembic::Util::StringArena class
+//-*****************************************************************************
+
+#include <Alembic/Util/StringArena.h>
+#include <Alembic/Util/Exception.h>
+
+#include <cstring>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+StringArena::StringArena()
+  : m_offsets( 1, 0 )
+{
+}
+
+//-*****************************************************************************
+void StringArena::reserve( std::size_t iNumStrings, std::size_t iNumChars )
+{
+    m_chars.reserve( iNumChars + iNumStrings );
+    m_offsets.reserve( iNumStrings + 1 );
+}
+
+//-*****************************************************************************
+void StringArena::clear()
+{
+    m_chars.clear();
+    m_offsets.resize( 1 );
+}
+
+//-*****************************************************************************
+void StringArena::push_back( const char * iStr, std::size_t iLength )
+{
+    if ( iLength > 0 && memchr( iStr, 0, iLength ) != NULL )
+    {
+        ALEMBIC_THROW( "Illegal NULL character found in string data" );
+    }
+
+    m_chars.insert( m_chars.end(), iStr, iStr + iLength );
+    m_chars.push_back( 0 );
+    m_offsets.push_back( m_chars.size() );
+}
+
+//-*****************************************************************************
+char * StringArena::resizeChars( std::size_t iNumChars )
+{
+    m_chars.resize( iNumChars );
+    m_offsets.resize( 1 );
+    return m_chars.empty() ? NULL : &m_chars.front();
+}
+
+//-*****************************************************************************
+void StringArena::indexChars()
+{
+    m_offsets.resize( 1 );
+
+    std::size_t pos = 0;
+    while ( pos < m_chars.size() )
+    {
+        const char * end = static_cast< const char * >(
+            memchr( &m_chars[pos], 0, m_chars.size() - pos ) );
+
+        if ( end == NULL )
+        {
+            break;
+        }
+
+        pos = end - &m_chars.front() + 1;
+        m_offsets.push_back( pos );
+    }
+
+    m_chars.resize( m_offsets.back() );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Util
+} // End namespace Alembic
@@ -0,0 +1,160 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+//-*****************************************************************************
+//! \file Alembic/Util/StringArena.h
+//! \brief The header file containing the class definition for
+//!     the \ref Alembic::Util::StringArena class
+//-*****************************************************************************
+#ifndef Alembic_Util_StringArena_h
+#define Alembic_Util_StringArena_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Util/Foundation.h>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// STRING ARENA
+//
+//! \brief An array of strings kept in one buffer, instead of each string
+//!     having its own allocation the way an array of std::string does.
+//!
+//! \details The characters of all of the strings are kept one after the
+//!     other, each followed by a null character, which is exactly how an
+//!     array of strings is stored in an archive.  Next to them is where each
+//!     string starts.  Clearing it keeps the memory around, so filling it
+//!     over and over, like when reading a string array property sample after
+//!     sample, doesn't allocate once it is big enough.
+//!
+//!     Like the strings in an archive, the strings can't have any null
+//!     characters in them.
+//-*****************************************************************************
+class ALEMBIC_EXPORT StringArena
+{
+public:
+    //! A string in the arena, like a std::string_view, which is good for as
+    //! long as the arena isn't changed.
+    class Ref
+    {
+    public:
+        Ref( const char * iData, std::size_t iSize )
+          : m_data( iData ), m_size( iSize ) {}
+
+        //! Null terminated, so this can also be used as a C string.
+        const char * data() const { return m_data; }
+
+        std::size_t size() const { return m_size; }
+
+        bool empty() const { return m_size == 0; }
+
+        std::string str() const { return std::string( m_data, m_size ); }
+
+        bool operator==( const std::string & iStr ) const
+        {
+            return iStr.size() == m_size &&
+                iStr.compare( 0, std::string::npos, m_data, m_size ) == 0;
+        }
+
+        bool operator!=( const std::string & iStr ) const
+        { return !( *this == iStr ); }
+
+    private:
+        const char * m_data;
+        std::size_t m_size;
+    };
+
+    StringArena();
+
+    //! Makes room for iNumStrings strings with iNumChars characters between
+    //! them, not counting their null characters.
+    void reserve( std::size_t iNumStrings, std::size_t iNumChars );
+
+    //! Removes all of the strings, but keeps the memory they were using.
+    void clear();
+
+    std::size_t size() const { return m_offsets.size() - 1; }
+
+    bool empty() const { return m_offsets.size() == 1; }
+
+    //! Adds a string to the end, throwing if it has a null character in it.
+    void push_back( const char * iStr, std::size_t iLength );
+
+    void push_back( const std::string & iStr )
+    { push_back( iStr.data(), iStr.size() ); }
+
+    Ref operator[]( std::size_t iIndex ) const
+    {
+        return Ref( &m_chars[ m_offsets[iIndex] ],
+                    m_offsets[iIndex + 1] - m_offsets[iIndex] - 1 );
+    }
+
+    //! The characters of all of the strings, each followed by a null
+    //! character.  NULL when there aren't any strings.
+    const char * chars() const
+    { return m_chars.empty() ? NULL : &m_chars.front(); }
+
+    //! How many characters there are, null characters included.
+    std::size_t numChars() const { return m_chars.size(); }
+
+    //! For filling the arena straight from an archive: resizes the buffer
+    //! returned by chars to iNumChars and returns it, for it to be filled in
+    //! and then handed to indexChars.
+    char * resizeChars( std::size_t iNumChars );
+
+    //! Finds each of the strings in the buffer filled in after resizeChars.
+    //! Anything after the last null character isn't a whole string, and is
+    //! dropped.
+    void indexChars();
+
+private:
+    std::vector< char > m_chars;
+
+    // where each string starts, with one more on the end for where the
+    // next string would go, so there is always at least one
+    std::vector< std::size_t > m_offsets;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Util
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,139 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/NameIndex.h>
+#include <Alembic/Util/Foundation.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <assert.h>
+
+using namespace Alembic::Util;
+
+// checks that every name in iNames is found at its position, and that
+// iMissing isn't found at all
+void checkIndex( const NameIndex & iIndex,
+                 const std::vector< std::string > & iNames,
+                 const std::string & iMissing )
+{
+    assert( iIndex.size() == iNames.size() );
+
+    for ( std::size_t i = 0; i < iNames.size(); ++i )
+    {
+        std::size_t index = 0;
+        bool found = iIndex.find( iNames[i], index );
+        assert( found );
+        assert( index == i );
+    }
+
+    std::size_t index = 0;
+    bool found = iIndex.find( iMissing, index );
+    assert( !found );
+}
+
+int main( int argc, char* argv[] )
+{
+    NameIndex empty;
+    std::size_t index = 0;
+    assert( empty.empty() );
+    assert( !empty.find( "", index ) );
+    assert( !empty.eraseAndShift( "nope" ) );
+
+    // lots of children, like a big flat hierarchy
+    std::vector< std::string > names;
+    for ( std::size_t i = 0; i < 100000; ++i )
+    {
+        std::ostringstream strm;
+        strm << "child" << i;
+        names.push_back( strm.str() );
+    }
+    names.push_back( "" );
+
+    NameIndex nameIndex;
+    nameIndex.reserve( names.size() );
+    for ( std::size_t i = 0; i < names.size(); ++i )
+    {
+        nameIndex.set( names[i], i );
+    }
+    checkIndex( nameIndex, names, "child100000" );
+
+    // the same thing built a name at a time, so it has to grow
+    NameIndex grown;
+    for ( std::size_t i = 0; i < names.size(); ++i )
+    {
+        grown.set( names[i], i );
+    }
+    checkIndex( grown, names, "child" );
+
+    // setting a name again replaces where it goes
+    grown.set( "child5", 7 );
+    assert( grown.size() == names.size() );
+    assert( grown.find( "child5", index ) && index == 7 );
+    grown.set( "child5", 5 );
+
+    // erasing moves everything after it down, like erasing from the vector
+    const char * toErase[] = { "child0", "child99999", "child500", "",
+                               "child501", "child12345" };
+    for ( std::size_t i = 0; i < sizeof( toErase ) / sizeof( toErase[0] );
+          ++i )
+    {
+        bool erased = grown.eraseAndShift( toErase[i] );
+        assert( erased );
+
+        names.erase( std::find( names.begin(), names.end(),
+                                std::string( toErase[i] ) ) );
+        checkIndex( grown, names, toErase[i] );
+
+        erased = grown.eraseAndShift( toErase[i] );
+        assert( !erased );
+    }
+
+    // and names can be put back after
+    grown.set( "child0", names.size() );
+    names.push_back( "child0" );
+    checkIndex( grown, names, "child500" );
+
+    grown.clear();
+    assert( grown.empty() );
+    assert( !grown.find( "child0", index ) );
+    grown.set( "child0", 0 );
+    assert( grown.find( "child0", index ) && index == 0 );
+
+    std::cout << "Success!" << std::endl;
+    return 0;
+}
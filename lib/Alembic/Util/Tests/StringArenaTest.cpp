@@ -0,0 +1,148 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/StringArena.h>
+#include <Alembic/Util/Exception.h>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <assert.h>
+
+using namespace Alembic::Util;
+
+void checkArena( const StringArena & iArena,
+                 const std::vector< std::string > & iStrs )
+{
+    assert( iArena.size() == iStrs.size() );
+    assert( iArena.empty() == iStrs.empty() );
+
+    std::size_t numChars = 0;
+    for ( std::size_t i = 0; i < iStrs.size(); ++i )
+    {
+        StringArena::Ref ref = iArena[i];
+        assert( ref == iStrs[i] );
+        assert( ref.str() == iStrs[i] );
+        assert( ref.size() == iStrs[i].size() );
+        assert( ref.empty() == iStrs[i].empty() );
+        assert( strcmp( ref.data(), iStrs[i].c_str() ) == 0 );
+        numChars += iStrs[i].size() + 1;
+    }
+    assert( iArena.numChars() == numChars );
+}
+
+int main( int argc, char* argv[] )
+{
+    StringArena arena;
+    std::vector< std::string > strs;
+    checkArena( arena, strs );
+    assert( arena.chars() == NULL );
+
+    strs.push_back( "" );
+    strs.push_back( "abc" );
+    strs.push_back( "" );
+    strs.push_back( "a much longer string with spaces in it" );
+    for ( std::size_t i = 0; i < strs.size(); ++i )
+    {
+        arena.push_back( strs[i] );
+    }
+    checkArena( arena, strs );
+    assert( arena[1] != "abd" );
+    assert( arena[1] != "ab" );
+
+    // laid out just like the strings are written
+    const char expected[] = "\0abc\0\0a much";
+    assert( memcmp( arena.chars(), expected, sizeof( expected ) - 1 ) == 0 );
+
+    // null characters aren't allowed, and leave the arena alone
+    bool threw = false;
+    try
+    {
+        arena.push_back( "a\0b", 3 );
+    }
+    catch ( Alembic::Util::Exception & )
+    {
+        threw = true;
+    }
+    assert( threw );
+    checkArena( arena, strs );
+
+    // clearing keeps the memory, so refilling doesn't move it
+    arena.reserve( 1000, 10000 );
+    arena.clear();
+    strs.clear();
+    checkArena( arena, strs );
+    for ( std::size_t i = 0; i < 1000; ++i )
+    {
+        std::ostringstream strm;
+        strm << "name" << i;
+        strs.push_back( strm.str() );
+        arena.push_back( strs.back() );
+    }
+    const char * chars = arena.chars();
+    checkArena( arena, strs );
+    arena.clear();
+    for ( std::size_t i = 0; i < strs.size(); ++i )
+    {
+        arena.push_back( strs[i] );
+    }
+    assert( arena.chars() == chars );
+    checkArena( arena, strs );
+
+    // filled in from outside, the way a reader does
+    const char raw[] = "one\0\0three\0partial";
+    char * buf = arena.resizeChars( sizeof( raw ) - 1 );
+    memcpy( buf, raw, sizeof( raw ) - 1 );
+    arena.indexChars();
+    strs.clear();
+    strs.push_back( "one" );
+    strs.push_back( "" );
+    strs.push_back( "three" );
+    checkArena( arena, strs );
+
+    arena.push_back( "four" );
+    strs.push_back( "four" );
+    checkArena( arena, strs );
+
+    arena.resizeChars( 0 );
+    arena.indexChars();
+    strs.clear();
+    checkArena( arena, strs );
+
+    std::cout << "Success!" << std::endl;
+    return 0;
+}